@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+
+// Encoder Acceleration Configuration
+constexpr uint32_t ACCEL_IDLE_RESET_US = 150000;   // Pause longer than this restarts at 1.0x
+constexpr uint32_t ACCEL_MIN_INTERVAL_US = 500;    // Clamp for bursts folded into one delta
+constexpr int32_t ACCEL_MAX_OUTPUT_DELTA = 127;    // Per-event output ceiling (fits a HID wheel report)
+
+// Default curves per wheel mode (velocity in detents/s, gain Q8)
+// Scroll: quadratic, starts above 6 det/s, 2x at ~26 det/s, capped at 24x
+#define ACCEL_DEFAULT_SCROLL AccelerationCurve::power(6, 20, 2, 24 * 256)
+// Volume: gentle linear ramp, capped at 3x
+#define ACCEL_DEFAULT_VOLUME AccelerationCurve::linear(10, 8, 3 * 256)
+// Zoom: always exact
+#define ACCEL_DEFAULT_ZOOM AccelerationCurve::none()
+
+// Serial upload: 'A' | wheel mode u8 | AccelerationCurve blob LE (see tools/accel_curve.py)
+// Enable with build flag -D ACCEL_CURVE_UPLOAD_ENABLED=1 (otherwise a stray 'A' on the console is ignored)
+#ifndef ACCEL_CURVE_UPLOAD_ENABLED
+#define ACCEL_CURVE_UPLOAD_ENABLED 0
+#endif
+
+constexpr char ACCEL_CURVE_UPLOAD_COMMAND = 'A';
+constexpr uint32_t ACCEL_CURVE_UPLOAD_TIMEOUT_MS = 2000;
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+
+// BLE Advertising Schedule Configuration
+// Intervals in 0.625 ms units (Bluetooth Core spec)
+constexpr uint32_t BLE_ADV_DIRECTED_MS = 1280;         // High-duty directed advertising limit
+constexpr uint16_t BLE_ADV_FAST_MIN_INTERVAL = 32;     // 20 ms
+constexpr uint16_t BLE_ADV_FAST_MAX_INTERVAL = 48;     // 30 ms
+constexpr uint32_t BLE_ADV_FAST_MS = 30000;            // Fast undirected window before slowing down
+constexpr uint16_t BLE_ADV_SLOW_MIN_INTERVAL = 1636;   // 1022.5 ms
+constexpr uint16_t BLE_ADV_SLOW_MAX_INTERVAL = 2056;   // 1285 ms
+constexpr uint32_t BLE_ADV_PAIRING_FAST_MS = 60000;    // Pairing stays fast this long, then slow
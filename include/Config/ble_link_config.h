@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stdint.h>
+
+// BLE Link (connection parameter) Configuration
+// Intervals in 1.25 ms units, supervision timeout in 10 ms units (Bluetooth Core spec)
+constexpr uint16_t BLE_LINK_ACTIVE_MIN_INTERVAL = 6;    // 7.5 ms
+constexpr uint16_t BLE_LINK_ACTIVE_MAX_INTERVAL = 12;   // 15 ms
+constexpr uint16_t BLE_LINK_ACTIVE_LATENCY = 0;         // Answer every connection event while in use
+constexpr uint16_t BLE_LINK_ACTIVE_TIMEOUT = 200;       // 2 s
+
+constexpr uint16_t BLE_LINK_IDLE_MIN_INTERVAL = 80;     // 100 ms
+constexpr uint16_t BLE_LINK_IDLE_MAX_INTERVAL = 120;    // 150 ms
+constexpr uint16_t BLE_LINK_IDLE_LATENCY = 4;           // Skip up to 4 events when there is nothing to send
+constexpr uint16_t BLE_LINK_IDLE_TIMEOUT = 600;         // 6 s, > 2 * (1 + latency) * max interval
+
+constexpr uint32_t BLE_LINK_CONNECT_SETTLE_MS = 2000;   // Hosts reject updates requested right after connect
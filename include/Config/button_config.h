@@ -7,14 +7,15 @@ struct ButtonConfig {
     uint8_t pin;
     const char* label;
     bool activeLow;
+    bool longPress;  // true: long press fires at threshold; false: fires on press-down with hold-to-repeat
 };
 
 inline constexpr ButtonConfig BUTTONS[] = {
-    {3, "Top Left", true},
-    {4, "Top Right", true},
-    {10, "Bottom Left", true},
-    {20, "Bottom Right", true},
-    {5, "Macro", true}            // GPIO 5 - Macro toggle button
+    {3, "Top Left", true, false},
+    {4, "Top Right", true, false},
+    {10, "Bottom Left", true, false},
+    {20, "Bottom Right", true, false},
+    {5, "Macro", true, true}      // GPIO 5 - Macro toggle button
 };
 
 inline constexpr size_t BUTTON_COUNT = sizeof(BUTTONS) / sizeof(BUTTONS[0]);
@@ -24,5 +25,9 @@ inline constexpr uint32_t DEBOUNCE_MS = 50;
 inline constexpr uint32_t BUTTON_SHORT_PRESS_MIN_MS = 50;   // Minimum for valid short press
 inline constexpr uint32_t BUTTON_LONG_PRESS_MIN_MS = 1000;  // Threshold for long press
 
+// Hold-to-repeat cadence for early-fire buttons
+inline constexpr uint16_t BUTTON_REPEAT_DELAY_MS = 400;     // Hold time before first repeat
+inline constexpr uint16_t BUTTON_REPEAT_INTERVAL_MS = 120;  // Time between repeats
+
 // Macro button index in BUTTONS[] array
 inline constexpr uint8_t MACRO_BUTTON_INDEX = 4;
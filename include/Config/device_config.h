@@ -12,6 +12,11 @@ constexpr const char* NVS_NAMESPACE = "knobkoky";  // lowercase, derived from DE
 #define KNOB_BUTTON_SHORT_PRESS_MS 50
 #define KNOB_BUTTON_LONG_PRESS_MS 1000
 
-// Wheel Configuration
+// Persisted configuration: one versioned, CRC-checked blob (see src/Config/ConfigRecord.h)
+constexpr const char* KEY_CONFIG_RECORD = "cfg";
+
+// Legacy per-key layout, read once to migrate into KEY_CONFIG_RECORD and then removed
+// (also "btnN.action", "macro.N", "accel.N", "mprog.N")
 constexpr const char* KEY_WHEEL_MODE = "wheel.mode";
 constexpr const char* KEY_WHEEL_DIR = "wheel.dir";
+constexpr const char* KEY_ZOOM_STRATEGY = "zoom.strat";
@@ -10,3 +10,21 @@ constexpr uint8_t OLED_I2C_ADDRESS = 0x3C;
 constexpr uint8_t OLED_SDA_PIN = 6;
 constexpr uint8_t OLED_SCL_PIN = 7;
 constexpr uint32_t OLED_I2C_FREQUENCY = 400000;  // 400kHz
+
+// SSD1306 RAM layout: 8-pixel-high pages, one byte per column per page
+constexpr uint8_t OLED_PAGE_COUNT = OLED_SCREEN_HEIGHT / 8;
+constexpr uint16_t OLED_FRAME_BYTES = OLED_SCREEN_WIDTH * OLED_PAGE_COUNT;
+
+// Partial flush: only changed column spans of each page are sent
+constexpr uint8_t OLED_SPAN_OVERHEAD_BYTES = 10;  // Address window (addr + ctrl + 6 cmd) + data header (addr + ctrl)
+constexpr uint8_t OLED_MAX_SPANS_PER_PAGE = 4;    // Further changes in a page merge into its last span
+constexpr uint8_t OLED_I2C_CHUNK_BYTES = 64;      // Data bytes per I2C transaction (Wire buffer is 128)
+
+// Frame flush task: streams the front buffer while the next frame renders
+constexpr uint32_t OLED_FLUSH_TASK_STACK = 2048;
+constexpr uint8_t OLED_FLUSH_TASK_PRIORITY = 2;   // Above DisplayTask: a submitted frame starts on the bus at once
+constexpr uint32_t OLED_FLUSH_WAIT_MS = 50;       // Re-check interval while waiting for the previous frame
+
+// DisplayTask request handling
+constexpr uint32_t DISPLAY_MIN_FRAME_INTERVAL_MS = 33;  // Frame cap (~30 fps); requests arriving meanwhile collapse
+constexpr uint8_t DISPLAY_PENDING_REQUESTS = 10;        // Drained requests awaiting render (matches the queue)
@@ -1,3 +1,5 @@
+#pragma once
+
 #define ENCODER_PIN_A 1
 #define ENCODER_PIN_B 0
 #define ENCODER_PIN_BUTTON 2
@@ -5,5 +7,10 @@
 #define ENCODER_STEPS 4
 
 // Encoder button press timing thresholds
-#define ENCODER_SHORT_PRESS_MIN_MS 50    // Minimum for valid short press
-#define ENCODER_LONG_PRESS_MIN_MS 1000   // Threshold for long press
+#define ENCODER_DEBOUNCE_MS 50           // Contact must be quiet this long to count
+#define ENCODER_LONG_PRESS_MIN_MS 1000   // Long press fires at this hold time
+
+// ISR -> task delta ring (power of two)
+#define ENCODER_DELTA_RING_CAPACITY 32
+// Coalescing EncoderEventDispatcher -> EncoderEventHandler queue depth
+#define ENCODER_EVENT_QUEUE_CAPACITY 10
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <stdint.h>
+
+// Event Bus Configuration
+constexpr uint8_t EVENT_BUS_MAX_SUBSCRIBERS = 6;         // Per topic (listeners + queues)
+constexpr uint8_t EVENT_BUS_QUEUE_DEPTH = 10;            // Default depth of a subscriber queue
+constexpr uint32_t EVENT_BUS_URGENT_WAIT_MS = 10;        // URGENT may block this long for a free slot
+constexpr uint8_t EVENT_BUS_BACKGROUND_MIN_FREE = 3;     // BACKGROUND is shed when fewer slots are free
+constexpr uint32_t EVENT_BUS_STATS_INTERVAL_MS = 60000;  // Telemetry dump period
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+
+// HID Output Stage Configuration
+constexpr uint8_t HID_OUTPUT_QUEUE_CAPACITY = 16;         // Pending intents between handlers and the BLE link
+constexpr uint16_t HID_OUTPUT_REPORT_INTERVAL_MS = 15;    // Pacing between reports, default connection interval
+constexpr uint16_t HID_OUTPUT_MIN_REPORT_INTERVAL_MS = 8; // Floor for pacing (BLE minimum interval is 7.5 ms)
+constexpr uint32_t HID_OUTPUT_TASK_STACK = 3072;
+constexpr uint8_t HID_OUTPUT_TASK_PRIORITY = 2;           // Above input handlers so the ring drains promptly
+
+// Consumer page AC Zoom In/Out (0x022D/0x022E) are not in the stock BleKeyboard
+// consumer descriptor. Set to 1 only with a library build that defines
+// KEY_MEDIA_AC_ZOOM_IN / KEY_MEDIA_AC_ZOOM_OUT. Otherwise the Zoom Style menu hides
+// AC Zoom, and an AC_ZOOM value already stored falls back to CTRL_WHEEL.
+#ifndef HID_AC_ZOOM_AVAILABLE
+#define HID_AC_ZOOM_AVAILABLE 0
+#endif
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stdint.h>
+
+// Input Record/Replay Configuration
+// Enable with build flag -D INPUT_RECORD_ENABLED=1 (adds the RAM ring and serial commands)
+#ifndef INPUT_RECORD_ENABLED
+#define INPUT_RECORD_ENABLED 0
+#endif
+
+constexpr uint16_t INPUT_RECORD_CAPACITY = 1024;      // Records kept in RAM (8 bytes each)
+constexpr char INPUT_RECORD_TOGGLE_COMMAND = 'R';     // Serial byte: start/stop recording
+constexpr char INPUT_RECORD_DUMP_COMMAND = 'd';       // Serial byte: binary dump of the recording
+constexpr char INPUT_RECORD_REPLAY_COMMAND = 'p';     // Serial byte: replay the recording
+constexpr uint32_t INPUT_REPLAY_TASK_STACK = 3072;
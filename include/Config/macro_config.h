@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdint.h>
+
+// Macro Program Configuration
+constexpr uint16_t MACRO_PROGRAM_MAX_BYTES = 256;      // Largest program blob per input (NVS key "mprog.N")
+constexpr uint8_t MACRO_PROGRAM_VERSION = 1;           // First byte of every program blob
+constexpr uint8_t MACRO_VM_MAX_LOOP_DEPTH = 4;         // Nested REPEAT levels
+constexpr uint8_t MACRO_VM_REQUEST_QUEUE_DEPTH = 2;    // Programs waiting while one runs
+constexpr uint8_t MACRO_VM_HID_HEADROOM = 4;           // HidOutputTask slots left free for live input
+constexpr uint16_t MACRO_VM_BACKPRESSURE_WAIT_MS = 10; // Re-check interval while the HID queue is full
+constexpr uint32_t MACRO_VM_TASK_STACK = 3072;
+constexpr uint8_t MACRO_VM_TASK_PRIORITY = 1;          // Below HidOutputTask, same as input handlers
+
+// Serial upload: 'M' | slot u8 | length u16 LE | blob (see tools/macro_asm.py)
+// Enable with build flag -D MACRO_UPLOAD_ENABLED=1 (otherwise a stray 'M' on the console is ignored)
+#ifndef MACRO_UPLOAD_ENABLED
+#define MACRO_UPLOAD_ENABLED 0
+#endif
+
+constexpr char MACRO_UPLOAD_COMMAND = 'M';
+constexpr uint32_t MACRO_UPLOAD_TIMEOUT_MS = 2000;
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdint.h>
+
+// Config write-back: settings change in RAM at once, the record is written later
+constexpr uint32_t CONFIG_WRITEBACK_QUIET_MS = 3000;       // Commit once settings stop changing for this long
+constexpr uint32_t CONFIG_WRITEBACK_MAX_DELAY_MS = 30000;  // Commit anyway if changes keep coming
+
+// Serial 'f': commit pending changes now
+// Enable with build flag -D CONFIG_FLUSH_ENABLED=1 (otherwise a stray 'f' on the console cannot cost a flash write)
+#ifndef CONFIG_FLUSH_ENABLED
+#define CONFIG_FLUSH_ENABLED 0
+#endif
+
+constexpr char CONFIG_FLUSH_COMMAND = 'f';
+
+// Flash wear projection (default "nvs" partition; see partition table)
+constexpr uint32_t NVS_PARTITION_BYTES = 0x5000;
+constexpr uint32_t NVS_PAGE_BYTES = 4096;
+constexpr uint32_t NVS_ENTRY_BYTES = 32;
+constexpr uint32_t NVS_ENTRIES_PER_PAGE = 126;             // After page header and entry state bitmap
+constexpr uint32_t NVS_FLASH_ENDURANCE_CYCLES = 100000;    // Erase cycles per sector
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <stdint.h>
+
+// Latency Trace Configuration
+// Enable with build flag -D LATENCY_TRACE_ENABLED=1; when 0 every TRACE_* macro compiles away
+#ifndef LATENCY_TRACE_ENABLED
+#define LATENCY_TRACE_ENABLED 0
+#endif
+
+constexpr uint16_t LATENCY_TRACE_CAPACITY = 512;  // Records kept in RAM (16 bytes each), oldest overwritten
+constexpr char LATENCY_TRACE_DUMP_COMMAND = 't';  // Serial byte that triggers a binary dump
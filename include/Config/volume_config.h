@@ -0,0 +1,9 @@
+#pragma once
+
+#include <stdint.h>
+
+// Volume Mode Configuration
+constexpr int32_t VOLUME_STEPS_PER_DETENT_Q8 = 256;  // Host volume steps per (accelerated) detent, Q8
+constexpr uint8_t VOLUME_MAX_BURST_STEPS = 16;       // Cap on steps emitted for one rotate event
+constexpr uint8_t VOLUME_STEP_INTERVAL_MS = 20;      // Pacing between steps of a burst (hosts drop faster key repeats)
+constexpr bool VOLUME_CANCEL_ON_REVERSAL = true;     // Reversing direction discards steps still queued
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+enum class AccelerationCurveType : uint8_t {
+    NONE,    ///< Pass-through, every detent is one unit
+    LINEAR,  ///< Gain grows linearly with velocity above a threshold
+    POWER,   ///< Gain grows with an integer power of velocity above a threshold
+    TABLE    ///< Piecewise-linear velocity -> gain table
+};
+
+constexpr uint8_t AccelerationCurveType_MAX = static_cast<uint8_t>(AccelerationCurveType::TABLE);
+
+inline const char* accelerationCurveTypeToString(AccelerationCurveType t) {
+    switch (t) {
+        case AccelerationCurveType::NONE:   return "NONE";
+        case AccelerationCurveType::LINEAR: return "LINEAR";
+        case AccelerationCurveType::POWER:  return "POWER";
+        case AccelerationCurveType::TABLE:  return "TABLE";
+        default:                            return "UNKNOWN";
+    }
+}
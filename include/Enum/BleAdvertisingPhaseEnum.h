@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Stage of the advertising schedule
+ */
+enum class BleAdvertisingPhase : uint8_t {
+    OFF = 0,       ///< Not advertising (connected, or stopped by the user)
+    DIRECTED = 1,  ///< Directed to the last bonded peer
+    FAST = 2,      ///< Undirected, short interval
+    SLOW = 3       ///< Undirected, long interval (power saving)
+};
+
+inline const char* bleAdvertisingPhaseToString(BleAdvertisingPhase phase) {
+    switch (phase) {
+        case BleAdvertisingPhase::OFF:       return "OFF";
+        case BleAdvertisingPhase::DIRECTED:  return "DIRECTED";
+        case BleAdvertisingPhase::FAST:      return "FAST";
+        case BleAdvertisingPhase::SLOW:      return "SLOW";
+        default:                             return "UNKNOWN";
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Connection parameter set requested from the host
+ */
+enum class BleLinkProfile : uint8_t {
+    ACTIVE = 0,  ///< Short interval, no slave latency (user interacting)
+    IDLE = 1     ///< Long interval with slave latency (saves power)
+};
+
+inline const char* bleLinkProfileToString(BleLinkProfile profile) {
+    switch (profile) {
+        case BleLinkProfile::ACTIVE:  return "ACTIVE";
+        case BleLinkProfile::IDLE:    return "IDLE";
+        default:                      return "UNKNOWN";
+    }
+}
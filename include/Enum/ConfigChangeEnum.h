@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Which part of the configuration snapshot a write touched
+ */
+enum class ConfigChange : uint8_t {
+    WHEEL_MODE,
+    WHEEL_DIRECTION,
+    ZOOM_STRATEGY,
+    BUTTON_ACTION,
+    MACRO,
+    ACCELERATION,
+    ALL  ///< Snapshot reloaded or cleared (boot, factory reset)
+};
+
+inline const char* configChangeToString(ConfigChange c) {
+    switch (c) {
+        case ConfigChange::WHEEL_MODE:      return "WHEEL_MODE";
+        case ConfigChange::WHEEL_DIRECTION: return "WHEEL_DIRECTION";
+        case ConfigChange::ZOOM_STRATEGY:   return "ZOOM_STRATEGY";
+        case ConfigChange::BUTTON_ACTION:   return "BUTTON_ACTION";
+        case ConfigChange::MACRO:           return "MACRO";
+        case ConfigChange::ACCELERATION:    return "ACCELERATION";
+        case ConfigChange::ALL:             return "ALL";
+        default:                            return "UNKNOWN";
+    }
+}
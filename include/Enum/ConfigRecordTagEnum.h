@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Entry tags of the persisted config record (see ConfigRecord.h)
+ *
+ * Values are stored in flash: never renumber, only append. Readers skip
+ * tags they do not know, so adding one needs no schema version bump.
+ */
+enum class ConfigRecordTag : uint8_t {
+    WHEEL_MODE = 1,       ///< u8 WheelMode
+    WHEEL_DIRECTION = 2,  ///< u8 WheelDirection
+    ZOOM_STRATEGY = 3,    ///< u8 ZoomStrategy
+    BUTTON_ACTIONS = 4,   ///< u8 ButtonActionId per button
+    MACROS = 5,           ///< u16 LE packed MacroDefinition per macro input
+    ACCEL_CURVE = 6,      ///< u8 WheelMode | AccelerationCurve bytes
+    MACRO_PROGRAM = 7     ///< u8 MacroInput | program blob
+};
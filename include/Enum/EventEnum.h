@@ -9,7 +9,10 @@ namespace EventEnum {
 
     enum class ButtonEventTypes {
         SHORT_PRESS,
-        LONG_PRESS
+        LONG_PRESS,
+        DOUBLE_PRESS,
+        TRIPLE_PRESS,
+        REPEAT
     };
 
     enum class EncoderModeEventTypes {
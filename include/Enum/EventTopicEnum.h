@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Topics published on the EventBus
+ */
+enum class EventTopic : uint8_t {
+    ENCODER_INPUT,  ///< Rotation and clicks from the encoder (EncoderInputEvent)
+    BUTTON_INPUT,   ///< Recognized button gestures (ButtonEvent)
+    APP,            ///< Encoder mode requests (AppEvent)
+    MENU,           ///< Menu navigation (MenuEvent)
+    STATE_CHANGED   ///< HardwareState changed, status screen is stale (StateChangedEvent)
+};
+
+constexpr uint8_t EVENT_TOPIC_COUNT = static_cast<uint8_t>(EventTopic::STATE_CHANGED) + 1;
+
+/**
+ * @brief Component that published an event
+ */
+enum class EventSource : uint8_t {
+    ENCODER,
+    BUTTON,
+    ENCODER_MODE,
+    MENU,
+    BLE,
+    SYSTEM,
+    REPLAY  ///< Re-published by InputRecorder from a recorded session
+};
+
+constexpr uint8_t EVENT_SOURCE_COUNT = static_cast<uint8_t>(EventSource::REPLAY) + 1;
+
+/**
+ * @brief Delivery class of an event when a subscriber queue is congested
+ *
+ * URGENT may briefly block for a free slot instead of being dropped, NORMAL
+ * is appended without blocking, BACKGROUND is shed before the queue fills.
+ * All classes keep publish order: input events must not overtake each other.
+ * Only publish URGENT from a task that may block, never from the timer
+ * service task or an ISR. (Not HIGH/LOW: those are Arduino macros.)
+ */
+enum class EventPriority : uint8_t {
+    URGENT,
+    NORMAL,
+    BACKGROUND
+};
+
+/**
+ * @brief What part of HardwareState a STATE_CHANGED event refers to
+ */
+enum class StateChange : uint8_t {
+    WHEEL_MODE,
+    WHEEL_DIRECTION,
+    BLE,
+    MACRO_MODE,
+    REFRESH  ///< Periodic redraw (animation), nothing changed
+};
+
+inline const char* eventTopicToString(EventTopic t) {
+    switch (t) {
+        case EventTopic::ENCODER_INPUT: return "ENCODER_INPUT";
+        case EventTopic::BUTTON_INPUT:  return "BUTTON_INPUT";
+        case EventTopic::APP:           return "APP";
+        case EventTopic::MENU:          return "MENU";
+        case EventTopic::STATE_CHANGED: return "STATE_CHANGED";
+        default:                        return "UNKNOWN";
+    }
+}
+
+inline const char* eventSourceToString(EventSource s) {
+    switch (s) {
+        case EventSource::ENCODER:      return "ENCODER";
+        case EventSource::BUTTON:       return "BUTTON";
+        case EventSource::ENCODER_MODE: return "ENCODER_MODE";
+        case EventSource::MENU:         return "MENU";
+        case EventSource::BLE:          return "BLE";
+        case EventSource::SYSTEM:       return "SYSTEM";
+        case EventSource::REPLAY:       return "REPLAY";
+        default:                        return "UNKNOWN";
+    }
+}
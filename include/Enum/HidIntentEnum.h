@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Kind of report a HidIntent turns into on the BLE link
+ */
+enum class HidIntentType : uint8_t {
+    WHEEL,         ///< Mouse wheel report (vertical and/or horizontal)
+    CONSUMER_KEY,  ///< Consumer control (media key) press/release
+    KEY_CHORD,     ///< Keyboard report (modifiers + up to six keys) press/release
+    KEY_STATE      ///< Keyboard report sent as is, keys stay held until the next one
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Macro program instructions
+ *
+ * Operands follow the opcode byte. Keys use the BleKeyboard::press()
+ * encoding (ASCII, KEY_LEFT_CTRL..KEY_RIGHT_GUI, KEY_* constants).
+ */
+enum class MacroOpcode : uint8_t {
+    END = 0x00,        ///< Stop (also implied by the end of the blob)
+    KEY_DOWN = 0x01,   ///< key u8: add to the held report
+    KEY_UP = 0x02,     ///< key u8: remove from the held report
+    MODIFIERS = 0x03,  ///< mask u8: replace the held modifier byte
+    CONSUMER = 0x04,   ///< MediaKeyReport u8[2]: press/release a media key
+    WHEEL = 0x05,      ///< wheel i8, hWheel i8: one mouse wheel report
+    DELAY = 0x06,      ///< ms u16 LE: wait once queued reports have gone out
+    REPEAT = 0x07,     ///< count u8, bodyLength u8: run the following body count times
+    TYPE = 0x08        ///< length u8, ASCII u8[length]: tap each character
+};
+
+constexpr uint8_t MacroOpcode_MAX = static_cast<uint8_t>(MacroOpcode::TYPE);
+
+/**
+ * @brief Fixed operand bytes after the opcode (TYPE adds its text length)
+ */
+inline uint8_t macroOperandLength(MacroOpcode op) {
+    switch (op) {
+        case MacroOpcode::KEY_DOWN:
+        case MacroOpcode::KEY_UP:
+        case MacroOpcode::MODIFIERS:
+        case MacroOpcode::TYPE:
+            return 1;
+        case MacroOpcode::CONSUMER:
+        case MacroOpcode::WHEEL:
+        case MacroOpcode::DELAY:
+        case MacroOpcode::REPEAT:
+            return 2;
+        case MacroOpcode::END:
+        default:
+            return 0;
+    }
+}
+
+inline const char* macroOpcodeToString(MacroOpcode op) {
+    switch (op) {
+        case MacroOpcode::END:       return "END";
+        case MacroOpcode::KEY_DOWN:  return "KEY_DOWN";
+        case MacroOpcode::KEY_UP:    return "KEY_UP";
+        case MacroOpcode::MODIFIERS: return "MODIFIERS";
+        case MacroOpcode::CONSUMER:  return "CONSUMER";
+        case MacroOpcode::WHEEL:     return "WHEEL";
+        case MacroOpcode::DELAY:     return "DELAY";
+        case MacroOpcode::REPEAT:    return "REPEAT";
+        case MacroOpcode::TYPE:      return "TYPE";
+        default:                     return "UNKNOWN";
+    }
+}
@@ -4,8 +4,9 @@
 
 enum class PowerState : uint8_t {
     ACTIVE = 0,
-    WARNING = 1,
-    SLEEP = 2
+    IDLE = 1,     // No input for POWER_IDLE_THRESHOLD_MS; display unchanged, BLE link relaxed
+    WARNING = 2,
+    SLEEP = 3
 };
 
 constexpr uint8_t PowerState_MAX = static_cast<uint8_t>(PowerState::SLEEP);
@@ -14,6 +15,7 @@ constexpr PowerState DEFAULT_POWER_STATE = PowerState::ACTIVE;
 inline const char* powerStateToString(PowerState state) {
     switch (state) {
         case PowerState::ACTIVE:    return "ACTIVE";
+        case PowerState::IDLE:      return "IDLE";
         case PowerState::WARNING:   return "WARNING";
         case PowerState::SLEEP:     return "SLEEP";
         default:                    return "UNKNOWN";
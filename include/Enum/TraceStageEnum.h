@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Pipeline stage at which a latency trace record was taken
+ *
+ * Values are part of the binary dump format (tools/latency_trace.py):
+ * append only, never renumber.
+ */
+enum class TraceStage : uint8_t {
+    DRIVER = 0,          ///< Driver task delivered the edge/gesture to its callback
+    DISPATCH = 1,        ///< Event published on the EventBus
+    HANDLER = 2,         ///< Handler task dequeued the event
+    HID_SEND = 3,        ///< BleKeyboard report call returned
+    DISPLAY_SUBMIT = 4   ///< DisplayRequest queued for DisplayTask
+};
+
+inline const char* traceStageToString(TraceStage s) {
+    switch (s) {
+        case TraceStage::DRIVER:         return "DRIVER";
+        case TraceStage::DISPATCH:       return "DISPATCH";
+        case TraceStage::HANDLER:        return "HANDLER";
+        case TraceStage::HID_SEND:       return "HID_SEND";
+        case TraceStage::DISPLAY_SUBMIT: return "DISPLAY_SUBMIT";
+        default:                         return "UNKNOWN";
+    }
+}
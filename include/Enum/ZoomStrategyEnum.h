@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief How zoom mode turns rotation into HID reports
+ *
+ * CTRL_KEYS:  Ctrl held, Num+/Num- pressed and released per step (widest support)
+ * CTRL_WHEEL: Ctrl held around one aggregated wheel report (browsers, editors, most OSes)
+ * AC_ZOOM:    Consumer page AC Zoom In/Out usages (needs HID_AC_ZOOM_AVAILABLE)
+ */
+enum class ZoomStrategy : uint8_t {
+    CTRL_KEYS = 0,
+    CTRL_WHEEL = 1,
+    AC_ZOOM = 2
+};
+
+constexpr uint8_t ZoomStrategy_MAX = static_cast<uint8_t>(ZoomStrategy::AC_ZOOM);
+constexpr ZoomStrategy DEFAULT_ZOOM_STRATEGY = ZoomStrategy::CTRL_KEYS;
+
+inline const char* zoomStrategyToString(ZoomStrategy s) {
+    switch (s) {
+        case ZoomStrategy::CTRL_KEYS:   return "CTRL_KEYS";
+        case ZoomStrategy::CTRL_WHEEL:  return "CTRL_WHEEL";
+        case ZoomStrategy::AC_ZOOM:     return "AC_ZOOM";
+        default:                        return "UNKNOWN";
+    }
+}
+
+inline const char* zoomStrategyToDisplayString(ZoomStrategy s) {
+    switch (s) {
+        case ZoomStrategy::CTRL_KEYS:   return "Ctrl +/-";
+        case ZoomStrategy::CTRL_WHEEL:  return "Ctrl+Wheel";
+        case ZoomStrategy::AC_ZOOM:     return "AC Zoom";
+        default:                        return "Unknown";
+    }
+}
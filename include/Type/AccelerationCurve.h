@@ -0,0 +1,55 @@
+#pragma once
+
+/**
+ * @file AccelerationCurve.h
+ * @brief Velocity -> gain curve for encoder acceleration
+ *
+ * All values are fixed-point so the curve can be evaluated without an FPU
+ * and stored in NVS as a plain blob. Velocity is in detents per second,
+ * gain is Q8 (256 = 1.0x).
+ */
+
+#include <stdint.h>
+#include "Enum/AccelerationCurveEnum.h"
+
+constexpr uint8_t ACCEL_TABLE_MAX_POINTS = 8;
+constexpr uint16_t ACCEL_GAIN_ONE_Q8 = 256;
+
+struct AccelerationCurvePoint {
+    uint16_t velocityDps;  ///< Velocity in detents per second
+    uint16_t gainQ8;       ///< Gain at this velocity (Q8)
+};
+
+/**
+ * @struct AccelerationCurve
+ * @brief Curve parameters, interpretation depends on type
+ *
+ * - LINEAR: gain = 1 + slopeQ8/256 * (v - thresholdDps)
+ * - POWER:  gain = 1 + ((v - thresholdDps) / scaleDps) ^ exponent
+ * - TABLE:  linear interpolation between points (sorted by velocity)
+ *
+ * Every curve is clamped to maxGainQ8 (TABLE uses its own points).
+ */
+struct AccelerationCurve {
+    AccelerationCurveType type;
+    uint8_t exponent;       ///< POWER: integer exponent (1-4)
+    uint8_t pointCount;     ///< TABLE: number of valid points
+    uint8_t reserved;
+    uint16_t thresholdDps;  ///< LINEAR/POWER: velocity below which gain is exactly 1.0
+    uint16_t scaleDps;      ///< POWER: velocity span that doubles the gain
+    uint16_t slopeQ8;       ///< LINEAR: gain increase per detent/s (Q8)
+    uint16_t maxGainQ8;     ///< LINEAR/POWER: gain ceiling (Q8)
+    AccelerationCurvePoint points[ACCEL_TABLE_MAX_POINTS];
+
+    static AccelerationCurve none() {
+        return AccelerationCurve{ AccelerationCurveType::NONE, 0, 0, 0, 0, 0, 0, ACCEL_GAIN_ONE_Q8, {} };
+    }
+
+    static AccelerationCurve linear(uint16_t thresholdDps, uint16_t slopeQ8, uint16_t maxGainQ8) {
+        return AccelerationCurve{ AccelerationCurveType::LINEAR, 0, 0, 0, thresholdDps, 0, slopeQ8, maxGainQ8, {} };
+    }
+
+    static AccelerationCurve power(uint16_t thresholdDps, uint16_t scaleDps, uint8_t exponent, uint16_t maxGainQ8) {
+        return AccelerationCurve{ AccelerationCurveType::POWER, exponent, 0, 0, thresholdDps, scaleDps, 0, maxGainQ8, {} };
+    }
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Connection parameters in effect on the BLE link
+ *
+ * Units follow the Bluetooth Core spec: interval 1.25 ms, timeout 10 ms.
+ * All zero while disconnected or when the stack cannot report them.
+ */
+struct BleLinkParams {
+    uint16_t interval;  ///< Connection interval (1.25 ms units)
+    uint16_t latency;   ///< Slave (peripheral) latency in connection events
+    uint16_t timeout;   ///< Supervision timeout (10 ms units)
+
+    uint32_t intervalUs() const { return static_cast<uint32_t>(interval) * 1250; }
+
+    bool operator==(const BleLinkParams& other) const {
+        return interval == other.interval && latency == other.latency && timeout == other.timeout;
+    }
+    bool operator!=(const BleLinkParams& other) const { return !(*this == other); }
+};
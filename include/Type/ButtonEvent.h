@@ -6,4 +6,5 @@
 struct ButtonEvent {
     EventEnum::ButtonEventTypes type;
     uint8_t buttonIndex = 0;
+    uint32_t timestampMs = 0;  ///< When the gesture was recognized
 };
@@ -0,0 +1,26 @@
+#pragma once
+
+/**
+ * @file ConfigSnapshot.h
+ * @brief Complete RAM copy of the persisted configuration
+ *
+ * ConfigManager loads this once from NVS at boot and keeps it current on
+ * every write, so readers on the input path never touch flash.
+ */
+
+#include <stdint.h>
+#include "Config/button_config.h"
+#include "Enum/MacroInputEnum.h"
+#include "Enum/WheelModeEnum.h"
+#include "Enum/WheelDirection.h"
+#include "Enum/ZoomStrategyEnum.h"
+#include "Type/AccelerationCurve.h"
+
+struct ConfigSnapshot {
+    WheelMode wheelMode;
+    WheelDirection wheelDirection;
+    ZoomStrategy zoomStrategy;
+    uint8_t buttonActions[BUTTON_COUNT];                         ///< ButtonActionId per button
+    uint16_t macros[static_cast<uint8_t>(MacroInput::COUNT)];    ///< Packed MacroDefinition per input
+    AccelerationCurve accelerationCurves[WheelMode_MAX + 1];     ///< Curve per wheel mode
+};
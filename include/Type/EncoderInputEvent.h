@@ -9,4 +9,5 @@ struct EncoderInputEvent {
     EventEnum::EncoderInputEventTypes type;
 
     int32_t delta = 0;
+    uint64_t timestampUs = 0;  ///< Edge time from the encoder ISR (ROTATE) or dispatch time (clicks)
 };
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include <type_traits>
+#include "Enum/EventTopicEnum.h"
+#include "Type/EncoderInputEvent.h"
+#include "Type/ButtonEvent.h"
+#include "Type/AppEvent.h"
+#include "Type/MenuEvent.h"
+
+struct StateChangedEvent {
+    StateChange what;
+};
+
+/**
+ * @brief Fixed-size event passed through the EventBus
+ *
+ * Copied by value into subscriber queues, so it must stay trivially copyable.
+ * Only the payload member matching `topic` is valid.
+ */
+struct EventEnvelope {
+    EventTopic topic;
+    EventSource source;
+    EventPriority priority;
+    uint32_t timestampMs;  ///< millis() at publish
+    uint64_t originUs;     ///< esp_timer time of the causing input (latency trace), 0 if unknown
+
+    union Payload {
+        EncoderInputEvent encoder;
+        ButtonEvent button;
+        AppEvent app;
+        MenuEvent menu;
+        StateChangedEvent state;
+
+        Payload() : state{} {}
+    } payload;
+};
+
+static_assert(std::is_trivially_copyable<EventEnvelope>::value, "EventEnvelope is copied through FreeRTOS queues");
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+#include <type_traits>
+#include "Enum/HidIntentEnum.h"
+
+/**
+ * @brief A pending HID report queued by an input handler
+ *
+ * Handlers describe what should reach the host; HidOutputTask owns the
+ * BleKeyboard calls. Kept trivially copyable so it can live in a ring.
+ */
+struct HidIntent {
+    HidIntentType type;
+    uint8_t repeat;        ///< CONSUMER_KEY / KEY_CHORD: press/release cycles to send
+    int8_t wheel;          ///< WHEEL: vertical ticks
+    int8_t hWheel;         ///< WHEEL: horizontal ticks
+    uint8_t mediaKey[2];   ///< CONSUMER_KEY: MediaKeyReport bytes
+    uint8_t modifiers;     ///< KEY_CHORD / KEY_STATE / WHEEL: modifier bitmask (bit n = keycode 0x80 + n)
+    uint8_t keys[6];       ///< KEY_CHORD / KEY_STATE: HID usages of the keyboard report (0 = empty slot)
+    uint8_t cycleIntervalMs; ///< Minimum spacing between repeat cycles (0 = report interval)
+    uint64_t originUs;     ///< Latency trace origin of the input that caused it (0 if none)
+};
+
+static_assert(std::is_trivially_copyable<HidIntent>::value, "HidIntent must be trivially copyable");
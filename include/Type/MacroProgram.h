@@ -0,0 +1,25 @@
+#pragma once
+
+/**
+ * @file MacroProgram.h
+ * @brief Variable-length macro bytecode blob
+ *
+ * Blob layout: version u8 (MACRO_PROGRAM_VERSION) | instructions...
+ * See Enum/MacroOpcodeEnum.h for the instruction set and
+ * tools/macro_asm.py for the host-side assembler.
+ */
+
+#include <stdint.h>
+#include <type_traits>
+#include "Config/macro_config.h"
+
+struct MacroProgram {
+    uint16_t length;                         ///< Bytes used in code (0 = no program)
+    uint8_t code[MACRO_PROGRAM_MAX_BYTES];   ///< Blob as stored in NVS
+
+    bool isEmpty() const {
+        return length == 0;
+    }
+};
+
+static_assert(std::is_trivially_copyable<MacroProgram>::value, "MacroProgram is copied through a FreeRTOS queue");
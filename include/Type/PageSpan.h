@@ -0,0 +1,16 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Column range of one SSD1306 page (8 pixel rows) to send to the panel
+ */
+struct PageSpan {
+    uint8_t page;         ///< Page index (row / 8)
+    uint8_t firstColumn;  ///< First column, inclusive
+    uint8_t lastColumn;   ///< Last column, inclusive
+
+    uint8_t width() const {
+        return lastColumn - firstColumn + 1;
+    }
+};
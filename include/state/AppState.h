@@ -4,19 +4,22 @@
 #include "freertos/queue.h"
 #include "freertos/timers.h"
 
+class EncoderEventQueue;
+class EventBus;
+class BleAdvertisingScheduler;
+
 /**
  * @brief Application-level state
  *
- * Contains software/application state (FreeRTOS queues, timers, event handlers, etc.).
+ * Contains software/application state (event bus, queues, timers, etc.).
  * Hardware state is now tracked separately in the global hardwareState instance.
  */
 struct AppState {
-    QueueHandle_t encoderInputEventQueue = nullptr;
-    QueueHandle_t buttonEventQueue = nullptr;
-    QueueHandle_t appEventQueue = nullptr;
-    QueueHandle_t menuEventQueue = nullptr;
+    EncoderEventQueue* encoderInputEventQueue = nullptr;  ///< Coalescing rotate/click queue
+    EventBus* eventBus = nullptr;  ///< Button/app/menu/state events (handlers own subscriber queues)
     QueueHandle_t displayRequestQueue = nullptr;
     TimerHandle_t btFlashTimer = nullptr;  ///< BT icon flash animation timer
+    BleAdvertisingScheduler* advertisingScheduler = nullptr;  ///< Owns advertising start/stop after boot
 };
 
 extern AppState appState;
@@ -5,6 +5,7 @@
 #include "freertos/timers.h"
 #include "Type/BleStateType.h"
 #include "Type/EncoderWheelStateType.h"
+#include "state/Seqlock.h"
 
 /**
  * @brief Hardware state for normal mode display
@@ -17,7 +18,9 @@
  * - Macro mode state (active/inactive)
  *
  * This structure is independent of AppState and serves as the single
- * source of truth for hardware state.
+ * source of truth for hardware state. It lives in a HardwareStateStore:
+ * writers change fields with update(), readers (the renderer at draw
+ * time, input handlers) take a consistent copy with read().
  */
 struct HardwareState {
     EncoderWheelStateType encoderWheelState;  ///< Encoder wheel mode and direction
@@ -27,5 +30,7 @@ struct HardwareState {
     bool macroModeActive;                     ///< Macro mode state (true = active, false = inactive)
 };
 
+using HardwareStateStore = Seqlock<HardwareState>;
+
 // Global hardware state instance (defined in main.cpp)
-extern HardwareState hardwareState;
+extern HardwareStateStore hardwareState;
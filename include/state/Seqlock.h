@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "freertos/FreeRTOS.h"
+
+/**
+ * @brief Sequence lock around a trivially copyable value
+ *
+ * Readers never block: they copy the value and retry if a write overlapped
+ * the copy (sequence odd, or changed between start and end). Writers are
+ * serialized with a critical section, so writes must stay short copies.
+ *
+ * The sequence also serves as a generation counter: every completed write
+ * advances getGeneration() by one.
+ */
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable<T>::value, "Seqlock requires a trivially copyable type");
+
+public:
+    Seqlock() : value{} {}
+
+    explicit Seqlock(const T& initial) : value(initial) {}
+
+    /**
+     * @brief Lock-free read of a consistent copy
+     */
+    T read() const {
+        T copy;
+        uint32_t before;
+        uint32_t after;
+        do {
+            before = sequence.load(std::memory_order_acquire);
+            if (before & 1) {
+                continue;  // Write in progress
+            }
+            std::memcpy(&copy, const_cast<const T*>(&value), sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence.load(std::memory_order_relaxed);
+        } while ((before & 1) || before != after);
+        return copy;
+    }
+
+    /**
+     * @brief Replace the value and advance the generation
+     */
+    void write(const T& next) {
+        taskENTER_CRITICAL(&writeMux);
+        uint32_t seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(const_cast<T*>(&value), &next, sizeof(T));
+        sequence.store(seq + 2, std::memory_order_release);
+        taskEXIT_CRITICAL(&writeMux);
+    }
+
+    /**
+     * @brief Read-modify-write under the writer lock
+     *
+     * For values with several writers that each own a few fields: changes
+     * made by concurrent update() calls are never lost. mutate runs inside
+     * the critical section, so it must only assign fields.
+     * @param mutate Callable taking T& (e.g. a lambda setting one field)
+     */
+    template <typename F>
+    void update(F mutate) {
+        taskENTER_CRITICAL(&writeMux);
+        T next;
+        std::memcpy(&next, const_cast<const T*>(&value), sizeof(T));
+        mutate(next);
+        uint32_t seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(const_cast<T*>(&value), &next, sizeof(T));
+        sequence.store(seq + 2, std::memory_order_release);
+        taskEXIT_CRITICAL(&writeMux);
+    }
+
+    /**
+     * @brief Number of completed writes
+     */
+    uint32_t getGeneration() const {
+        return sequence.load(std::memory_order_acquire) >> 1;
+    }
+
+private:
+    volatile T value;
+    std::atomic<uint32_t> sequence{0};
+    portMUX_TYPE writeMux = portMUX_INITIALIZER_UNLOCKED;
+};
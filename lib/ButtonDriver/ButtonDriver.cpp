@@ -2,10 +2,27 @@
 #include "Config/button_config.h"
 #include "Config/log_config.h"
 #include "driver/gpio.h"
+#include "esp_timer.h"
+
+static const char* TAG = "ButtonDriver";
 
 ButtonDriver* ButtonDriver::instance = nullptr;
 
-ButtonDriver::ButtonDriver() : shortPressCallbacks{}, longPressCallbacks{}, wasButtonDown{}, lastTimeButtonDown{} {}
+// Also called from buttonISR, so it must not live in flash
+static uint32_t IRAM_ATTR nowMs() {
+    return static_cast<uint32_t>(esp_timer_get_time() / 1000);
+}
+
+ButtonDriver::ButtonDriver() : gestureCallbacks{}, debounceTimers{} {
+    for (size_t i = 0; i < BUTTON_COUNT && i < MAX_BUTTONS; i++) {
+        GestureConfig config = BUTTONS[i].longPress
+            // Long press bound: short fires on release, long fires at threshold while held
+            ? GestureConfig{ static_cast<uint16_t>(BUTTON_LONG_PRESS_MIN_MS), 0, 1, 0, 0 }
+            // No long press: fire on press-down, repeat while held
+            : GestureConfig{ 0, 0, 1, BUTTON_REPEAT_DELAY_MS, BUTTON_REPEAT_INTERVAL_MS };
+        inputs[i] = GestureInput(DEBOUNCE_MS, config);
+    }
+}
 
 ButtonDriver* ButtonDriver::getInstance() {
     if (!instance) {
@@ -32,75 +49,76 @@ void ButtonDriver::begin() {
     // Longer delay to let pull-ups charge any parasitic capacitance
     delay(100);
 
-    // Initialize state to ACTUAL current reading (prevents false press at boot)
-    unsigned long now = millis();
+    // Seed each state machine with the ACTUAL current reading (prevents false press at boot)
+    uint32_t now = nowMs();
     for (size_t i = 0; i < BUTTON_COUNT; i++) {
-        wasButtonDown[i] = isButtonDown(i);
-        // If button is DOWN at boot, set start time so we don't get bogus duration
-        lastTimeButtonDown[i] = wasButtonDown[i] ? now : 0;
+        inputs[i].reset(isButtonDown(i), now);
     }
 
-    // Create FreeRTOS task for button polling
-    BaseType_t taskCreated = xTaskCreate(
-        buttonTask,           // Task function
-        "ButtonDriverTask",   // Name
-        2048,                 // Stack size
-        nullptr,              // Parameters
-        1,                    // Priority
-        nullptr              // Task handle
-    );
-
-    if (taskCreated != pdPASS) {
-        Serial.println("ERROR: Failed to create ButtonDriverTask - insufficient memory");
+    for (size_t i = 0; i < BUTTON_COUNT; i++) {
+        debounceTimers[i] = xTimerCreate(
+            "BtnDebounce",                          // Name
+            pdMS_TO_TICKS(DEBOUNCE_MS),             // Period (re-set per deadline)
+            pdFALSE,                                // One-shot
+            reinterpret_cast<void*>(i),             // Timer ID = button index
+            debounceTimerCallback                   // Callback
+        );
+
+        if (!debounceTimers[i]) {
+            LOG_ERROR(TAG, "Failed to create debounce timer for button %d - insufficient memory", static_cast<int>(i));
+            continue;
+        }
+
+        attachInterruptArg(digitalPinToInterrupt(BUTTONS[i].pin), buttonISR, reinterpret_cast<void*>(i), CHANGE);
     }
 }
 
-void ButtonDriver::buttonTask(void* pvParameters) {
-    while (true) {
-        if (instance) {
-            instance->runLoop();
-        }
-        vTaskDelay(pdMS_TO_TICKS(10));  // 10ms polling interval
+void IRAM_ATTR ButtonDriver::buttonISR(void* arg) {
+    ButtonDriver* self = instance;
+    uint8_t index = static_cast<uint8_t>(reinterpret_cast<uintptr_t>(arg));
+    if (!self || index >= BUTTON_COUNT || !self->debounceTimers[index]) {
+        return;
     }
+
+    portENTER_CRITICAL_ISR(&self->inputMux);
+    uint32_t delayMs = self->inputs[index].onEdge(nowMs());
+    portEXIT_CRITICAL_ISR(&self->inputMux);
+
+    // Every edge restarts the debounce window
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    xTimerChangePeriodFromISR(self->debounceTimers[index], pdMS_TO_TICKS(delayMs), &higherPriorityTaskWoken);
+    portYIELD_FROM_ISR(higherPriorityTaskWoken);
 }
 
-void ButtonDriver::runLoop() {
-    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
-        handleButton(i);
+void ButtonDriver::debounceTimerCallback(TimerHandle_t timer) {
+    if (instance) {
+        uint8_t index = static_cast<uint8_t>(reinterpret_cast<uintptr_t>(pvTimerGetTimerID(timer)));
+        instance->handleTimer(index);
     }
 }
 
-// Mirrors EncoderDriver::handleButton() pattern exactly
-void ButtonDriver::handleButton(uint8_t index) {
+void ButtonDriver::handleTimer(uint8_t index) {
+    if (index >= BUTTON_COUNT) {
+        return;
+    }
+
     bool isDown = isButtonDown(index);
+    GestureEvent events[GestureInput::MAX_EVENTS_PER_UPDATE];
+    uint8_t eventCount = 0;
 
-    if (isDown) {
-        if (!wasButtonDown[index]) {
-            // First detection of button down - record start time
-            lastTimeButtonDown[index] = millis();
-        }
-        wasButtonDown[index] = true;
-        return;
+    taskENTER_CRITICAL(&inputMux);
+    uint32_t nextDelayMs = inputs[index].update(isDown, nowMs(), events, eventCount);
+    taskEXIT_CRITICAL(&inputMux);
+
+    if (nextDelayMs > 0) {
+        xTimerChangePeriod(debounceTimers[index], pdMS_TO_TICKS(nextDelayMs), 0);
     }
 
-    // Button is UP
-    if (wasButtonDown[index]) {
-        // Was down, now up = released - calculate duration and dispatch
-        unsigned long pressDuration = millis() - lastTimeButtonDown[index];
-
-        if (pressDuration >= BUTTON_LONG_PRESS_MIN_MS) {
-            if (longPressCallbacks[index]) {
-                longPressCallbacks[index]();
-            }
-        } else if (pressDuration >= BUTTON_SHORT_PRESS_MIN_MS) {
-            if (shortPressCallbacks[index]) {
-                shortPressCallbacks[index]();
-            }
+    for (uint8_t i = 0; i < eventCount; i++) {
+        if (gestureCallbacks[index]) {
+            gestureCallbacks[index](events[i]);
         }
-        // Ignore presses shorter than BUTTON_SHORT_PRESS_MIN_MS (noise)
     }
-
-    wasButtonDown[index] = false;
 }
 
 bool ButtonDriver::isButtonDown(uint8_t index) {
@@ -108,14 +126,8 @@ bool ButtonDriver::isButtonDown(uint8_t index) {
     return BUTTONS[index].activeLow ? (pinState == LOW) : (pinState == HIGH);
 }
 
-void ButtonDriver::setOnShortPress(uint8_t buttonIndex, std::function<void()> callback) {
-    if (buttonIndex < BUTTON_COUNT) {
-        shortPressCallbacks[buttonIndex] = callback;
-    }
-}
-
-void ButtonDriver::setOnLongPress(uint8_t buttonIndex, std::function<void()> callback) {
+void ButtonDriver::setOnGesture(uint8_t buttonIndex, GestureCallback callback) {
     if (buttonIndex < BUTTON_COUNT) {
-        longPressCallbacks[buttonIndex] = callback;
+        gestureCallbacks[buttonIndex] = callback;
     }
 }
@@ -1,36 +1,56 @@
 #pragma once
 
 #include <Arduino.h>
-#include <functional>
 #include <cstdint>
 #include <cstddef>
+#include "freertos/timers.h"
+#include "GestureInput.h"
+#include "Delegate.h"
 
 // Maximum buttons supported (matches button_config.h BUTTON_COUNT)
 #define MAX_BUTTONS 5
 
+/**
+ * @brief Interrupt-driven button driver
+ *
+ * Each button has a CHANGE interrupt that feeds its GestureInput and
+ * (re)arms a one-shot FreeRTOS timer. The timer callback samples the settled
+ * level, advances debounce and gesture recognition, and re-arms itself for
+ * the next pending deadline, so nothing runs while the buttons are idle.
+ */
 class ButtonDriver {
 public:
+    using GestureCallback = Delegate<void(const GestureEvent&)>;
+
     ButtonDriver();
 
     static ButtonDriver* getInstance();
 
     void begin();
-    void setOnShortPress(uint8_t buttonIndex, std::function<void()> callback);
-    void setOnLongPress(uint8_t buttonIndex, std::function<void()> callback);
+
+    /**
+     * @brief Register the gesture callback for a button
+     *
+     * The callback runs in the FreeRTOS timer service task, shared with
+     * every software timer in the system. It must not block: publish
+     * without waiting (or hand off to a queue) and leave BLE, flash and
+     * display work to the subscriber tasks. Time spent in it delays the
+     * next debounce deadline of every button.
+     */
+    void setOnGesture(uint8_t buttonIndex, GestureCallback callback);
 
 private:
     static ButtonDriver* instance;
 
-    static void buttonTask(void* pvParameters);
+    static void IRAM_ATTR buttonISR(void* arg);
+    static void debounceTimerCallback(TimerHandle_t timer);
 
-    std::function<void()> shortPressCallbacks[MAX_BUTTONS];
-    std::function<void()> longPressCallbacks[MAX_BUTTONS];
+    GestureCallback gestureCallbacks[MAX_BUTTONS];
 
-    // Simple state tracking per button (mirrors EncoderDriver pattern)
-    bool wasButtonDown[MAX_BUTTONS];
-    unsigned long lastTimeButtonDown[MAX_BUTTONS];
+    GestureInput inputs[MAX_BUTTONS];
+    TimerHandle_t debounceTimers[MAX_BUTTONS];
+    portMUX_TYPE inputMux = portMUX_INITIALIZER_UNLOCKED;
 
-    void runLoop();
-    void handleButton(uint8_t index);
+    void handleTimer(uint8_t index);
     bool isButtonDown(uint8_t index);
 };
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename Signature>
+class Delegate;
+
+/**
+ * @brief Fixed-size, heap-free callable reference
+ *
+ * Replacement for std::function in driver callbacks: a single invoker
+ * function pointer plus CAPACITY bytes of inline storage, no allocation and
+ * no virtual dispatch. Accepts:
+ * - free functions and captureless lambdas
+ * - lambdas whose captures are trivially copyable and fit in CAPACITY
+ *   (e.g. `[i](...)` capturing an index)
+ * - a member function bound to an instance: Delegate<...>::bind<T, &T::method>(obj)
+ *
+ * The delegate itself is trivially copyable, so it can be stored in arrays
+ * and swapped without constructors running. Invoking it from an ISR is only
+ * safe if the target (and the compiler-generated invoker) live in IRAM.
+ */
+template <typename R, typename... Args>
+class Delegate<R(Args...)> {
+public:
+    static constexpr size_t CAPACITY = 2 * sizeof(void*);
+
+    Delegate() : storage{}, invoker(nullptr) {}
+    Delegate(std::nullptr_t) : storage{}, invoker(nullptr) {}
+
+    template <typename F,
+              typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, Delegate>::value>::type>
+    Delegate(F callable) : storage{}, invoker(&invokeCallable<F>) {
+        static_assert(sizeof(F) <= CAPACITY, "Callable captures too much state for Delegate storage");
+        static_assert(alignof(F) <= alignof(void*), "Callable alignment exceeds Delegate storage alignment");
+        static_assert(std::is_trivially_copyable<F>::value, "Delegate only stores trivially copyable callables");
+        new (storage) F(callable);
+    }
+
+    /**
+     * @brief Bind a member function to an instance without any capture
+     * @param obj Instance the method is called on (must outlive the delegate)
+     */
+    template <typename T, R (T::*Method)(Args...)>
+    static Delegate bind(T* obj) {
+        Delegate d;
+        new (d.storage) T*(obj);
+        d.invoker = &invokeMethod<T, Method>;
+        return d;
+    }
+
+    R operator()(Args... args) const {
+        return invoker(storage, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const {
+        return invoker != nullptr;
+    }
+
+private:
+    using Invoker = R (*)(const void* storage, Args... args);
+
+    alignas(void*) unsigned char storage[CAPACITY];
+    Invoker invoker;
+
+    template <typename F>
+    static R invokeCallable(const void* s, Args... args) {
+        return (*static_cast<const F*>(s))(std::forward<Args>(args)...);
+    }
+
+    template <typename T, R (T::*Method)(Args...)>
+    static R invokeMethod(const void* s, Args... args) {
+        T* obj = *static_cast<T* const*>(s);
+        return (obj->*Method)(std::forward<Args>(args)...);
+    }
+};
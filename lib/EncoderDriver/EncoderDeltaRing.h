@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief One decoded encoder movement
+ */
+struct EncoderDelta {
+    int32_t delta;
+    uint64_t timestampUs;  ///< Time of the edge that completed the movement
+};
+
+/**
+ * @brief Lock-free single-producer/single-consumer ring of encoder deltas
+ *
+ * The producer is the encoder ISR, the consumer is the encoder task. Only
+ * atomic loads and stores are used (no read-modify-write), which stay
+ * lock-free on the ESP32-C3 even though the core lacks the RISC-V A extension.
+ *
+ * Counts are never lost: when the ring is full the producer adds the delta
+ * to a running overflow sum, and every slot records the sum at the time it
+ * was pushed. pop() hands out the overflow that happened before a slot
+ * ahead of that slot, and whatever is left once the ring is empty, so
+ * overflowed counts keep their order and reach the consumer even if the
+ * knob stops right after the burst.
+ *
+ * @tparam CAPACITY Number of slots, must be a power of two
+ */
+template <size_t CAPACITY>
+class EncoderDeltaRing {
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+public:
+    /**
+     * @brief Producer side - push a delta (ISR context)
+     *
+     * Always inlined so the IRAM ISR never calls into flash.
+     * @return true if stored, false if added to the overflow sum
+     */
+    __attribute__((always_inline)) bool push(int32_t delta, uint64_t timestampUs) {
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        uint32_t tail = tail_.load(std::memory_order_acquire);
+        int32_t overflow = overflowSum_.load(std::memory_order_relaxed);
+
+        if (head - tail >= CAPACITY) {
+            overflowUs = timestampUs;
+            overflowSum_.store(overflow + delta, std::memory_order_release);
+            overflowCount++;
+            return false;
+        }
+
+        slots[head & (CAPACITY - 1)] = Slot{ EncoderDelta{ delta, timestampUs }, overflow };
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Consumer side - pop the oldest delta (task context)
+     * @return false if the ring is empty
+     */
+    bool pop(EncoderDelta& out) {
+        uint32_t tail = tail_.load(std::memory_order_relaxed);
+        uint32_t head = head_.load(std::memory_order_acquire);
+
+        if (tail == head) {
+            // Drained: overflow since the last slot can no longer ride along with one
+            int32_t overflow = overflowSum_.load(std::memory_order_acquire);
+            if (overflow == overflowTaken) {
+                return false;
+            }
+            out = EncoderDelta{ overflow - overflowTaken, overflowUs };
+            overflowTaken = overflow;
+            return true;
+        }
+
+        const Slot& slot = slots[tail & (CAPACITY - 1)];
+        if (slot.overflowBefore != overflowTaken) {
+            // Counts that overflowed before this slot was pushed go first; the slot stays queued
+            out = EncoderDelta{ slot.overflowBefore - overflowTaken, slot.delta.timestampUs };
+            overflowTaken = slot.overflowBefore;
+            return true;
+        }
+
+        out = slot.delta;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Number of pushes that found the ring full
+     */
+    uint32_t getOverflowCount() const { return overflowCount; }
+
+private:
+    struct Slot {
+        EncoderDelta delta;
+        int32_t overflowBefore;  ///< overflowSum_ when the slot was pushed
+    };
+
+    Slot slots[CAPACITY] = {};
+    std::atomic<uint32_t> head_{0};
+    std::atomic<uint32_t> tail_{0};
+
+    // Written by the producer only (plain load + store, no read-modify-write)
+    std::atomic<int32_t> overflowSum_{0};
+    uint64_t overflowUs = 0;  ///< Edge time of the latest overflow, published by overflowSum_
+    volatile uint32_t overflowCount = 0;
+
+    // Consumer-only state
+    int32_t overflowTaken = 0;  ///< Part of overflowSum_ already handed out
+};
@@ -1,8 +1,12 @@
 #include "EncoderDriver.h"
-#include "Config/encoder_config.h"
+#include "Config/log_config.h"
+#include "driver/gpio.h"
+#include "hal/gpio_ll.h"
+#include "esp_timer.h"
+
+static const char* TAG = "EncoderDriver";
 
 EncoderDriver* EncoderDriver::encoderDriverInstance = nullptr;
-AiEsp32RotaryEncoder* EncoderDriver::encoderInstance = nullptr;
 
 EncoderDriver::EncoderDriver(
     uint8_t clkPin,
@@ -10,7 +14,11 @@ EncoderDriver::EncoderDriver(
     int swPin,
     int vccPin,
     uint8_t steps
-) : clkPin(clkPin), dtPin(dtPin), swPin(swPin), vccPin(vccPin), steps(steps) {}
+)
+    : decoder(steps)
+    // Long press bound (menu): short fires on release, long fires at threshold while held
+    , buttonInput(ENCODER_DEBOUNCE_MS, GestureConfig{ ENCODER_LONG_PRESS_MIN_MS, 0, 1, 0, 0 })
+    , clkPin(clkPin), dtPin(dtPin), swPin(swPin), vccPin(vccPin), steps(steps) {}
 
 EncoderDriver* EncoderDriver::getInstance(
     uint8_t clkPin,
@@ -26,71 +34,118 @@ EncoderDriver* EncoderDriver::getInstance(
 }
 
 void EncoderDriver::begin() {
-    if (!encoderInstance) {
-        encoderInstance = new AiEsp32RotaryEncoder(clkPin, dtPin, swPin, vccPin, steps);
+    if (vccPin >= 0) {
+        pinMode(vccPin, OUTPUT);
+        digitalWrite(vccPin, HIGH);
+    }
+
+    // Same pin setup the previous encoder library used (module has its own pull-ups)
+    pinMode(clkPin, INPUT_PULLDOWN);
+    pinMode(dtPin, INPUT_PULLDOWN);
+    if (swPin >= 0) {
+        pinMode(swPin, INPUT_PULLUP);
     }
 
-    encoderInstance->begin();
-    encoderInstance->setup(readEncoderISR);
-    encoderInstance->setBoundaries(0, 1000, true);  // Enable circular mode for infinite rotation
-    encoderInstance->setAcceleration(250);
-    encoderInstance->reset(500);  // Initialize to middle of range so both directions work
+    decoder.reset(gpio_get_level((gpio_num_t)clkPin), gpio_get_level((gpio_num_t)dtPin));
+    buttonInput.reset(isButtonDown(), millis());
+
+    // Task must exist before the ISRs can notify it
+    BaseType_t taskCreated = xTaskCreate(encoderTask, "EncoderDriverTask", 4096, this, 1, &taskHandle);
+    if (taskCreated != pdPASS) {
+        LOG_ERROR(TAG, "Failed to create EncoderDriverTask");
+        return;
+    }
 
-    xTaskCreate(encoderTask, "EncoderDriverTask", 4096, nullptr, 1, nullptr);
+    attachInterrupt(digitalPinToInterrupt(clkPin), encoderISR, CHANGE);
+    attachInterrupt(digitalPinToInterrupt(dtPin), encoderISR, CHANGE);
+    if (swPin >= 0) {
+        attachInterrupt(digitalPinToInterrupt(swPin), buttonISR, CHANGE);
+    }
 }
 
-void IRAM_ATTR EncoderDriver::readEncoderISR() {
-    if (encoderInstance) {
-        encoderInstance->readEncoder_ISR();
+void IRAM_ATTR EncoderDriver::encoderISR() {
+    EncoderDriver* self = encoderDriverInstance;
+    if (!self || !self->taskHandle) {
+        return;
     }
+
+    // gpio_get_level() lives in flash; the inline register read is safe with the cache off
+    int8_t detents = self->decoder.update(
+        gpio_ll_get_level(&GPIO, self->clkPin),
+        gpio_ll_get_level(&GPIO, self->dtPin)
+    );
+    if (detents == 0) {
+        return;
+    }
+
+    self->deltaRing.push(detents, static_cast<uint64_t>(esp_timer_get_time()));
+
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(self->taskHandle, &higherPriorityTaskWoken);
+    portYIELD_FROM_ISR(higherPriorityTaskWoken);
+}
+
+void IRAM_ATTR EncoderDriver::buttonISR() {
+    EncoderDriver* self = encoderDriverInstance;
+    if (!self || !self->taskHandle) {
+        return;
+    }
+
+    portENTER_CRITICAL_ISR(&self->buttonMux);
+    self->buttonInput.onEdge(static_cast<uint32_t>(esp_timer_get_time() / 1000));
+    portEXIT_CRITICAL_ISR(&self->buttonMux);
+
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(self->taskHandle, &higherPriorityTaskWoken);
+    portYIELD_FROM_ISR(higherPriorityTaskWoken);
 }
 
 void EncoderDriver::encoderTask(void* pvParameters) {
+    EncoderDriver* self = static_cast<EncoderDriver*>(pvParameters);
+    TickType_t wait = portMAX_DELAY;
     while (true) {
-        if (encoderDriverInstance) {
-            encoderDriverInstance->runLoop();
-        }
-        vTaskDelay(pdMS_TO_TICKS(10));
+        // Sleep until an edge arrives or the next button deadline expires
+        ulTaskNotifyTake(pdTRUE, wait);
+        wait = self->runLoop();
     }
 }
 
-void EncoderDriver::runLoop() {
-    static int32_t lastValue = 500;  // Match initial encoder position
-    int32_t current = encoderInstance->readEncoder();
-
-    if (current != lastValue) {
-        if (onValueChangeCallback) {
-            onValueChangeCallback(current);
+TickType_t EncoderDriver::runLoop() {
+    EncoderDelta entry;
+    while (deltaRing.pop(entry)) {
+        if (onRotateCallback) {
+            onRotateCallback(entry.delta, entry.timestampUs);
         }
-        lastValue = current;
     }
-    handleButton();
+    return handleButton();
 }
 
-void EncoderDriver::handleButton() {
-    static unsigned long lastTimeButtonDown = 0;
-    static bool wasButtonDown = false;
-
-    bool isDown = encoderInstance->isEncoderButtonDown();
+TickType_t EncoderDriver::handleButton() {
+    bool isDown = isButtonDown();
+    GestureEvent events[GestureInput::MAX_EVENTS_PER_UPDATE];
+    uint8_t eventCount = 0;
 
-    if (isDown) {
-        if (!wasButtonDown) {
-            lastTimeButtonDown = millis();
-        }
-        wasButtonDown = true;
-        return;
-    }
+    taskENTER_CRITICAL(&buttonMux);
+    uint32_t nextDelayMs = buttonInput.update(isDown, static_cast<uint32_t>(esp_timer_get_time() / 1000), events, eventCount);
+    taskEXIT_CRITICAL(&buttonMux);
 
-    if (wasButtonDown) {
-        unsigned long pressDuration = millis() - lastTimeButtonDown;
-        if (pressDuration >= ENCODER_LONG_PRESS_MIN_MS) {
+    for (uint8_t i = 0; i < eventCount; i++) {
+        if (events[i].type == GestureEvent::Type::LONG_PRESS) {
             onLongClick();
-        } else if (pressDuration >= ENCODER_SHORT_PRESS_MIN_MS) {
+        } else if (events[i].type == GestureEvent::Type::CLICK) {
             onShortClick();
         }
     }
 
-    wasButtonDown = false;
+    return nextDelayMs > 0 ? pdMS_TO_TICKS(nextDelayMs) : portMAX_DELAY;
+}
+
+bool EncoderDriver::isButtonDown() const {
+    return swPin >= 0 && digitalRead(swPin) == LOW;
+}
+
+uint32_t EncoderDriver::getOverflowCount() const {
+    return deltaRing.getOverflowCount();
 }
 
 void EncoderDriver::onShortClick() {
@@ -105,14 +160,14 @@ void EncoderDriver::onLongClick() {
     }
 }
 
-void EncoderDriver::setOnShortClick(std::function<void()> callback) {
+void EncoderDriver::setOnShortClick(ClickCallback callback) {
     onShortClickCallback = callback;
 }
 
-void EncoderDriver::setOnLongClick(std::function<void()> callback) {
+void EncoderDriver::setOnLongClick(ClickCallback callback) {
     onLongClickCallback = callback;
 }
 
-void EncoderDriver::setOnValueChange(std::function<void(int32_t)> callback) {
-    onValueChangeCallback = callback;
+void EncoderDriver::setOnRotate(RotateCallback callback) {
+    onRotateCallback = callback;
 }
@@ -1,11 +1,26 @@
 #pragma once
 
-#include "AiEsp32RotaryEncoder.h"
 #include "Arduino.h"
-#include "functional"
+#include "QuadratureDecoder.h"
+#include "EncoderDeltaRing.h"
+#include "GestureInput.h"
+#include "Delegate.h"
+#include "Config/encoder_config.h"
 
+/**
+ * @brief Interrupt-driven rotary encoder driver
+ *
+ * A/B edges are decoded in the GPIO ISR and pushed as timestamped deltas into
+ * a lock-free ring. The driver task sleeps on a task notification and only
+ * runs when the ISR has produced work, so there is no polling latency and no
+ * absolute position to wrap. Button edges feed a GestureInput whose pending
+ * deadline becomes the task's wait timeout.
+ */
 class EncoderDriver {
 public:
+    using ClickCallback = Delegate<void()>;
+    using RotateCallback = Delegate<void(int32_t delta, uint64_t timestampUs)>;
+
     EncoderDriver(
         uint8_t clkPin,
         uint8_t dtPin,
@@ -23,26 +38,43 @@ public:
     );
 
     void begin();
-    void setOnShortClick(std::function<void()> callback);
-    void setOnLongClick(std::function<void()> callback);
-    void setOnValueChange(std::function<void(int32_t newValue)> callback);
+    void setOnShortClick(ClickCallback callback);
+    void setOnLongClick(ClickCallback callback);
+    void setOnRotate(RotateCallback callback);
+
+    /**
+     * @brief Deltas folded into a later ring slot because the ring was full
+     */
+    uint32_t getOverflowCount() const;
 
-    static void IRAM_ATTR readEncoderISR();
+    static void IRAM_ATTR encoderISR();
+    static void IRAM_ATTR buttonISR();
 
 private:
     static EncoderDriver* encoderDriverInstance;
-    static AiEsp32RotaryEncoder* encoderInstance;
 
     static void encoderTask(void* pvParameters);
 
-    std::function<void()> onShortClickCallback = nullptr;
-    std::function<void()> onLongClickCallback = nullptr;
-    std::function<void(int32_t)> onValueChangeCallback = nullptr;
+    ClickCallback onShortClickCallback;
+    ClickCallback onLongClickCallback;
+    RotateCallback onRotateCallback;
+
+    QuadratureDecoder decoder;
+    EncoderDeltaRing<ENCODER_DELTA_RING_CAPACITY> deltaRing;
+    TaskHandle_t taskHandle = nullptr;
+
+    GestureInput buttonInput;
+    portMUX_TYPE buttonMux = portMUX_INITIALIZER_UNLOCKED;
 
-    void handleButton();
+    /**
+     * @brief Advance button debounce/gesture state
+     * @return Ticks until the next button deadline (portMAX_DELAY if none)
+     */
+    TickType_t handleButton();
+    bool isButtonDown() const;
     void onShortClick();
     void onLongClick();
-    void runLoop();
+    TickType_t runLoop();
 
     uint8_t clkPin;
     uint8_t dtPin;
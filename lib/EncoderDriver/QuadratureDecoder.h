@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include "esp_attr.h"
+
+/**
+ * @brief Table-driven quadrature decoder
+ *
+ * Decodes A/B edge transitions into signed quarter-steps using the classic
+ * 16-entry transition table, then accumulates quarter-steps into detents.
+ * Invalid transitions (both pins changing at once) decode to 0, so contact
+ * bounce cancels out instead of producing phantom counts.
+ *
+ * Safe to call from the IRAM encoder ISR: update() is always inlined into
+ * the caller and the transition table lives in DRAM, so decoding never
+ * touches flash and keeps working while the cache is disabled for an
+ * NVS commit.
+ */
+class QuadratureDecoder {
+public:
+    explicit QuadratureDecoder(uint8_t stepsPerDetent = 4)
+        : stepsPerDetent(stepsPerDetent == 0 ? 1 : stepsPerDetent) {}
+
+    /**
+     * @brief Seed the previous pin state (call once before the first update)
+     */
+    void reset(uint8_t a, uint8_t b) {
+        state = static_cast<uint8_t>(((b & 1) << 1) | (a & 1));
+        accumulator = 0;
+    }
+
+    /**
+     * @brief Feed the current pin levels after an edge
+     * @return Completed detents since the last call (-1, 0 or +1 in practice)
+     */
+    __attribute__((always_inline)) int8_t update(uint8_t a, uint8_t b) {
+        static const int8_t TRANSITIONS[16] DRAM_ATTR = {
+            0, -1,  1,  0,
+            1,  0,  0, -1,
+           -1,  0,  0,  1,
+            0,  1, -1,  0
+        };
+
+        state = static_cast<uint8_t>(((state << 2) | ((b & 1) << 1) | (a & 1)) & 0x0F);
+        accumulator += TRANSITIONS[state];
+
+        if (accumulator >= stepsPerDetent) {
+            accumulator -= stepsPerDetent;
+            return 1;
+        }
+        if (accumulator <= -stepsPerDetent) {
+            accumulator += stepsPerDetent;
+            return -1;
+        }
+        return 0;
+    }
+
+private:
+    int8_t stepsPerDetent;
+    uint8_t state = 0;
+    int8_t accumulator = 0;
+};
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Debounced button transition reported by ButtonDebouncer
+ */
+struct ButtonDebounceEvent {
+    enum class Type : uint8_t {
+        NONE,
+        PRESS,    ///< Contact settled closed
+        HELD,     ///< Still closed after the hold threshold
+        RELEASE   ///< Contact settled open
+    };
+
+    Type type = Type::NONE;
+    uint32_t timestampMs = 0;  ///< Time of the first edge of the transition
+    uint32_t durationMs = 0;   ///< RELEASE: time the button was down
+};
+
+/**
+ * @brief Deterministic per-button debounce state machine
+ *
+ *   IDLE --edge--> BOUNCING --settled down--> PRESSED --hold time--> HELD
+ *     ^                |                         |                    |
+ *     +--settled up----+<--------edge------------+--------edge--------+
+ *
+ * Driven by two inputs: onEdge() from the GPIO interrupt and onSettle() when
+ * the debounce (or hold) deadline expires. Both return the delay in ms until
+ * onSettle() must be called next (0 = no deadline). Has no platform
+ * dependencies; the caller owns timers and locking.
+ *
+ * With holdMs = 0 HELD is never reported and a press schedules no hold
+ * deadline, for owners that time long presses themselves.
+ */
+class ButtonDebouncer {
+public:
+    enum class State : uint8_t {
+        IDLE,
+        BOUNCING,
+        PRESSED,
+        HELD
+    };
+
+    /**
+     * @param debounceMs Quiet time before a level counts as settled
+     * @param holdMs Time down before HELD (0 = no HELD, no hold deadline)
+     */
+    ButtonDebouncer(uint32_t debounceMs = 50, uint32_t holdMs = 1000)
+        : debounceMs(debounceMs), holdMs(holdMs) {}
+
+    /**
+     * @brief Set the stable state without emitting events (boot)
+     */
+    void reset(bool isDown, uint32_t nowMs) {
+        state = isDown ? State::PRESSED : State::IDLE;
+        stableState = state;
+        pressStartMs = nowMs;
+        firstEdgeMs = nowMs;
+        lastEdgeMs = nowMs;
+    }
+
+    /**
+     * @brief A GPIO edge was seen (any direction)
+     *
+     * Called from IRAM ISRs: always inlined, touches only members.
+     * @return Delay until onSettle() should run
+     */
+    __attribute__((always_inline)) uint32_t onEdge(uint32_t nowMs) {
+        if (state != State::BOUNCING) {
+            stableState = state;
+            firstEdgeMs = nowMs;
+            state = State::BOUNCING;
+        }
+        lastEdgeMs = nowMs;
+        return debounceMs;
+    }
+
+    /**
+     * @brief Deadline expired: sample the settled level
+     * @param isDown Current (debounced) contact level
+     * @param nowMs Current time
+     * @param out Event produced by this step (type NONE if nothing changed)
+     * @return Delay until onSettle() should run again (0 = none)
+     */
+    uint32_t onSettle(bool isDown, uint32_t nowMs, ButtonDebounceEvent& out) {
+        out = ButtonDebounceEvent{};
+
+        switch (state) {
+            case State::BOUNCING: {
+                uint32_t quietMs = nowMs - lastEdgeMs;
+                if (quietMs < debounceMs) {
+                    return debounceMs - quietMs;  // Still bouncing
+                }
+
+                bool wasDown = stableState != State::IDLE;
+                if (isDown && !wasDown) {
+                    state = State::PRESSED;
+                    pressStartMs = firstEdgeMs;
+                    out.type = ButtonDebounceEvent::Type::PRESS;
+                    out.timestampMs = firstEdgeMs;
+                    return holdRemaining(nowMs);
+                }
+                if (!isDown && wasDown) {
+                    state = State::IDLE;
+                    out.type = ButtonDebounceEvent::Type::RELEASE;
+                    out.timestampMs = firstEdgeMs;
+                    out.durationMs = firstEdgeMs - pressStartMs;
+                    return 0;
+                }
+
+                // Glitch: settled back where it started
+                state = stableState;
+                return state == State::PRESSED ? holdRemaining(nowMs) : 0;
+            }
+
+            case State::PRESSED:
+                if (holdMs == 0) {
+                    return 0;
+                }
+                if (isDown && nowMs - pressStartMs >= holdMs) {
+                    state = State::HELD;
+                    out.type = ButtonDebounceEvent::Type::HELD;
+                    out.timestampMs = pressStartMs + holdMs;
+                    return 0;
+                }
+                return isDown ? holdRemaining(nowMs) : 0;
+
+            case State::IDLE:
+            case State::HELD:
+            default:
+                return 0;
+        }
+    }
+
+    State getState() const { return state; }
+
+    bool isDown() const {
+        State s = state == State::BOUNCING ? stableState : state;
+        return s == State::PRESSED || s == State::HELD;
+    }
+
+private:
+    uint32_t debounceMs;
+    uint32_t holdMs;
+
+    State state = State::IDLE;
+    State stableState = State::IDLE;  ///< State before the current bounce window
+    uint32_t pressStartMs = 0;
+    uint32_t firstEdgeMs = 0;
+    uint32_t lastEdgeMs = 0;
+
+    uint32_t holdRemaining(uint32_t nowMs) const {
+        if (holdMs == 0) {
+            return 0;
+        }
+        uint32_t elapsed = nowMs - pressStartMs;
+        return elapsed >= holdMs ? 1 : holdMs - elapsed;
+    }
+};
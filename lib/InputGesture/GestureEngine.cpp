@@ -0,0 +1,142 @@
+#include "GestureEngine.h"
+
+// (state x input) -> action. Guards on config live in step().
+const GestureEngine::Action GestureEngine::TRANSITIONS[STATE_COUNT][INPUT_COUNT] = {
+    //              PRESS         RELEASE     TICK
+    /* IDLE     */ { FIRST_PRESS, IGNORE,     IGNORE         },
+    /* PRESSED  */ { IGNORE,      END_PRESS,  HOLD_TIMEOUT   },
+    /* HOLDING  */ { IGNORE,      END_HOLD,   REPEAT_TIMEOUT },
+    /* RELEASED */ { NEXT_PRESS,  IGNORE,     WINDOW_TIMEOUT },
+};
+
+GestureEngine::GestureEngine(const GestureConfig& config) : config(config) {}
+
+void GestureEngine::setConfig(const GestureConfig& newConfig) {
+    config = newConfig;
+    reset();
+}
+
+void GestureEngine::reset() {
+    state = IDLE;
+    clicks = 0;
+    disarm();
+}
+
+bool GestureEngine::firesEarly() const {
+    return config.longPressMs == 0 && config.multiClickWindowMs == 0;
+}
+
+bool GestureEngine::onPress(uint32_t nowMs, GestureEvent& out) {
+    return step(PRESS, nowMs, out);
+}
+
+bool GestureEngine::onRelease(uint32_t nowMs, GestureEvent& out) {
+    return step(RELEASE, nowMs, out);
+}
+
+bool GestureEngine::onTick(uint32_t nowMs, GestureEvent& out) {
+    // Deadlines are absolute; wrap-safe comparison
+    if (!deadlinePending || static_cast<int32_t>(nowMs - deadlineMs) < 0) {
+        out = GestureEvent{};
+        return false;
+    }
+    return step(TICK, nowMs, out);
+}
+
+bool GestureEngine::getNextDeadline(uint32_t& outMs) const {
+    outMs = deadlineMs;
+    return deadlinePending;
+}
+
+bool GestureEngine::step(Input input, uint32_t nowMs, GestureEvent& out) {
+    out = GestureEvent{};
+    uint8_t maxClicks = config.multiClickWindowMs == 0 ? 1 : (config.maxClicks < 1 ? 1 : (config.maxClicks > 3 ? 3 : config.maxClicks));
+
+    switch (TRANSITIONS[state][input]) {
+        case FIRST_PRESS:
+            state = PRESSED;
+            clicks = 1;
+            disarm();
+            // Repeat takes the hold slot; otherwise long press if bound
+            if (config.repeatDelayMs > 0) {
+                arm(nowMs + config.repeatDelayMs);
+            } else if (config.longPressMs > 0) {
+                arm(nowMs + config.longPressMs);
+            }
+            if (firesEarly()) {
+                return emit(GestureEvent::Type::CLICK, 1, nowMs, out);
+            }
+            return false;
+
+        case NEXT_PRESS:
+            // Second/third click: holding it has no meaning, only the release counts
+            state = PRESSED;
+            clicks++;
+            disarm();
+            return false;
+
+        case END_PRESS:
+            disarm();
+            if (firesEarly()) {
+                state = IDLE;
+                return false;  // Already reported on press-down
+            }
+            if (clicks < maxClicks) {
+                state = RELEASED;
+                arm(nowMs + config.multiClickWindowMs);
+                return false;
+            }
+            state = IDLE;
+            return emit(GestureEvent::Type::CLICK, clicks, nowMs, out);
+
+        case HOLD_TIMEOUT:
+            state = HOLDING;
+            disarm();
+            if (config.repeatDelayMs > 0) {
+                if (config.repeatIntervalMs > 0) {
+                    arm(nowMs + config.repeatIntervalMs);
+                }
+                return emit(GestureEvent::Type::REPEAT, clicks, nowMs, out);
+            }
+            return emit(GestureEvent::Type::LONG_PRESS, clicks, nowMs, out);
+
+        case REPEAT_TIMEOUT:
+            disarm();
+            if (config.repeatDelayMs > 0 && config.repeatIntervalMs > 0) {
+                arm(deadlineMs + config.repeatIntervalMs);
+                return emit(GestureEvent::Type::REPEAT, clicks, nowMs, out);
+            }
+            return false;
+
+        case END_HOLD:
+            state = IDLE;
+            clicks = 0;
+            disarm();
+            return false;
+
+        case WINDOW_TIMEOUT:
+            state = IDLE;
+            disarm();
+            return emit(GestureEvent::Type::CLICK, clicks, nowMs, out);
+
+        case IGNORE:
+        default:
+            return false;
+    }
+}
+
+bool GestureEngine::emit(GestureEvent::Type type, uint8_t count, uint32_t nowMs, GestureEvent& out) {
+    out.type = type;
+    out.clickCount = count;
+    out.timestampMs = nowMs;
+    return true;
+}
+
+void GestureEngine::arm(uint32_t atMs) {
+    deadlineMs = atMs;
+    deadlinePending = true;
+}
+
+void GestureEngine::disarm() {
+    deadlinePending = false;
+}
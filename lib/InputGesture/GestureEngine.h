@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Per-input gesture timing
+ *
+ * A zero disables the corresponding gesture. With no long press and no
+ * multi-click, a click fires on press-down instead of on release.
+ */
+struct GestureConfig {
+    uint16_t longPressMs;        ///< Long press fires at this hold time (0 = no long press binding)
+    uint16_t multiClickWindowMs; ///< Max gap between clicks of a double/triple click (0 = single only)
+    uint8_t maxClicks;           ///< Highest click count reported (1-3)
+    uint16_t repeatDelayMs;      ///< Hold time before the first repeat (0 = no hold-to-repeat)
+    uint16_t repeatIntervalMs;   ///< Cadence of repeats after the first
+};
+
+/**
+ * @brief Recognized gesture
+ */
+struct GestureEvent {
+    enum class Type : uint8_t {
+        NONE,
+        CLICK,       ///< clickCount = 1, 2 or 3
+        LONG_PRESS,  ///< Fired while still held, at longPressMs
+        REPEAT       ///< Fired while held, every repeatIntervalMs after repeatDelayMs
+    };
+
+    Type type = Type::NONE;
+    uint8_t clickCount = 0;
+    uint32_t timestampMs = 0;
+};
+
+/**
+ * @brief Table-driven press/release gesture recognizer
+ *
+ * Consumes debounced press/release edges plus deadline ticks and produces
+ * at most one GestureEvent per step. State transitions come from a static
+ * (state x input) table; the handlers only apply the per-input config.
+ *
+ * No heap, no platform dependencies - the owner drives time through
+ * onPress/onRelease/onTick and schedules the next call with getNextDeadline().
+ */
+class GestureEngine {
+public:
+    explicit GestureEngine(const GestureConfig& config = GestureConfig{0, 0, 1, 0, 0});
+
+    void setConfig(const GestureConfig& config);
+
+    /**
+     * @brief Debounced press-down
+     * @return true if out holds an event
+     */
+    bool onPress(uint32_t nowMs, GestureEvent& out);
+
+    /**
+     * @brief Debounced release
+     * @return true if out holds an event
+     */
+    bool onRelease(uint32_t nowMs, GestureEvent& out);
+
+    /**
+     * @brief Time passed; call at (or after) the deadline
+     * @return true if out holds an event
+     */
+    bool onTick(uint32_t nowMs, GestureEvent& out);
+
+    /**
+     * @brief Absolute time of the next pending deadline
+     * @return false if nothing is pending
+     */
+    bool getNextDeadline(uint32_t& deadlineMs) const;
+
+    /**
+     * @brief Whether a click is reported on press-down
+     */
+    bool firesEarly() const;
+
+    void reset();
+
+private:
+    enum State : uint8_t { IDLE, PRESSED, HOLDING, RELEASED, STATE_COUNT };
+    enum Input : uint8_t { PRESS, RELEASE, TICK, INPUT_COUNT };
+    enum Action : uint8_t { IGNORE, FIRST_PRESS, NEXT_PRESS, END_PRESS, HOLD_TIMEOUT, REPEAT_TIMEOUT, END_HOLD, WINDOW_TIMEOUT };
+
+    static const Action TRANSITIONS[STATE_COUNT][INPUT_COUNT];
+
+    GestureConfig config;
+    State state = IDLE;
+    uint8_t clicks = 0;
+    bool deadlinePending = false;
+    uint32_t deadlineMs = 0;
+
+    bool step(Input input, uint32_t nowMs, GestureEvent& out);
+    bool emit(GestureEvent::Type type, uint8_t count, uint32_t nowMs, GestureEvent& out);
+    void arm(uint32_t atMs);
+    void disarm();
+};
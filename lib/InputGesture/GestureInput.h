@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include "ButtonDebouncer.h"
+#include "GestureEngine.h"
+
+/**
+ * @brief Debouncer + gesture recognizer for one physical switch
+ *
+ * Glue shared by ButtonDriver and EncoderDriver: edges go to the debouncer,
+ * settled transitions go to the gesture engine, and update() reports the
+ * single delay after which it must be called again. Not thread-safe; the
+ * owner serializes onEdge() (ISR) against update() (task).
+ */
+class GestureInput {
+public:
+    static constexpr uint8_t MAX_EVENTS_PER_UPDATE = 2;
+
+    GestureInput() = default;
+
+    // GestureEngine times long presses itself, so the debouncer schedules no HELD deadline
+    GestureInput(uint32_t debounceMs, const GestureConfig& config)
+        : debouncer(debounceMs, 0), gesture(config) {}
+
+    /**
+     * @brief Seed the settled level (boot)
+     */
+    void reset(bool isDown, uint32_t nowMs) {
+        debouncer.reset(isDown, nowMs);
+        gesture.reset();
+    }
+
+    /**
+     * @brief Raw edge from the interrupt
+     *
+     * Always inlined (with ButtonDebouncer::onEdge) into the IRAM ISRs, so
+     * an edge during a flash write never executes from flash.
+     * @return Delay until update() should run
+     */
+    __attribute__((always_inline)) uint32_t onEdge(uint32_t nowMs) {
+        return debouncer.onEdge(nowMs);
+    }
+
+    /**
+     * @brief Advance both state machines
+     * @param isDown Current contact level
+     * @param nowMs Current time
+     * @param events Output array of MAX_EVENTS_PER_UPDATE gestures
+     * @param count Number of gestures written
+     * @return Delay until update() should run again (0 = nothing pending)
+     */
+    uint32_t update(bool isDown, uint32_t nowMs, GestureEvent* events, uint8_t& count) {
+        count = 0;
+
+        ButtonDebounceEvent edge;
+        uint32_t debounceDelay = debouncer.onSettle(isDown, nowMs, edge);
+
+        GestureEvent event;
+        if (edge.type == ButtonDebounceEvent::Type::PRESS && gesture.onPress(edge.timestampMs, event)) {
+            events[count++] = event;
+        } else if (edge.type == ButtonDebounceEvent::Type::RELEASE && gesture.onRelease(edge.timestampMs, event)) {
+            events[count++] = event;
+        }
+        if (gesture.onTick(nowMs, event)) {
+            events[count++] = event;
+        }
+
+        uint32_t delay = debounceDelay;
+        uint32_t deadline;
+        if (gesture.getNextDeadline(deadline)) {
+            int32_t untilDeadline = static_cast<int32_t>(deadline - nowMs);
+            uint32_t gestureDelay = untilDeadline > 0 ? static_cast<uint32_t>(untilDeadline) : 1;
+            if (delay == 0 || gestureDelay < delay) {
+                delay = gestureDelay;
+            }
+        }
+        return delay;
+    }
+
+    bool isDown() const { return debouncer.isDown(); }
+
+private:
+    ButtonDebouncer debouncer{50, 0};
+    GestureEngine gesture;
+};
@@ -0,0 +1,216 @@
+#include "BleAdvertisingScheduler.h"
+#include <string.h>
+#include "Arduino.h"
+#include "esp_timer.h"
+#include "Config/ble_advertising_config.h"
+#include "Config/log_config.h"
+
+#ifdef USE_NIMBLE
+#include <NimBLEDevice.h>
+#endif
+
+static const char* TAG = "BleAdvScheduler";
+
+/**
+ * @brief Last connected peer, kept across deep sleep (cleared on power-on)
+ */
+struct RtcPeer {
+    uint32_t magic;
+    uint8_t type;
+    uint8_t address[6];
+};
+
+static constexpr uint32_t RTC_PEER_MAGIC = 0x50454552;  // "PEER"
+RTC_DATA_ATTR static RtcPeer rtcPeer;
+
+BleAdvertisingScheduler::BleAdvertisingScheduler(BleKeyboard* keyboard)
+    : bleKeyboard(keyboard)
+    , phase(BleAdvertisingPhase::OFF)
+    , phaseStartMs(0)
+    , fastWindowMs(BLE_ADV_FAST_MS)
+    , advertisingStartMs(0)
+    , stoppedByUser(false)
+    , pairing(false)
+    , everConnected(false)
+    , stats{} {
+}
+
+void BleAdvertisingScheduler::begin(bool wakingFromSleep) {
+    taskENTER_CRITICAL(&advMux);
+    stats.wokeFromSleep = wakingFromSleep;
+    stoppedByUser = false;
+    taskEXIT_CRITICAL(&advMux);
+
+    LOG_INFO(TAG, "Starting (%s, last peer %s)", wakingFromSleep ? "wake" : "cold boot",
+             hasPeer() ? "known" : "unknown");
+    startSchedule(hasPeer(), BLE_ADV_FAST_MS);
+}
+
+void BleAdvertisingScheduler::onConnect() {
+#ifdef USE_NIMBLE
+    NimBLEServer* server = NimBLEDevice::getServer();
+    if (server != nullptr && server->getConnectedCount() > 0) {
+        // Identity address: stays valid when the host rotates its resolvable private address
+        NimBLEAddress peer = server->getPeerInfo(0).getIdAddress();
+        rtcPeer.type = peer.getType();
+        memcpy(rtcPeer.address, peer.getVal(), sizeof(rtcPeer.address));
+        rtcPeer.magic = RTC_PEER_MAGIC;
+    }
+#endif
+
+    uint32_t now = millis();
+    uint32_t sinceBootMs = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+
+    taskENTER_CRITICAL(&advMux);
+    if (!everConnected) {
+        stats.wakeToConnectedMs = sinceBootMs;
+        everConnected = true;
+    }
+    stats.lastReconnectMs = now - advertisingStartMs;
+    phase = BleAdvertisingPhase::OFF;  // Peripheral stops advertising once connected
+    pairing = false;
+    [[maybe_unused]] BleAdvertisingStats snapshot = stats;
+    taskEXIT_CRITICAL(&advMux);
+
+    LOG_INFO(TAG, "Connected: %lu ms since %s, %lu ms advertising",
+             snapshot.wakeToConnectedMs, snapshot.wokeFromSleep ? "wake" : "boot", snapshot.lastReconnectMs);
+}
+
+void BleAdvertisingScheduler::onDisconnect() {
+    taskENTER_CRITICAL(&advMux);
+    bool keepCurrent = stoppedByUser || pairing;
+    taskEXIT_CRITICAL(&advMux);
+
+    if (keepCurrent) {
+        return;  // User stopped advertising, or a pairing schedule is already running
+    }
+    startSchedule(hasPeer(), BLE_ADV_FAST_MS);
+}
+
+void BleAdvertisingScheduler::startPairing() {
+    clearPeer();  // Bonds were just cleared; never direct at the old host
+
+    taskENTER_CRITICAL(&advMux);
+    stoppedByUser = false;
+    pairing = true;
+    taskEXIT_CRITICAL(&advMux);
+
+    startSchedule(false, BLE_ADV_PAIRING_FAST_MS);
+}
+
+void BleAdvertisingScheduler::stop() {
+    taskENTER_CRITICAL(&advMux);
+    stoppedByUser = true;
+    pairing = false;
+    taskEXIT_CRITICAL(&advMux);
+
+    enterPhase(BleAdvertisingPhase::OFF);
+}
+
+void BleAdvertisingScheduler::clearPeer() {
+    rtcPeer.magic = 0;
+}
+
+void BleAdvertisingScheduler::poll() {
+    uint32_t now = millis();
+
+    taskENTER_CRITICAL(&advMux);
+    BleAdvertisingPhase current = phase;
+    uint32_t elapsed = now - phaseStartMs;
+    uint32_t fastMs = fastWindowMs;
+    taskEXIT_CRITICAL(&advMux);
+
+    BleAdvertisingPhase next = current;
+    if (current == BleAdvertisingPhase::DIRECTED && elapsed >= BLE_ADV_DIRECTED_MS) {
+        next = BleAdvertisingPhase::FAST;
+    } else if (current == BleAdvertisingPhase::FAST && elapsed >= fastMs) {
+        next = BleAdvertisingPhase::SLOW;
+    }
+
+    if (next != current && !bleKeyboard->isConnected()) {
+        enterPhase(next);
+    }
+}
+
+BleAdvertisingPhase BleAdvertisingScheduler::getPhase() const {
+    taskENTER_CRITICAL(&advMux);
+    BleAdvertisingPhase current = phase;
+    taskEXIT_CRITICAL(&advMux);
+    return current;
+}
+
+BleAdvertisingStats BleAdvertisingScheduler::getStats() const {
+    taskENTER_CRITICAL(&advMux);
+    BleAdvertisingStats snapshot = stats;
+    taskEXIT_CRITICAL(&advMux);
+    return snapshot;
+}
+
+void BleAdvertisingScheduler::logStats() const {
+    [[maybe_unused]] BleAdvertisingStats s = getStats();
+    LOG_INFO(TAG, "phase=%s wakeToConnected=%lums lastReconnect=%lums directed=%u (%s)",
+             bleAdvertisingPhaseToString(getPhase()), s.wakeToConnectedMs, s.lastReconnectMs,
+             s.directedAttempts, s.wokeFromSleep ? "wake" : "cold boot");
+}
+
+void BleAdvertisingScheduler::startSchedule(bool tryDirected, uint32_t fastMs) {
+    taskENTER_CRITICAL(&advMux);
+    fastWindowMs = fastMs;
+    advertisingStartMs = millis();
+    taskEXIT_CRITICAL(&advMux);
+
+#ifdef USE_NIMBLE
+    enterPhase(tryDirected ? BleAdvertisingPhase::DIRECTED : BleAdvertisingPhase::FAST);
+#else
+    (void)tryDirected;  // Directed advertising needs NimBLE
+    enterPhase(BleAdvertisingPhase::FAST);
+#endif
+}
+
+void BleAdvertisingScheduler::enterPhase(BleAdvertisingPhase next) {
+    taskENTER_CRITICAL(&advMux);
+    phase = next;
+    phaseStartMs = millis();
+    if (next == BleAdvertisingPhase::DIRECTED) {
+        stats.directedAttempts++;
+    }
+    taskEXIT_CRITICAL(&advMux);
+
+#ifdef USE_NIMBLE
+    NimBLEAdvertising* advertising = NimBLEDevice::getAdvertising();
+    advertising->stop();
+
+    switch (next) {
+        case BleAdvertisingPhase::DIRECTED: {
+            NimBLEAddress peer(rtcPeer.address, rtcPeer.type);
+            advertising->start(BLE_ADV_DIRECTED_MS, &peer);
+            break;
+        }
+        case BleAdvertisingPhase::FAST:
+            advertising->setMinInterval(BLE_ADV_FAST_MIN_INTERVAL);
+            advertising->setMaxInterval(BLE_ADV_FAST_MAX_INTERVAL);
+            advertising->start();
+            break;
+        case BleAdvertisingPhase::SLOW:
+            advertising->setMinInterval(BLE_ADV_SLOW_MIN_INTERVAL);
+            advertising->setMaxInterval(BLE_ADV_SLOW_MAX_INTERVAL);
+            advertising->start();
+            break;
+        case BleAdvertisingPhase::OFF:
+            break;
+    }
+#else
+    // Library advertising only: no interval or directed control
+    if (next == BleAdvertisingPhase::OFF) {
+        bleKeyboard->stopAdvertising();
+    } else if (next != BleAdvertisingPhase::SLOW) {
+        bleKeyboard->startAdvertising();
+    }
+#endif
+
+    LOG_DEBUG(TAG, "Advertising phase: %s", bleAdvertisingPhaseToString(next));
+}
+
+bool BleAdvertisingScheduler::hasPeer() const {
+    return rtcPeer.magic == RTC_PEER_MAGIC;
+}
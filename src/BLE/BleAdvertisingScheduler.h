@@ -0,0 +1,90 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "BleKeyboard.h"
+#include "Enum/BleAdvertisingPhaseEnum.h"
+
+/**
+ * @brief Advertising timing counters
+ */
+struct BleAdvertisingStats {
+    uint32_t wakeToConnectedMs;  ///< Boot/wake to first connection (0 until connected)
+    uint32_t lastReconnectMs;    ///< Advertising start to connection, most recent link
+    uint32_t directedAttempts;   ///< Directed advertising windows started
+    bool wokeFromSleep;          ///< Boot was a deep-sleep wake
+};
+
+/**
+ * @brief Wake-aware advertising schedule
+ *
+ * Replaces the library's fixed advertising with phases driven by poll():
+ *   DIRECTED (last bonded peer, BLE_ADV_DIRECTED_MS) -> FAST -> SLOW
+ * The last peer's identity address is kept in RTC memory, so after a
+ * deep-sleep wake the host is asked to reconnect at once rather than
+ * finding the device by scanning. Pairing starts at FAST and falls back
+ * to SLOW after BLE_ADV_PAIRING_FAST_MS.
+ *
+ * Directed advertising and interval control need NimBLE (USE_NIMBLE);
+ * other stacks fall back to the library's own advertising.
+ */
+class BleAdvertisingScheduler {
+public:
+    explicit BleAdvertisingScheduler(BleKeyboard* keyboard);
+
+    /**
+     * @brief Start the schedule after BleKeyboard::begin()
+     * @param wakingFromSleep true when booting from a deep-sleep wake
+     */
+    void begin(bool wakingFromSleep);
+
+    /**
+     * @brief Link up: remember the peer, stop the schedule, record timing
+     */
+    void onConnect();
+
+    /**
+     * @brief Link lost: advertise again, directed first
+     */
+    void onDisconnect();
+
+    /**
+     * @brief Pairing requested: undirected FAST, then SLOW after a timeout
+     */
+    void startPairing();
+
+    /**
+     * @brief Stop advertising and keep it stopped until begin/startPairing
+     */
+    void stop();
+
+    /**
+     * @brief Forget the remembered peer (bonds were cleared)
+     */
+    void clearPeer();
+
+    /**
+     * @brief Advance the schedule (call periodically)
+     */
+    void poll();
+
+    BleAdvertisingPhase getPhase() const;
+    BleAdvertisingStats getStats() const;
+    void logStats() const;
+
+private:
+    BleKeyboard* bleKeyboard;
+
+    BleAdvertisingPhase phase;
+    uint32_t phaseStartMs;
+    uint32_t fastWindowMs;        ///< FAST duration for the current schedule
+    uint32_t advertisingStartMs;  ///< Start of the current schedule, for reconnect timing
+    bool stoppedByUser;
+    bool pairing;                 ///< Pairing schedule running; a disconnect must not replace it
+    bool everConnected;
+    BleAdvertisingStats stats;
+    mutable portMUX_TYPE advMux = portMUX_INITIALIZER_UNLOCKED;
+
+    void startSchedule(bool tryDirected, uint32_t fastMs);
+    void enterPhase(BleAdvertisingPhase next);
+    bool hasPeer() const;
+};
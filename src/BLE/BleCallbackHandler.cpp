@@ -3,8 +3,9 @@
 #include "Config/log_config.h"
 #include "state/HardwareState.h"
 #include "state/AppState.h"
+#include "Event/Bus/EventBus.h"
+#include "BleAdvertisingScheduler.h"
 
-extern HardwareState hardwareState;
 extern AppState appState;
 
 namespace BleCallbackHandler {
@@ -13,8 +14,10 @@ void handleConnect(QueueHandle_t displayQueue) {
     LOG_INFO("BleCallbackHandler", "BLE device connected");
 
     // Update global hardware state
-    hardwareState.bleState.isConnected = true;
-    hardwareState.bleState.isPairingMode = false;
+    hardwareState.update([](HardwareState& state) {
+        state.bleState.isConnected = true;
+        state.bleState.isPairingMode = false;
+    });
 
     // Stop BT flash timer (pairing complete)
     if (appState.btFlashTimer != nullptr) {
@@ -32,10 +35,9 @@ void handleConnect(QueueHandle_t displayQueue) {
     }
 
     // Update status screen with new BT state
-    DisplayRequest normalModeReq;
-    normalModeReq.type = DisplayRequestType::DRAW_NORMAL_MODE;
-    normalModeReq.data.normalMode.hwState = hardwareState;
-    xQueueSend(displayQueue, &normalModeReq, pdMS_TO_TICKS(10));
+    if (appState.eventBus != nullptr) {
+        appState.eventBus->publishStateChanged(StateChange::BLE, EventSource::BLE);
+    }
 
     // NOTE: Menu does NOT exit on connection (user stays in menu)
 }
@@ -48,14 +50,16 @@ void handleDisconnect(int reason, QueueHandle_t displayQueue, BleKeyboard* bleKe
     // but host still has old pairing keys
     const int BLE_PAIRING_CONFLICT_REASON = 531;
 
-    if (hardwareState.bleState.isPairingMode && reason == BLE_PAIRING_CONFLICT_REASON) {
+    if (hardwareState.read().bleState.isPairingMode && reason == BLE_PAIRING_CONFLICT_REASON) {
         LOG_INFO("BleCallbackHandler", "Pairing conflict detected - host tried encrypted reconnect after bond clearing");
 
         // Stop advertising to prevent battery-draining reconnect loop
-        if (bleKeyboard) {
+        if (appState.advertisingScheduler != nullptr) {
+            appState.advertisingScheduler->stop();
+        } else if (bleKeyboard) {
             bleKeyboard->stopAdvertising();
         }
-        hardwareState.bleState.isPairingMode = false;
+        hardwareState.update([](HardwareState& state) { state.bleState.isPairingMode = false; });
 
         // Stop BT flash timer (pairing aborted due to conflict)
         if (appState.btFlashTimer != nullptr) {
@@ -75,8 +79,10 @@ void handleDisconnect(int reason, QueueHandle_t displayQueue, BleKeyboard* bleKe
     }
 
     // Update global hardware state
-    hardwareState.bleState.isConnected = false;
-    hardwareState.bleState.isPairingMode = false;
+    hardwareState.update([](HardwareState& state) {
+        state.bleState.isConnected = false;
+        state.bleState.isPairingMode = false;
+    });
 
     // Stop BT flash timer (if it was running)
     if (appState.btFlashTimer != nullptr) {
@@ -94,19 +100,16 @@ void handleDisconnect(int reason, QueueHandle_t displayQueue, BleKeyboard* bleKe
     }
 
     // Update status screen with new BT state
-    DisplayRequest normalModeReq;
-    normalModeReq.type = DisplayRequestType::DRAW_NORMAL_MODE;
-    normalModeReq.data.normalMode.hwState = hardwareState;
-    xQueueSend(displayQueue, &normalModeReq, pdMS_TO_TICKS(10));
+    if (appState.eventBus != nullptr) {
+        appState.eventBus->publishStateChanged(StateChange::BLE, EventSource::BLE);
+    }
 }
 
 void btFlashTimerCallback(TimerHandle_t xTimer) {
     // Only refresh display if in pairing mode
-    if (hardwareState.bleState.isPairingMode && appState.displayRequestQueue != nullptr) {
-        DisplayRequest normalModeReq;
-        normalModeReq.type = DisplayRequestType::DRAW_NORMAL_MODE;
-        normalModeReq.data.normalMode.hwState = hardwareState;
-        xQueueSend(appState.displayRequestQueue, &normalModeReq, 0); // Non-blocking send
+    if (hardwareState.read().bleState.isPairingMode && appState.eventBus != nullptr) {
+        // BACKGROUND: a missed animation frame is harmless, never crowd out real updates
+        appState.eventBus->publishStateChanged(StateChange::REFRESH, EventSource::BLE, EventPriority::BACKGROUND);
     }
 }
 
@@ -22,7 +22,8 @@ namespace BleCallbackHandler {
      * @brief Handle BLE device connection
      *
      * Called when a host device successfully connects.
-     * Updates global hardwareState and sends connection status to display.
+     * Updates global hardwareState, sends connection status to display
+     * and publishes STATE_CHANGED so the status screen is redrawn.
      *
      * @param displayQueue Queue for sending display requests
      */
@@ -46,7 +47,7 @@ namespace BleCallbackHandler {
     /**
      * @brief Timer callback for BT icon flashing animation
      *
-     * Periodically sends DRAW_NORMAL_MODE requests while in pairing mode
+     * Periodically publishes STATE_CHANGED (REFRESH) while in pairing mode
      * to create flashing animation. Timer runs at 500ms period (1Hz blink rate).
      *
      * @param xTimer Timer handle (unused)
@@ -1,6 +1,7 @@
 #include "BleKeyboardService.h"
 #include "BleKeyboard.h"
 #include "Config/log_config.h"
+#include "System/LatencyTrace.h"
 
 // Internal mapping structure (implementation detail, not exposed in header)
 struct MediaKeyAction {
@@ -9,19 +10,20 @@ struct MediaKeyAction {
     const char* displayName;
     const MediaKeyReport* mediaKey;
     const char* confirmMsg;
+    bool repeatable;  // Re-sent while the button is held
 };
 
 // Single source of truth for button actions
 // To add new action: append one line here, rebuild - that's it!
 static const MediaKeyAction MEDIA_KEY_ACTIONS[] = {
-    { 0, "NONE",         "None",           nullptr,                      "Button Cleared" },
-    { 1, "PLAY_PAUSE",   "Play/Pause",     &KEY_MEDIA_PLAY_PAUSE,        "Play/Pause Assigned" },
-    { 2, "NEXT",         "Next Track",     &KEY_MEDIA_NEXT_TRACK,        "Next Track Assigned" },
-    { 3, "PREVIOUS",     "Previous Track", &KEY_MEDIA_PREVIOUS_TRACK,    "Previous Track Assigned" },
-    { 4, "MUTE",         "Mute",           &KEY_MEDIA_MUTE,              "Mute Assigned" },
-    { 5, "VOLUME_UP",    "Volume Up",      &KEY_MEDIA_VOLUME_UP,         "Volume Up Assigned" },
-    { 6, "VOLUME_DOWN",  "Volume Down",    &KEY_MEDIA_VOLUME_DOWN,       "Volume Down Assigned" },
-    { 7, "STOP",         "Stop",           &KEY_MEDIA_STOP,              "Stop Assigned" }
+    { 0, "NONE",         "None",           nullptr,                      "Button Cleared",          false },
+    { 1, "PLAY_PAUSE",   "Play/Pause",     &KEY_MEDIA_PLAY_PAUSE,        "Play/Pause Assigned",     false },
+    { 2, "NEXT",         "Next Track",     &KEY_MEDIA_NEXT_TRACK,        "Next Track Assigned",     false },
+    { 3, "PREVIOUS",     "Previous Track", &KEY_MEDIA_PREVIOUS_TRACK,    "Previous Track Assigned", false },
+    { 4, "MUTE",         "Mute",           &KEY_MEDIA_MUTE,              "Mute Assigned",           false },
+    { 5, "VOLUME_UP",    "Volume Up",      &KEY_MEDIA_VOLUME_UP,         "Volume Up Assigned",      true },
+    { 6, "VOLUME_DOWN",  "Volume Down",    &KEY_MEDIA_VOLUME_DOWN,       "Volume Down Assigned",    true },
+    { 7, "STOP",         "Stop",           &KEY_MEDIA_STOP,              "Stop Assigned",           false }
 };
 
 static constexpr uint8_t ACTION_COUNT = sizeof(MEDIA_KEY_ACTIONS) / sizeof(MediaKeyAction);
@@ -31,6 +33,59 @@ static constexpr uint8_t ACTION_COUNT = sizeof(MEDIA_KEY_ACTIONS) / sizeof(Media
 static_assert(ACTION_COUNT == BUTTON_ACTION_COUNT,
               "ACTION_COUNT mismatch - update BUTTON_ACTION_COUNT in BleKeyboardService.h");
 
+static constexpr uint8_t LIBRARY_MODIFIER_BASE = 0x80;  // KEY_LEFT_CTRL
+static constexpr uint8_t LIBRARY_USAGE_OFFSET = 136;    // KEY_* constants are HID usage + 136
+static constexpr uint8_t SHIFT_FLAG = 0x80;             // asciiToUsage(): character needs Shift
+static constexpr uint8_t LEFT_SHIFT_BIT = 1 << (KEY_LEFT_SHIFT - LIBRARY_MODIFIER_BASE);
+
+// Helper: US layout ASCII -> HID usage, same table BleKeyboard::press() uses (0 = no key)
+static uint8_t asciiToUsage(uint8_t c) {
+    if (c >= 'a' && c <= 'z') return 0x04 + (c - 'a');
+    if (c >= 'A' && c <= 'Z') return (0x04 + (c - 'A')) | SHIFT_FLAG;
+    if (c >= '1' && c <= '9') return 0x1E + (c - '1');
+
+    switch (c) {
+        case '0':  return 0x27;
+        case '\b': return 0x2A;
+        case '\t': return 0x2B;
+        case '\n': return 0x28;
+        case ' ':  return 0x2C;
+        case '!':  return 0x1E | SHIFT_FLAG;
+        case '"':  return 0x34 | SHIFT_FLAG;
+        case '#':  return 0x20 | SHIFT_FLAG;
+        case '$':  return 0x21 | SHIFT_FLAG;
+        case '%':  return 0x22 | SHIFT_FLAG;
+        case '&':  return 0x24 | SHIFT_FLAG;
+        case '\'': return 0x34;
+        case '(':  return 0x26 | SHIFT_FLAG;
+        case ')':  return 0x27 | SHIFT_FLAG;
+        case '*':  return 0x25 | SHIFT_FLAG;
+        case '+':  return 0x2E | SHIFT_FLAG;
+        case ',':  return 0x36;
+        case '-':  return 0x2D;
+        case '.':  return 0x37;
+        case '/':  return 0x38;
+        case ':':  return 0x33 | SHIFT_FLAG;
+        case ';':  return 0x33;
+        case '<':  return 0x36 | SHIFT_FLAG;
+        case '=':  return 0x2E;
+        case '>':  return 0x37 | SHIFT_FLAG;
+        case '?':  return 0x38 | SHIFT_FLAG;
+        case '@':  return 0x1F | SHIFT_FLAG;
+        case '[':  return 0x2F;
+        case '\\': return 0x31;
+        case ']':  return 0x30;
+        case '^':  return 0x23 | SHIFT_FLAG;
+        case '_':  return 0x2D | SHIFT_FLAG;
+        case '`':  return 0x35;
+        case '{':  return 0x2F | SHIFT_FLAG;
+        case '|':  return 0x31 | SHIFT_FLAG;
+        case '}':  return 0x30 | SHIFT_FLAG;
+        case '~':  return 0x35 | SHIFT_FLAG;
+        default:   return 0;
+    }
+}
+
 // Helper: Find action by ID
 static const MediaKeyAction* findActionById(ButtonActionId id) {
     for (uint8_t i = 0; i < ACTION_COUNT; i++) {
@@ -41,16 +96,16 @@ static const MediaKeyAction* findActionById(ButtonActionId id) {
     return nullptr;
 }
 
-BleKeyboardService::BleKeyboardService(BleKeyboard* keyboard)
-    : bleKeyboard(keyboard) {
-    if (!keyboard) {
-        LOG_ERROR("BleKeyboardService", "Constructor called with null BleKeyboard");
+BleKeyboardService::BleKeyboardService(BleKeyboard* keyboard, HidOutputTask* hidOutput)
+    : bleKeyboard(keyboard), hidOutput(hidOutput) {
+    if (!keyboard || !hidOutput) {
+        LOG_ERROR("BleKeyboardService", "Constructor called with null BleKeyboard or HidOutputTask");
     }
 }
 
 bool BleKeyboardService::executeMediaKey(ButtonActionId actionId) {
-    if (!bleKeyboard) {
-        LOG_ERROR("BleKeyboardService", "BleKeyboard is null");
+    if (!bleKeyboard || !hidOutput) {
+        LOG_ERROR("BleKeyboardService", "BleKeyboard or HidOutputTask is null");
         return false;
     }
 
@@ -71,12 +126,61 @@ bool BleKeyboardService::executeMediaKey(ButtonActionId actionId) {
         return true;  // Not an error, just no-op
     }
 
-    // Execute the media key
-    bleKeyboard->write(*action->mediaKey);
+    // Queue the media key for the HID output task
+    if (!hidOutput->enqueueConsumerKey(*action->mediaKey, 1, TRACE_ACTIVE_ORIGIN())) {
+        LOG_DEBUG("BleKeyboardService", "HID output queue full, dropped %s", action->identifier);
+        return false;
+    }
     LOG_INFO("BleKeyboardService", "Executed: %s", action->displayName);
     return true;
 }
 
+bool BleKeyboardService::composeKeyReport(KeyReport& report, uint8_t modifiers,
+                                          const uint8_t* keys, uint8_t keyCount) {
+    report = KeyReport{};
+    report.modifiers = modifiers;
+
+    uint8_t slot = 0;
+    for (uint8_t i = 0; i < keyCount; i++) {
+        uint8_t key = keys[i];
+        uint8_t usage;
+
+        if (key >= LIBRARY_USAGE_OFFSET) {
+            usage = key - LIBRARY_USAGE_OFFSET;
+        } else if (key >= LIBRARY_MODIFIER_BASE) {
+            report.modifiers |= 1 << (key - LIBRARY_MODIFIER_BASE);
+            continue;  // Modifier keys live in the bitmask, not in a key slot
+        } else {
+            usage = asciiToUsage(key);
+            if (usage & SHIFT_FLAG) {
+                report.modifiers |= LEFT_SHIFT_BIT;
+                usage &= ~SHIFT_FLAG;
+            }
+        }
+
+        if (usage == 0) {
+            LOG_ERROR("BleKeyboardService", "Key 0x%02X has no HID usage", key);
+            return false;
+        }
+
+        // Same key twice is one slot; the host cannot see it pressed twice
+        bool duplicate = false;
+        for (uint8_t j = 0; j < slot; j++) {
+            duplicate = duplicate || report.keys[j] == usage;
+        }
+        if (duplicate) {
+            continue;
+        }
+
+        if (slot == MAX_REPORT_KEYS) {
+            LOG_ERROR("BleKeyboardService", "More than %d keys in one report", MAX_REPORT_KEYS);
+            return false;
+        }
+        report.keys[slot++] = usage;
+    }
+    return true;
+}
+
 bool BleKeyboardService::isConnected() const {
     return bleKeyboard && bleKeyboard->isConnected();
 }
@@ -111,3 +215,8 @@ ButtonActionId BleKeyboardService::getActionIdByIndex(uint8_t index) const {
     }
     return MEDIA_KEY_ACTIONS[index].id;
 }
+
+bool BleKeyboardService::isRepeatable(ButtonActionId actionId) const {
+    const MediaKeyAction* action = findActionById(actionId);
+    return action ? action->repeatable : false;
+}
@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include "BleKeyboard.h"
+#include "HidOutputTask.h"
 
 using ButtonActionId = uint8_t;
 
@@ -13,6 +14,8 @@ constexpr uint8_t BUTTON_ACTION_COUNT = 8;
  * @brief Service layer for BLE keyboard operations
  *
  * Encapsulates media key actions and BLE keyboard execution.
+ * Key presses are queued on the HidOutputTask rather than sent inline;
+ * keyboard chords are queued as whole reports built by composeKeyReport().
  * Maintains single source of truth for available button actions.
  *
  * Adding new media key actions:
@@ -22,15 +25,35 @@ constexpr uint8_t BUTTON_ACTION_COUNT = 8;
  */
 class BleKeyboardService {
 public:
-    explicit BleKeyboardService(BleKeyboard* keyboard);
+    static constexpr uint8_t MAX_REPORT_KEYS = 6;  ///< Key slots in a boot keyboard report
+
+    BleKeyboardService(BleKeyboard* keyboard, HidOutputTask* hidOutput);
 
     /**
      * @brief Execute a media key action by ID
      * @param actionId Button action ID (0 = NONE, 1+ = media keys)
-     * @return true if action executed successfully, false if invalid ID or no key assigned
+     * @return true if action was queued, false if invalid ID, BLE disconnected or output queue full
      */
     bool executeMediaKey(ButtonActionId actionId);
 
+    /**
+     * @brief Build a complete boot keyboard report
+     *
+     * Keys use the BleKeyboard::press() encoding: ASCII characters,
+     * KEY_LEFT_CTRL..KEY_RIGHT_GUI (folded into the modifier byte) and
+     * KEY_* constants (HID usage + 136). Characters that need Shift get the
+     * Shift bit added, as press() would.
+     * Sending the report and then an empty one is the whole press/release:
+     * two notifications however many modifiers are held.
+     *
+     * @param report Output report (cleared first)
+     * @param modifiers Modifier bitmask (bit n = keycode 0x80 + n)
+     * @param keys Keys to hold together, library encoding (may be null if keyCount is 0)
+     * @param keyCount Number of keys (at most MAX_REPORT_KEYS)
+     * @return false if a key has no HID usage or more than MAX_REPORT_KEYS keys were given
+     */
+    static bool composeKeyReport(KeyReport& report, uint8_t modifiers, const uint8_t* keys, uint8_t keyCount);
+
     /**
      * @brief Check if BLE keyboard is connected
      * @return true if connected, false otherwise
@@ -71,6 +94,13 @@ public:
      */
     bool isValidActionId(ButtonActionId actionId) const;
 
+    /**
+     * @brief Check if an action should repeat while its button is held
+     * @param actionId Button action ID
+     * @return true for repeatable actions (e.g., volume steps), false otherwise
+     */
+    bool isRepeatable(ButtonActionId actionId) const;
+
     /**
      * @brief Get action ID by index (for menu iteration)
      * @param index Array index (0 to getActionCount()-1)
@@ -80,4 +110,5 @@ public:
 
 private:
     BleKeyboard* bleKeyboard;
+    HidOutputTask* hidOutput;
 };
@@ -0,0 +1,170 @@
+#include "BleLinkManager.h"
+#include "Arduino.h"
+#include "HidOutputTask.h"
+#include "Config/ble_link_config.h"
+#include "Config/log_config.h"
+
+#ifdef USE_NIMBLE
+#include <NimBLEDevice.h>
+#endif
+
+static const char* TAG = "BleLinkManager";
+
+BleLinkManager::BleLinkManager(HidOutputTask* hidOutput)
+    : hidOutput(hidOutput)
+    , profile(BleLinkProfile::ACTIVE)
+    , granted{}
+    , stats{}
+    , connected(false)
+    , requestPending(false)
+    , connectedAtMs(0) {
+}
+
+void BleLinkManager::onConnect() {
+    taskENTER_CRITICAL(&linkMux);
+    connected = true;
+    connectedAtMs = millis();
+    requestPending = true;  // Sent from poll() after BLE_LINK_CONNECT_SETTLE_MS
+    taskEXIT_CRITICAL(&linkMux);
+}
+
+void BleLinkManager::onDisconnect() {
+    taskENTER_CRITICAL(&linkMux);
+    connected = false;
+    requestPending = false;
+    granted = BleLinkParams{};
+    taskEXIT_CRITICAL(&linkMux);
+
+    if (hidOutput) {
+        hidOutput->setReportInterval(HID_OUTPUT_REPORT_INTERVAL_MS);
+    }
+}
+
+void BleLinkManager::onPowerStateChanged(PowerState state) {
+    setProfile(state == PowerState::ACTIVE ? BleLinkProfile::ACTIVE : BleLinkProfile::IDLE);
+}
+
+void BleLinkManager::setProfile(BleLinkProfile next) {
+    // Only record the profile: the caller may be the input path, and NimBLE calls
+    // belong to loop(), which sends it on its next poll()
+    taskENTER_CRITICAL(&linkMux);
+    if (profile != next) {
+        profile = next;
+        requestPending = connected;
+    }
+    taskEXIT_CRITICAL(&linkMux);
+}
+
+void BleLinkManager::poll() {
+    taskENTER_CRITICAL(&linkMux);
+    bool sendNow = requestPending && connected && (millis() - connectedAtMs >= BLE_LINK_CONNECT_SETTLE_MS);
+    if (sendNow) {
+        requestPending = false;
+    }
+    BleLinkProfile requested = profile;
+    bool isConnected = connected;
+    BleLinkParams previous = granted;
+    taskEXIT_CRITICAL(&linkMux);
+
+    if (sendNow) {
+        sendRequest(requested);
+    }
+
+    if (!isConnected) {
+        return;
+    }
+
+    BleLinkParams current;
+    if (!readGranted(current) || current == previous) {
+        return;
+    }
+
+    taskENTER_CRITICAL(&linkMux);
+    granted = current;
+    stats.grantedUpdates++;
+    taskEXIT_CRITICAL(&linkMux);
+
+    LOG_INFO(TAG, "Granted: interval %u.%02u ms, latency %u, timeout %u ms (requested %s)",
+             current.intervalUs() / 1000, (current.intervalUs() % 1000) / 10,
+             current.latency, current.timeout * 10, bleLinkProfileToString(requested));
+
+    // Report pacing follows the interval the host actually granted
+    if (hidOutput && current.interval > 0) {
+        hidOutput->setReportInterval(static_cast<uint16_t>((current.intervalUs() + 999) / 1000));
+    }
+}
+
+bool BleLinkManager::sendRequest(BleLinkProfile requested) {
+#ifdef USE_NIMBLE
+    NimBLEServer* server = NimBLEDevice::getServer();
+    if (server == nullptr || server->getConnectedCount() == 0) {
+        return false;
+    }
+
+    uint16_t handle = server->getPeerInfo(0).getConnHandle();
+    if (requested == BleLinkProfile::ACTIVE) {
+        server->updateConnParams(handle, BLE_LINK_ACTIVE_MIN_INTERVAL, BLE_LINK_ACTIVE_MAX_INTERVAL,
+                                 BLE_LINK_ACTIVE_LATENCY, BLE_LINK_ACTIVE_TIMEOUT);
+    } else {
+        server->updateConnParams(handle, BLE_LINK_IDLE_MIN_INTERVAL, BLE_LINK_IDLE_MAX_INTERVAL,
+                                 BLE_LINK_IDLE_LATENCY, BLE_LINK_IDLE_TIMEOUT);
+    }
+
+    taskENTER_CRITICAL(&linkMux);
+    stats.requests++;
+    taskEXIT_CRITICAL(&linkMux);
+
+    LOG_DEBUG(TAG, "Requested %s connection parameters", bleLinkProfileToString(requested));
+    return true;
+#else
+    (void)requested;
+    return false;
+#endif
+}
+
+bool BleLinkManager::readGranted(BleLinkParams& out) const {
+#ifdef USE_NIMBLE
+    NimBLEServer* server = NimBLEDevice::getServer();
+    if (server == nullptr || server->getConnectedCount() == 0) {
+        return false;
+    }
+
+    NimBLEConnInfo info = server->getPeerInfo(0);
+    out.interval = info.getConnInterval();
+    out.latency = info.getConnLatency();
+    out.timeout = info.getConnTimeout();
+    return true;
+#else
+    (void)out;
+    return false;
+#endif
+}
+
+BleLinkProfile BleLinkManager::getProfile() const {
+    taskENTER_CRITICAL(&linkMux);
+    BleLinkProfile current = profile;
+    taskEXIT_CRITICAL(&linkMux);
+    return current;
+}
+
+BleLinkParams BleLinkManager::getGrantedParams() const {
+    taskENTER_CRITICAL(&linkMux);
+    BleLinkParams current = granted;
+    taskEXIT_CRITICAL(&linkMux);
+    return current;
+}
+
+BleLinkStats BleLinkManager::getStats() const {
+    taskENTER_CRITICAL(&linkMux);
+    BleLinkStats snapshot = stats;
+    taskEXIT_CRITICAL(&linkMux);
+    return snapshot;
+}
+
+void BleLinkManager::logStats() const {
+    [[maybe_unused]] BleLinkStats s = getStats();
+    [[maybe_unused]] BleLinkParams p = getGrantedParams();
+    LOG_INFO(TAG, "profile=%s interval=%u latency=%u timeout=%u requests=%u granted=%u",
+             bleLinkProfileToString(getProfile()), p.interval, p.latency, p.timeout,
+             s.requests, s.grantedUpdates);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "Enum/BleLinkProfileEnum.h"
+#include "Enum/PowerStateEnum.h"
+#include "Type/BleLinkParams.h"
+
+class HidOutputTask;
+
+/**
+ * @brief Counters for connection parameter negotiation
+ */
+struct BleLinkStats {
+    uint32_t requests;        ///< Parameter update requests sent to the host
+    uint32_t grantedUpdates;  ///< Changes observed in the parameters actually in effect
+};
+
+/**
+ * @brief Negotiates BLE connection parameters from the power state
+ *
+ * The host picks the initial parameters; this manager asks for a short
+ * interval while the user is interacting (PowerState::ACTIVE) and a long
+ * interval with slave latency once PowerManager reports IDLE or WARNING.
+ * The host may grant something else, so poll() reads back the parameters
+ * in effect, logs changes and feeds the interval to HidOutputTask pacing.
+ * poll() is also the only place requests are sent, so the NimBLE calls
+ * stay in loop() rather than in the PowerManager caller; a wake to ACTIVE
+ * is requested within one loop() period.
+ *
+ * Requests go through NimBLE (USE_NIMBLE builds). With the Bluedroid
+ * stack the library exposes no connection handle, so the manager only
+ * tracks the requested profile.
+ */
+class BleLinkManager {
+public:
+    /**
+     * @param hidOutput HID output stage whose report pacing follows the granted interval (may be null)
+     */
+    explicit BleLinkManager(HidOutputTask* hidOutput);
+
+    /**
+     * @brief Link established: request the current profile once the link settles
+     */
+    void onConnect();
+
+    /**
+     * @brief Link lost: forget granted parameters
+     */
+    void onDisconnect();
+
+    /**
+     * @brief PowerManager listener: pick the profile for the new state
+     *
+     * Never calls into the BLE stack; the request is sent by the next poll().
+     */
+    void onPowerStateChanged(PowerState state);
+
+    /**
+     * @brief Send deferred requests and read back granted parameters
+     *
+     * Call periodically from a non-time-critical task.
+     */
+    void poll();
+
+    BleLinkProfile getProfile() const;
+    BleLinkParams getGrantedParams() const;
+    BleLinkStats getStats() const;
+    void logStats() const;
+
+private:
+    HidOutputTask* hidOutput;
+
+    BleLinkProfile profile;
+    BleLinkParams granted;
+    BleLinkStats stats;
+    bool connected;
+    bool requestPending;       ///< Profile changed (or new link) and not yet requested by poll()
+    uint32_t connectedAtMs;
+    mutable portMUX_TYPE linkMux = portMUX_INITIALIZER_UNLOCKED;
+
+    void setProfile(BleLinkProfile next);
+    bool sendRequest(BleLinkProfile requested);
+    bool readGranted(BleLinkParams& out) const;
+};
@@ -0,0 +1,438 @@
+#include "HidOutputTask.h"
+#include <string.h>
+#include "Config/log_config.h"
+#include "System/LatencyTrace.h"
+
+static const char* TAG = "HidOutputTask";
+
+static constexpr int16_t WHEEL_REPORT_MAX = 127;
+
+static int16_t clampWheel(int16_t value) {
+    if (value > WHEEL_REPORT_MAX) return WHEEL_REPORT_MAX;
+    if (value < -WHEEL_REPORT_MAX) return -WHEEL_REPORT_MAX;
+    return value;
+}
+
+// Opposite directions never merge, so a reversal reaches the host in order
+static bool sameDirection(int16_t a, int16_t b) {
+    return a == 0 || b == 0 || (a < 0) == (b < 0);
+}
+
+HidOutputTask::HidOutputTask(BleKeyboard* keyboard)
+    : bleKeyboard(keyboard), slots{}, stats{} {}
+
+bool HidOutputTask::start(uint32_t stackSize, UBaseType_t priority) {
+    if (!bleKeyboard) {
+        LOG_ERROR(TAG, "Cannot start: BleKeyboard is null");
+        return false;
+    }
+
+    if (!notEmpty) {
+        notEmpty = xSemaphoreCreateBinary();
+    }
+    if (!notEmpty) {
+        LOG_ERROR(TAG, "Failed to create semaphore");
+        return false;
+    }
+
+    if (xTaskCreate(taskEntry, "HidOutputTask", stackSize, this, priority, &taskHandle) != pdPASS) {
+        LOG_ERROR(TAG, "Failed to create task");
+        return false;
+    }
+
+    LOG_INFO(TAG, "Started (report interval %u ms)", reportIntervalMs);
+    return true;
+}
+
+bool HidOutputTask::enqueueWheel(int16_t wheel, int16_t hWheel, uint64_t originUs, uint8_t modifiers) {
+    if (wheel == 0 && hWheel == 0) {
+        return true;
+    }
+
+    HidIntent intent = {};
+    intent.type = HidIntentType::WHEEL;
+    intent.modifiers = modifiers;
+    intent.originUs = originUs;
+
+    // Split deltas that do not fit one report; enqueue() merges what it can
+    while (wheel != 0 || hWheel != 0) {
+        int16_t v = clampWheel(wheel);
+        int16_t h = clampWheel(hWheel);
+        intent.wheel = static_cast<int8_t>(v);
+        intent.hWheel = static_cast<int8_t>(h);
+        if (!enqueue(intent)) {
+            return false;
+        }
+        wheel -= v;
+        hWheel -= h;
+    }
+    return true;
+}
+
+bool HidOutputTask::enqueueConsumerKey(const MediaKeyReport key, uint8_t repeat, uint64_t originUs,
+                                       uint8_t cycleIntervalMs) {
+    if (repeat == 0) {
+        return true;
+    }
+
+    HidIntent intent = {};
+    intent.type = HidIntentType::CONSUMER_KEY;
+    intent.repeat = repeat;
+    memcpy(intent.mediaKey, key, sizeof(intent.mediaKey));
+    intent.cycleIntervalMs = cycleIntervalMs;
+    intent.originUs = originUs;
+    return enqueue(intent);
+}
+
+uint16_t HidOutputTask::cancelConsumerKey(const MediaKeyReport key) {
+    uint16_t discarded = 0;
+
+    taskENTER_CRITICAL(&queueMux);
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        HidIntent& intent = at(i);
+        if (intent.type == HidIntentType::CONSUMER_KEY &&
+            memcmp(intent.mediaKey, key, sizeof(intent.mediaKey)) == 0) {
+            discarded += intent.repeat;
+            continue;
+        }
+        if (kept != i) {
+            at(kept) = intent;
+        }
+        kept++;
+    }
+    count = kept;
+    stats.cancelled += discarded;
+
+    if (consumerInFlight && memcmp(inFlightKey, key, sizeof(inFlightKey)) == 0) {
+        cancelPending = true;
+    }
+    taskEXIT_CRITICAL(&queueMux);
+
+    return discarded;
+}
+
+bool HidOutputTask::enqueueKeyChord(const KeyReport& report, uint8_t repeat, uint64_t originUs) {
+    if (repeat == 0) {
+        return true;
+    }
+
+    HidIntent intent = {};
+    intent.type = HidIntentType::KEY_CHORD;
+    intent.repeat = repeat;
+    intent.modifiers = report.modifiers;
+    memcpy(intent.keys, report.keys, sizeof(intent.keys));
+    intent.originUs = originUs;
+    return enqueue(intent);
+}
+
+bool HidOutputTask::enqueueKeyState(const KeyReport& report, uint64_t originUs) {
+    HidIntent intent = {};
+    intent.type = HidIntentType::KEY_STATE;
+    intent.repeat = 1;
+    intent.modifiers = report.modifiers;
+    memcpy(intent.keys, report.keys, sizeof(intent.keys));
+    intent.originUs = originUs;
+    return enqueue(intent);
+}
+
+void HidOutputTask::setReportInterval(uint16_t intervalMs) {
+    reportIntervalMs = intervalMs < HID_OUTPUT_MIN_REPORT_INTERVAL_MS ? HID_OUTPUT_MIN_REPORT_INTERVAL_MS : intervalMs;
+    LOG_DEBUG(TAG, "Report interval set to %u ms", reportIntervalMs);
+}
+
+bool HidOutputTask::isConnected() const {
+    return bleKeyboard && bleKeyboard->isConnected();
+}
+
+uint8_t HidOutputTask::getDepth() const {
+    taskENTER_CRITICAL(&queueMux);
+    uint8_t depth = count;
+    taskEXIT_CRITICAL(&queueMux);
+    return depth;
+}
+
+HidOutputStats HidOutputTask::getStats() const {
+    taskENTER_CRITICAL(&queueMux);
+    HidOutputStats snapshot = stats;
+    snapshot.depth = count;
+    taskEXIT_CRITICAL(&queueMux);
+    return snapshot;
+}
+
+void HidOutputTask::logStats() const {
+    [[maybe_unused]] HidOutputStats s = getStats();
+    LOG_INFO(TAG, "enqueued=%u merged=%u dropped=%u sent=%u reports=%u notifyFail=%u cancelled=%u depth=%u/%u (max %u)",
+             static_cast<unsigned>(s.enqueued), static_cast<unsigned>(s.merged), static_cast<unsigned>(s.dropped),
+             static_cast<unsigned>(s.sent), static_cast<unsigned>(s.reports), static_cast<unsigned>(s.notifyFailures),
+             static_cast<unsigned>(s.cancelled), s.depth, static_cast<unsigned>(CAPACITY), s.maxDepth);
+}
+
+bool HidOutputTask::enqueue(const HidIntent& intent) {
+    // Reports queued while disconnected would fire unexpectedly on reconnect
+    if (!isConnected()) {
+        taskENTER_CRITICAL(&queueMux);
+        stats.dropped++;
+        taskEXIT_CRITICAL(&queueMux);
+        return false;
+    }
+
+    HidIntent pending = intent;
+    bool stored = true;
+
+    taskENTER_CRITICAL(&queueMux);
+    if (tryMergeIntoTail(pending)) {
+        stats.merged++;
+        stats.enqueued++;
+    } else if (count == CAPACITY) {
+        stats.dropped++;
+        stored = false;
+    } else {
+        at(count) = pending;
+        count++;
+        stats.enqueued++;
+        if (count > stats.maxDepth) {
+            stats.maxDepth = count;
+        }
+    }
+    taskEXIT_CRITICAL(&queueMux);
+
+    if (stored && notEmpty) {
+        xSemaphoreGive(notEmpty);
+    }
+    return stored;
+}
+
+bool HidOutputTask::tryMergeIntoTail(HidIntent& intent) {
+    if (count == 0) {
+        return false;
+    }
+
+    HidIntent& tail = at(count - 1);
+    if (tail.type != intent.type) {
+        return false;
+    }
+
+    switch (intent.type) {
+        case HidIntentType::WHEEL: {
+            if (tail.modifiers != intent.modifiers ||
+                !sameDirection(tail.wheel, intent.wheel) || !sameDirection(tail.hWheel, intent.hWheel)) {
+                return false;
+            }
+            int16_t v = tail.wheel + intent.wheel;
+            int16_t h = tail.hWheel + intent.hWheel;
+            // Saturate the tail; whatever does not fit stays in the intent for a new slot
+            tail.wheel = static_cast<int8_t>(clampWheel(v));
+            tail.hWheel = static_cast<int8_t>(clampWheel(h));
+            intent.wheel = static_cast<int8_t>(v - tail.wheel);
+            intent.hWheel = static_cast<int8_t>(h - tail.hWheel);
+            return intent.wheel == 0 && intent.hWheel == 0;
+        }
+
+        case HidIntentType::CONSUMER_KEY:
+            if (memcmp(tail.mediaKey, intent.mediaKey, sizeof(tail.mediaKey)) != 0 ||
+                tail.cycleIntervalMs != intent.cycleIntervalMs ||
+                tail.repeat > UINT8_MAX - intent.repeat) {
+                return false;
+            }
+            tail.repeat += intent.repeat;
+            return true;
+
+        case HidIntentType::KEY_CHORD:
+        case HidIntentType::KEY_STATE:
+            return false;
+    }
+    return false;
+}
+
+bool HidOutputTask::waitForIntent() {
+    while (true) {
+        taskENTER_CRITICAL(&queueMux);
+        bool hasIntent = count > 0;
+        taskEXIT_CRITICAL(&queueMux);
+        if (hasIntent) {
+            return true;
+        }
+
+        // Binary semaphore may carry a stale give; loop re-checks the ring
+        if (xSemaphoreTake(notEmpty, portMAX_DELAY) != pdTRUE) {
+            return false;
+        }
+    }
+}
+
+bool HidOutputTask::takeOldest(HidIntent& out) {
+    taskENTER_CRITICAL(&queueMux);
+    if (count == 0) {
+        taskEXIT_CRITICAL(&queueMux);
+        return false;
+    }
+    out = at(0);
+    head = (head + 1) % CAPACITY;
+    count--;
+    consumerInFlight = out.type == HidIntentType::CONSUMER_KEY;
+    memcpy(inFlightKey, out.mediaKey, sizeof(inFlightKey));
+    cancelPending = false;
+    taskEXIT_CRITICAL(&queueMux);
+    return true;
+}
+
+bool HidOutputTask::takeCancel() {
+    taskENTER_CRITICAL(&queueMux);
+    bool cancel = cancelPending;
+    cancelPending = false;
+    taskEXIT_CRITICAL(&queueMux);
+    return cancel;
+}
+
+void HidOutputTask::waitForReportSlot(uint16_t minIntervalMs) {
+    uint16_t intervalMs = minIntervalMs > reportIntervalMs ? minIntervalMs : reportIntervalMs;
+    TickType_t interval = pdMS_TO_TICKS(intervalMs);
+    TickType_t elapsed = xTaskGetTickCount() - lastReportTick;
+    if (elapsed < interval) {
+        vTaskDelay(interval - elapsed);
+    }
+    lastReportTick = xTaskGetTickCount();
+}
+
+bool HidOutputTask::send(const HidIntent& intent, uint32_t& reports) {
+    if (!bleKeyboard->isConnected()) {
+        heldReport = {};  // The host releases everything when the link drops
+        return false;
+    }
+
+    switch (intent.type) {
+        case HidIntentType::WHEEL: {
+            // Modifiers already held by a macro need no extra reports
+            bool layered = (intent.modifiers & ~heldReport.modifiers) != 0;
+            if (layered) {
+                sendOverHeld(intent.modifiers, nullptr, reports);
+            }
+            bleKeyboard->mouseMove(0, 0, intent.wheel, intent.hWheel);
+            reports++;
+            TRACE_STAMP_ORIGIN(TraceStage::HID_SEND, intent.originUs);
+            if (layered) {
+                sendOverHeld(0, nullptr, reports);
+            }
+            return true;
+        }
+
+        case HidIntentType::CONSUMER_KEY:
+            for (uint8_t i = 0; i < intent.repeat; i++) {
+                if (i > 0) {
+                    waitForReportSlot(intent.cycleIntervalMs);
+                    if (takeCancel()) {
+                        taskENTER_CRITICAL(&queueMux);
+                        stats.cancelled += intent.repeat - i;
+                        taskEXIT_CRITICAL(&queueMux);
+                        return true;
+                    }
+                }
+                if (bleKeyboard->write(intent.mediaKey) == 0) {
+                    return false;
+                }
+                reports += 2;  // write() is a press report and a release report
+                if (i == 0) {
+                    TRACE_STAMP_ORIGIN(TraceStage::HID_SEND, intent.originUs);
+                }
+            }
+            return true;
+
+        case HidIntentType::KEY_CHORD:
+            for (uint8_t i = 0; i < intent.repeat; i++) {
+                if (i > 0) {
+                    waitForReportSlot();
+                    if (!bleKeyboard->isConnected()) {
+                        return false;
+                    }
+                }
+                sendOverHeld(intent.modifiers, intent.keys, reports);
+                if (i == 0) {
+                    TRACE_STAMP_ORIGIN(TraceStage::HID_SEND, intent.originUs);
+                }
+                // Keep the modifiers down between cycles; the last release returns to the held state
+                bool last = i + 1 == intent.repeat;
+                sendOverHeld(last ? 0 : intent.modifiers, nullptr, reports);
+            }
+            return true;
+
+        case HidIntentType::KEY_STATE:
+            heldReport = {};
+            heldReport.modifiers = intent.modifiers;
+            memcpy(heldReport.keys, intent.keys, sizeof(heldReport.keys));
+            sendKeyReport(intent.modifiers, intent.keys, reports);
+            TRACE_STAMP_ORIGIN(TraceStage::HID_SEND, intent.originUs);
+            return true;
+    }
+    return false;
+}
+
+// Whole report in one notification; keys == nullptr sends modifiers only
+void HidOutputTask::sendKeyReport(uint8_t modifiers, const uint8_t* keys, uint32_t& reports) {
+    KeyReport report = {};
+    report.modifiers = modifiers;
+    if (keys != nullptr) {
+        memcpy(report.keys, keys, sizeof(report.keys));
+    }
+    bleKeyboard->sendReport(&report);
+    reports++;
+}
+
+// Held KEY_STATE report with extra modifiers and keys added; keys that do not fit are left out
+void HidOutputTask::sendOverHeld(uint8_t modifiers, const uint8_t* keys, uint32_t& reports) {
+    KeyReport report = heldReport;
+    report.modifiers |= modifiers;
+    if (keys != nullptr) {
+        for (uint8_t i = 0; i < sizeof(report.keys); i++) {
+            if (keys[i] == 0 || memchr(report.keys, keys[i], sizeof(report.keys)) != nullptr) {
+                continue;
+            }
+            uint8_t* slot = static_cast<uint8_t*>(memchr(report.keys, 0, sizeof(report.keys)));
+            if (slot != nullptr) {
+                *slot = keys[i];
+            }
+        }
+    }
+    bleKeyboard->sendReport(&report);
+    reports++;
+}
+
+void HidOutputTask::taskEntry(void* param) {
+    static_cast<HidOutputTask*>(param)->taskLoop();
+}
+
+void HidOutputTask::taskLoop() {
+    while (true) {
+        if (waitForIntent()) {
+            sendNext();
+        }
+    }
+}
+
+bool HidOutputTask::sendNext() {
+    // Pace before dequeuing so input arriving meanwhile merges into the pending intent
+    waitForReportSlot();
+
+    HidIntent intent;
+    if (!takeOldest(intent)) {
+        return false;
+    }
+
+    uint32_t reports = 0;
+    bool delivered = send(intent, reports);
+
+    taskENTER_CRITICAL(&queueMux);
+    consumerInFlight = false;
+    stats.reports += reports;
+    if (delivered) {
+        stats.sent++;
+    } else {
+        stats.notifyFailures++;
+    }
+    taskEXIT_CRITICAL(&queueMux);
+
+    if (!delivered) {
+        LOG_DEBUG(TAG, "Report not delivered (failures: %u)", getStats().notifyFailures);
+    }
+    return true;
+}
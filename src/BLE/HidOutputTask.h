@@ -0,0 +1,157 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "BleKeyboard.h"
+#include "Type/HidIntent.h"
+#include "Config/hid_config.h"
+
+/**
+ * @brief Counters for the HID output stage
+ */
+struct HidOutputStats {
+    uint32_t enqueued;        ///< Intents accepted (including merged ones)
+    uint32_t merged;          ///< Intents folded into a queued intent instead of taking a slot
+    uint32_t dropped;         ///< Intents rejected: queue full or link down at enqueue time
+    uint32_t sent;            ///< Intents handed to BleKeyboard
+    uint32_t notifyFailures;  ///< Intents that could not be delivered (link lost, report refused)
+    uint32_t cancelled;       ///< Press/release cycles discarded by cancelConsumerKey
+    uint32_t reports;         ///< HID report notifications sent (keyboard, consumer and mouse)
+    uint8_t depth;            ///< Intents currently queued
+    uint8_t maxDepth;         ///< High-water mark of depth
+};
+
+/**
+ * @brief Dedicated task that owns all HID output to BleKeyboard
+ *
+ * Mode handlers, BleKeyboardService and MacroManager enqueue HidIntents
+ * and return immediately; a congested BLE link now stalls this task
+ * instead of EncoderEventTask.
+ *
+ * While the link is busy, intents coalesce at the tail of a bounded ring:
+ * - WHEEL: same-direction wheel ticks with the same modifiers are summed,
+ *   saturating at the int8 range of a wheel report (the remainder spills
+ *   into a new slot)
+ * - CONSUMER_KEY: an identical key at the tail is deduplicated into its
+ *   repeat count rather than taking another slot
+ * - KEY_CHORD, KEY_STATE: never merged
+ *
+ * Keyboard state goes out as whole boot reports: a chord is its report
+ * followed by an empty one, never one notification per modifier. Keys
+ * held with KEY_STATE stay in every report: chords and wheel modifiers
+ * are layered on top of them and the release restores them.
+ *
+ * Reports are paced to one press/release cycle per report interval, which
+ * should track the BLE connection interval (see setReportInterval).
+ * Any task may enqueue; only the output task calls into BleKeyboard.
+ */
+class HidOutputTask {
+public:
+    explicit HidOutputTask(BleKeyboard* keyboard);
+
+    /**
+     * @brief Create the wake-up semaphore and start the output task
+     * @return true if task started successfully
+     */
+    bool start(uint32_t stackSize = HID_OUTPUT_TASK_STACK, UBaseType_t priority = HID_OUTPUT_TASK_PRIORITY);
+
+    /**
+     * @brief Queue mouse wheel ticks
+     * @param modifiers Modifier bitmask held around the wheel report (e.g. Ctrl for zoom)
+     * @return false if dropped (link down or queue full)
+     */
+    bool enqueueWheel(int16_t wheel, int16_t hWheel, uint64_t originUs = 0, uint8_t modifiers = 0);
+
+    /**
+     * @brief Queue a consumer control (media key) press/release
+     * @param repeat Number of press/release cycles
+     * @param cycleIntervalMs Spacing between cycles when slower than the report interval (0 = report interval)
+     * @return false if dropped (link down or queue full)
+     */
+    bool enqueueConsumerKey(const MediaKeyReport key, uint8_t repeat = 1, uint64_t originUs = 0,
+                            uint8_t cycleIntervalMs = 0);
+
+    /**
+     * @brief Discard pending cycles of a consumer key
+     *
+     * Removes queued intents for the key and stops the remaining repeat
+     * cycles of one being sent right now.
+     * @return Number of press/release cycles discarded from the queue
+     */
+    uint16_t cancelConsumerKey(const MediaKeyReport key);
+
+    /**
+     * @brief Queue a keyboard report press/release
+     *
+     * Each cycle sends the report, then a release: modifiers only between
+     * cycles (they stay held), empty after the last one. One cycle costs
+     * two notifications.
+     * @param report Report built by BleKeyboardService::composeKeyReport()
+     * @param repeat Number of key press/release cycles inside one modifier hold
+     * @return false if dropped (link down or queue full)
+     */
+    bool enqueueKeyChord(const KeyReport& report, uint8_t repeat = 1, uint64_t originUs = 0);
+
+    /**
+     * @brief Queue one keyboard report that stays in effect until the next
+     *
+     * Used by MacroVm to hold keys across instructions. Later chords and
+     * wheel modifiers keep them down. The caller owns releasing them (an
+     * empty report).
+     * @return false if dropped (link down or queue full)
+     */
+    bool enqueueKeyState(const KeyReport& report, uint64_t originUs = 0);
+
+    /**
+     * @brief Set report pacing, normally the negotiated connection interval
+     * @param intervalMs Milliseconds between report cycles (clamped to HID_OUTPUT_MIN_REPORT_INTERVAL_MS)
+     */
+    void setReportInterval(uint16_t intervalMs);
+
+    /**
+     * @brief Wait for the next report slot, then send the oldest intent
+     *
+     * One iteration of the output task; returns false if nothing was queued.
+     */
+    bool sendNext();
+
+    bool isConnected() const;
+    uint8_t getDepth() const;
+    HidOutputStats getStats() const;
+    void logStats() const;
+
+private:
+    static constexpr uint8_t CAPACITY = HID_OUTPUT_QUEUE_CAPACITY;
+
+    BleKeyboard* bleKeyboard;
+    HidIntent slots[CAPACITY];
+    uint8_t head = 0;   ///< Index of oldest intent
+    uint8_t count = 0;
+    HidOutputStats stats;
+    volatile uint16_t reportIntervalMs = HID_OUTPUT_REPORT_INTERVAL_MS;
+    TickType_t lastReportTick = 0;
+    bool consumerInFlight = false;    ///< A CONSUMER_KEY intent is inside send()
+    bool cancelPending = false;       ///< cancelConsumerKey hit the intent being sent
+    uint8_t inFlightKey[2] = {0, 0};
+    KeyReport heldReport = {};        ///< Last KEY_STATE report (output task only)
+
+    SemaphoreHandle_t notEmpty = nullptr;
+    TaskHandle_t taskHandle = nullptr;
+    mutable portMUX_TYPE queueMux = portMUX_INITIALIZER_UNLOCKED;
+
+    HidIntent& at(uint8_t offset) { return slots[(head + offset) % CAPACITY]; }
+    bool enqueue(const HidIntent& intent);
+    bool tryMergeIntoTail(HidIntent& intent);
+    bool waitForIntent();
+    bool takeOldest(HidIntent& out);
+
+    void waitForReportSlot(uint16_t minIntervalMs = 0);
+    bool takeCancel();
+    bool send(const HidIntent& intent, uint32_t& reports);
+    void sendKeyReport(uint8_t modifiers, const uint8_t* keys, uint32_t& reports);
+    void sendOverHeld(uint8_t modifiers, const uint8_t* keys, uint32_t& reports);
+
+    static void taskEntry(void* param);
+    void taskLoop();
+};
@@ -1,15 +1,31 @@
 #include "ConfigManager.h"
 #include "Config/log_config.h"
 #include "Config/button_config.h"
+#include "Config/acceleration_config.h"
+#include "Config/nvs_config.h"
+#include "Config/Interface/ConfigListenerInterface.h"
 #include "BLE/BleKeyboardService.h"
 #include "Enum/MacroInputEnum.h"
+#include "EncoderMode/Acceleration/AccelerationEngine.h"
 
 static const char* TAG = "ConfigManager";
 
 ConfigManager::ConfigManager(Preferences* preferences, BleKeyboardService* bleService)
     : prefs(preferences)
     , bleKeyboardService(bleService)
-    , initialized(false) {
+    , initialized(false)
+    , snapshot(defaultSnapshot())
+    , listeners{}
+    , listenerCount(0)
+    , programs{}
+    , recordBuffer{}
+    , writeLock(nullptr)
+    , flushLock(nullptr)
+    , dirty(false)
+    , readOnly(false)
+    , dirtySinceMs(0)
+    , lastChangeMs(0)
+    , stats{} {
 }
 
 bool ConfigManager::ensureInitialized() {
@@ -22,6 +38,19 @@ bool ConfigManager::ensureInitialized() {
         return false;
     }
 
+    if (!writeLock || !flushLock) {
+        if (!writeLock) {
+            writeLock = xSemaphoreCreateMutex();
+        }
+        if (!flushLock) {
+            flushLock = xSemaphoreCreateMutex();
+        }
+        if (!writeLock || !flushLock) {
+            LOG_ERROR(TAG, "Failed to create config locks");
+            return false;
+        }
+    }
+
     initialized = prefs->begin(NVS_NAMESPACE, false);
     if (!initialized) {
         LOG_ERROR(TAG, "Failed to initialize NVS namespace: %s", NVS_NAMESPACE);
@@ -33,56 +62,410 @@ void ConfigManager::getButtonKey(uint8_t index, char* buffer, size_t bufferSize)
     snprintf(buffer, bufferSize, "btn%d.action", index);
 }
 
-Error ConfigManager::saveWheelMode(WheelMode mode) {
-    if (static_cast<uint8_t>(mode) > WheelMode_MAX) {
-        LOG_ERROR(TAG, "Invalid wheel mode: %d", static_cast<uint8_t>(mode));
-        return Error::INVALID_PARAM;
+ConfigSnapshot ConfigManager::defaultSnapshot() {
+    ConfigSnapshot defaults{};
+    defaults.wheelMode = WheelMode::SCROLL;
+    defaults.wheelDirection = DEFAULT_WHEEL_DIR;
+    defaults.zoomStrategy = DEFAULT_ZOOM_STRATEGY;
+    for (uint8_t i = 0; i <= WheelMode_MAX; i++) {
+        defaults.accelerationCurves[i] = defaultAccelerationCurve(static_cast<WheelMode>(i));
     }
+    return defaults;
+}
+
+Error ConfigManager::begin() {
+    ConfigSnapshot loaded = defaultSnapshot();
 
     if (!ensureInitialized()) {
+        LOG_ERROR(TAG, "NVS not initialized, using default configuration");
+        commit(loaded, ConfigChange::ALL);
+        notify(ConfigChange::ALL);
+        return Error::NVS_READ_FAIL;
+    }
+
+    Error result = loadRecord(loaded);
+    commit(loaded, ConfigChange::ALL);
+    notify(ConfigChange::ALL);
+    return result;
+}
+
+Error ConfigManager::loadRecord(ConfigSnapshot& out) {
+    xSemaphoreTake(flushLock, portMAX_DELAY);
+    xSemaphoreTake(writeLock, portMAX_DELAY);
+
+    // One NVS read for the whole configuration
+    size_t length = prefs->getBytes(KEY_CONFIG_RECORD, recordBuffer, sizeof(recordBuffer));
+    if (length > 0) {
+        Error parsed = ConfigRecord::read(recordBuffer, length, out, programs);
+        xSemaphoreGive(writeLock);
+        xSemaphoreGive(flushLock);
+
+        if (parsed == Error::INVALID_STATE) {
+            // Written by newer firmware: use defaults, and never overwrite it with this older layout
+            out = defaultSnapshot();
+            clearPrograms();
+            readOnly = true;
+            LOG_ERROR(TAG, "Config record is from newer firmware (%u bytes), using defaults; changes will not be saved",
+                      static_cast<unsigned>(length));
+            return Error::NVS_READ_FAIL;
+        }
+        if (parsed != Error::OK) {
+            // Corrupt: defaults until the next save replaces it
+            out = defaultSnapshot();
+            clearPrograms();
+            LOG_ERROR(TAG, "Config record unreadable (%s, %u bytes), using defaults", errorToString(parsed),
+                      static_cast<unsigned>(length));
+            return Error::NVS_READ_FAIL;
+        }
+
+        validate(out);
+        LOG_INFO(TAG, "Configuration loaded from record (%u bytes)", static_cast<unsigned>(length));
+        return Error::OK;
+    }
+
+    // No record yet: fold the per-key layout (defaults on a fresh device) into one
+    readLegacy(out);
+    size_t recordLength = serialize(out);
+    bool migrated = recordLength > 0 && writeRecord(recordLength);
+    if (migrated) {
+        removeLegacyKeys();
+    }
+    xSemaphoreGive(writeLock);
+    xSemaphoreGive(flushLock);
+
+    if (!migrated) {
+        LOG_ERROR(TAG, "Failed to write config record, legacy keys kept");
         return Error::NVS_WRITE_FAIL;
     }
+    LOG_INFO(TAG, "Created config record from legacy keys");
+    return Error::OK;
+}
 
-    size_t written = prefs->putUChar(KEY_WHEEL_MODE, static_cast<uint8_t>(mode));
-    if (written == 0) {
-        LOG_ERROR(TAG, "Failed to write wheel mode to NVS");
+// Values the record cannot check on its own; anything invalid falls back to its default
+void ConfigManager::validate(ConfigSnapshot& config) const {
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        if (bleKeyboardService && !bleKeyboardService->isValidActionId(config.buttonActions[i])) {
+            LOG_ERROR(TAG, "Invalid stored button action ID: %d for button %d, using default NONE",
+                      config.buttonActions[i], i);
+            config.buttonActions[i] = 0;
+        }
+    }
+
+    for (uint8_t i = 0; i <= WheelMode_MAX; i++) {
+        if (!AccelerationEngine::isValid(config.accelerationCurves[i])) {
+            WheelMode mode = static_cast<WheelMode>(i);
+            LOG_ERROR(TAG, "Invalid stored acceleration curve for %s, using default", wheelModeToString(mode));
+            config.accelerationCurves[i] = defaultAccelerationCurve(mode);
+        }
+    }
+}
+
+void ConfigManager::clearPrograms() {
+    for (uint8_t i = 0; i < ConfigRecord::MACRO_COUNT; i++) {
+        programs[i].length = 0;
+    }
+}
+
+void ConfigManager::removeLegacyKeys() {
+    char key[16];
+    auto removeKey = [this](const char* name) {
+        if (prefs->isKey(name)) {
+            prefs->remove(name);
+        }
+    };
+
+    removeKey(KEY_WHEEL_MODE);
+    removeKey(KEY_WHEEL_DIR);
+    removeKey(KEY_ZOOM_STRATEGY);
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        getButtonKey(i, key, sizeof(key));
+        removeKey(key);
+    }
+    for (uint8_t i = 0; i < ConfigRecord::MACRO_COUNT; i++) {
+        snprintf(key, sizeof(key), "macro.%d", i);
+        removeKey(key);
+        snprintf(key, sizeof(key), "mprog.%d", i);
+        removeKey(key);
+    }
+    for (uint8_t i = 0; i <= WheelMode_MAX; i++) {
+        snprintf(key, sizeof(key), "accel.%d", i);
+        removeKey(key);
+    }
+}
+
+size_t ConfigManager::serialize(const ConfigSnapshot& config) {
+    size_t length = ConfigRecord::write(config, programs, recordBuffer, sizeof(recordBuffer));
+    if (length == 0) {
+        LOG_ERROR(TAG, "Config record does not fit %u bytes", static_cast<unsigned>(sizeof(recordBuffer)));
+    }
+    return length;
+}
+
+bool ConfigManager::writeRecord(size_t length) {
+    bool written = prefs->putBytes(KEY_CONFIG_RECORD, recordBuffer, length) == length;
+
+    // A blob costs an index entry, a chunk header entry and its data entries
+    uint32_t entries = 2 + (length + NVS_ENTRY_BYTES - 1) / NVS_ENTRY_BYTES;
+
+    taskENTER_CRITICAL(&statsMux);
+    if (written) {
+        stats.commits++;
+        stats.bytesWritten += length;
+        stats.entriesWritten += entries;
+    } else {
+        stats.failures++;
+    }
+    taskEXIT_CRITICAL(&statsMux);
+
+    if (!written) {
+        LOG_ERROR(TAG, "Failed to write config record (%u bytes)", static_cast<unsigned>(length));
+    }
+    return written;
+}
+
+void ConfigManager::markDirty() {
+    if (readOnly) {
+        return;
+    }
+
+    uint32_t now = millis();
+    bool merged = dirty;
+    if (!merged) {
+        dirtySinceMs = now;
+        dirty = true;
+    }
+    lastChangeMs = now;
+
+    taskENTER_CRITICAL(&statsMux);
+    stats.changes++;
+    if (merged) {
+        stats.coalesced++;
+    }
+    taskEXIT_CRITICAL(&statsMux);
+}
+
+template <typename Mutator>
+Error ConfigManager::store(ConfigChange change, Mutator mutate) {
+    if (!ensureInitialized()) {
         return Error::NVS_WRITE_FAIL;
     }
 
-    LOG_INFO(TAG, "Saved wheel mode: %s", wheelModeToString(mode));
+    xSemaphoreTake(writeLock, portMAX_DELAY);
+    ConfigSnapshot next = snapshot.read();
+    mutate(next);
+    commit(next, change);
+    markDirty();
+    xSemaphoreGive(writeLock);
+
+    notify(change);
     return Error::OK;
 }
 
-WheelMode ConfigManager::loadWheelMode() {
+void ConfigManager::poll() {
+    if (!dirty) {
+        return;
+    }
+
+    xSemaphoreTake(writeLock, portMAX_DELAY);
+    uint32_t now = millis();
+    bool due = now - lastChangeMs >= CONFIG_WRITEBACK_QUIET_MS ||
+               now - dirtySinceMs >= CONFIG_WRITEBACK_MAX_DELAY_MS;
+    xSemaphoreGive(writeLock);
+
+    if (due) {
+        flush();
+    }
+}
+
+Error ConfigManager::flush() {
+    if (!dirty) {
+        return Error::OK;
+    }
     if (!ensureInitialized()) {
-        LOG_ERROR(TAG, "NVS not initialized, returning default SCROLL");
-        return WheelMode::SCROLL;
+        return Error::NVS_WRITE_FAIL;
+    }
+
+    xSemaphoreTake(flushLock, portMAX_DELAY);
+
+    // Serialize under the write lock, write to flash without it
+    xSemaphoreTake(writeLock, portMAX_DELAY);
+    size_t length = dirty ? serialize(snapshot.read()) : 0;
+    bool pending = dirty;
+    dirty = false;
+    xSemaphoreGive(writeLock);
+
+    bool written = !pending || (length > 0 && writeRecord(length));
+    if (!written) {
+        // Keep the changes pending; retry once the quiet period has passed again
+        xSemaphoreTake(writeLock, portMAX_DELAY);
+        if (!dirty) {
+            dirtySinceMs = millis();
+        }
+        dirty = true;
+        lastChangeMs = millis();
+        xSemaphoreGive(writeLock);
+    } else if (pending) {
+        LOG_DEBUG(TAG, "Config record written (%u bytes)", static_cast<unsigned>(length));
+    }
+
+    xSemaphoreGive(flushLock);
+    return written ? Error::OK : Error::NVS_WRITE_FAIL;
+}
+
+ConfigWriteStats ConfigManager::getStats() const {
+    taskENTER_CRITICAL(&statsMux);
+    ConfigWriteStats copy = stats;
+    taskEXIT_CRITICAL(&statsMux);
+    copy.dirty = dirty;
+    return copy;
+}
+
+void ConfigManager::logStats() const {
+    ConfigWriteStats s = getStats();
+
+    // One page stays free for NVS garbage collection
+    uint32_t pages = NVS_PARTITION_BYTES / NVS_PAGE_BYTES - 1;
+    uint64_t entryBudget = static_cast<uint64_t>(pages) * NVS_ENTRIES_PER_PAGE * NVS_FLASH_ENDURANCE_CYCLES;
+    uint32_t uptimeS = millis() / 1000;
+
+    if (s.entriesWritten == 0 || uptimeS == 0) {
+        LOG_INFO(TAG, "writes: commits=0 changes=%u pending=%s", static_cast<unsigned>(s.changes), s.dirty ? "yes" : "no");
+        return;
+    }
+
+    // Project this session's write rate over the whole partition's endurance
+    [[maybe_unused]] uint64_t lifetimeDays = entryBudget * uptimeS / s.entriesWritten / 86400;
+    LOG_INFO(TAG, "writes: commits=%u changes=%u coalesced=%u failed=%u bytes=%u entries=%u pending=%s projected flash life=%llu days",
+             static_cast<unsigned>(s.commits), static_cast<unsigned>(s.changes), static_cast<unsigned>(s.coalesced),
+             static_cast<unsigned>(s.failures), static_cast<unsigned>(s.bytesWritten), static_cast<unsigned>(s.entriesWritten),
+             s.dirty ? "yes" : "no", static_cast<unsigned long long>(lifetimeDays));
+}
+
+void ConfigManager::readLegacy(ConfigSnapshot& out) {
+    uint8_t storedMode = prefs->getUChar(KEY_WHEEL_MODE, static_cast<uint8_t>(WheelMode::SCROLL));
+    if (storedMode > WheelMode_MAX) {
+        LOG_ERROR(TAG, "Invalid stored wheel mode: %d, using default SCROLL", storedMode);
+    } else {
+        out.wheelMode = static_cast<WheelMode>(storedMode);
     }
 
-    uint8_t stored = prefs->getUChar(KEY_WHEEL_MODE, static_cast<uint8_t>(WheelMode::SCROLL));
+    uint8_t storedDirection = prefs->getUChar(KEY_WHEEL_DIR, static_cast<uint8_t>(DEFAULT_WHEEL_DIR));
+    if (storedDirection > WheelDirection_MAX) {
+        LOG_ERROR(TAG, "Invalid stored wheel direction: %d, using default NORMAL", storedDirection);
+    } else {
+        out.wheelDirection = static_cast<WheelDirection>(storedDirection);
+    }
 
-    if (stored > WheelMode_MAX) {
-        LOG_ERROR(TAG, "Invalid stored wheel mode: %d, returning default SCROLL", stored);
-        return WheelMode::SCROLL;
+    uint8_t storedZoom = prefs->getUChar(KEY_ZOOM_STRATEGY, static_cast<uint8_t>(DEFAULT_ZOOM_STRATEGY));
+    if (storedZoom > ZoomStrategy_MAX) {
+        LOG_ERROR(TAG, "Invalid stored zoom strategy: %d, using default %s",
+                  storedZoom, zoomStrategyToString(DEFAULT_ZOOM_STRATEGY));
+    } else {
+        out.zoomStrategy = static_cast<ZoomStrategy>(storedZoom);
     }
 
-    WheelMode mode = static_cast<WheelMode>(stored);
-    LOG_DEBUG(TAG, "Loaded wheel mode: %s", wheelModeToString(mode));
-    return mode;
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        char key[BUTTON_KEY_BUFFER_SIZE];
+        getButtonKey(i, key, sizeof(key));
+        uint8_t stored = prefs->getUChar(key, 0);  // Default to ID 0 (NONE)
+
+        // Validate loaded ID via service
+        if (bleKeyboardService && !bleKeyboardService->isValidActionId(stored)) {
+            LOG_ERROR(TAG, "Invalid stored button action ID: %d for key: %s, using default NONE", stored, key);
+            stored = 0;
+        }
+        out.buttonActions[i] = stored;
+    }
+
+    for (uint8_t i = 0; i < static_cast<uint8_t>(MacroInput::COUNT); i++) {
+        char key[16];
+        snprintf(key, sizeof(key), "macro.%d", i);
+        out.macros[i] = prefs->getUShort(key, 0x0000);
+
+        snprintf(key, sizeof(key), "mprog.%d", i);
+        size_t length = prefs->getBytesLength(key);
+        if (length > 0 && length <= MACRO_PROGRAM_MAX_BYTES &&
+            prefs->getBytes(key, programs[i].code, length) == length) {
+            programs[i].length = static_cast<uint16_t>(length);
+        }
+    }
+
+    for (uint8_t i = 0; i <= WheelMode_MAX; i++) {
+        char key[16];
+        snprintf(key, sizeof(key), "accel.%d", i);
+        if (prefs->getBytesLength(key) != sizeof(AccelerationCurve)) {
+            continue;  // Keep mode default
+        }
+
+        AccelerationCurve stored;
+        prefs->getBytes(key, &stored, sizeof(stored));
+        if (!AccelerationEngine::isValid(stored)) {
+            LOG_ERROR(TAG, "Invalid stored acceleration curve for %s, using default",
+                      wheelModeToString(static_cast<WheelMode>(i)));
+            continue;
+        }
+        out.accelerationCurves[i] = stored;
+    }
 }
 
-Error ConfigManager::setWheelDirection(WheelDirection direction) {
-    if (static_cast<uint8_t>(direction) > WheelDirection_MAX) {
-        LOG_ERROR(TAG, "Invalid wheel direction: %d", static_cast<uint8_t>(direction));
+ConfigSnapshot ConfigManager::getSnapshot() const {
+    return snapshot.read();
+}
+
+uint32_t ConfigManager::getGeneration() const {
+    return snapshot.getGeneration();
+}
+
+Error ConfigManager::subscribe(ConfigListenerInterface* listener) {
+    if (!listener || listenerCount >= MAX_LISTENERS) {
+        LOG_ERROR(TAG, "Cannot subscribe config listener (count: %d/%d)", listenerCount, MAX_LISTENERS);
         return Error::INVALID_PARAM;
     }
 
-    if (!ensureInitialized()) {
+    listeners[listenerCount++] = listener;
+    return Error::OK;
+}
+
+void ConfigManager::commit(const ConfigSnapshot& next, ConfigChange change) {
+    snapshot.write(next);
+    LOG_DEBUG(TAG, "Config generation %u (%s)", snapshot.getGeneration(), configChangeToString(change));
+}
+
+void ConfigManager::notify(ConfigChange change) {
+    // Latest snapshot rather than the one this change produced: when setters race,
+    // the last notification a listener sees always carries the final state
+    ConfigSnapshot current = snapshot.read();
+    for (uint8_t i = 0; i < listenerCount; i++) {
+        listeners[i]->onConfigChanged(change, current);
+    }
+}
+
+Error ConfigManager::saveWheelMode(WheelMode mode) {
+    if (static_cast<uint8_t>(mode) > WheelMode_MAX) {
+        LOG_ERROR(TAG, "Invalid wheel mode: %d", static_cast<uint8_t>(mode));
+        return Error::INVALID_PARAM;
+    }
+
+    if (store(ConfigChange::WHEEL_MODE, [mode](ConfigSnapshot& next) { next.wheelMode = mode; }) != Error::OK) {
+        LOG_ERROR(TAG, "Failed to write wheel mode to NVS");
         return Error::NVS_WRITE_FAIL;
     }
 
-    size_t written = prefs->putUChar(KEY_WHEEL_DIR, static_cast<uint8_t>(direction));
-    if (written == 0) {
+    LOG_INFO(TAG, "Saved wheel mode: %s", wheelModeToString(mode));
+    return Error::OK;
+}
+
+WheelMode ConfigManager::loadWheelMode() const {
+    return snapshot.read().wheelMode;
+}
+
+Error ConfigManager::setWheelDirection(WheelDirection direction) {
+    if (static_cast<uint8_t>(direction) > WheelDirection_MAX) {
+        LOG_ERROR(TAG, "Invalid wheel direction: %d", static_cast<uint8_t>(direction));
+        return Error::INVALID_PARAM;
+    }
+
+    if (store(ConfigChange::WHEEL_DIRECTION, [direction](ConfigSnapshot& next) { next.wheelDirection = direction; }) != Error::OK) {
         LOG_ERROR(TAG, "Failed to write wheel direction to NVS");
         return Error::NVS_WRITE_FAIL;
     }
@@ -92,26 +475,31 @@ Error ConfigManager::setWheelDirection(WheelDirection direction) {
 }
 
 WheelDirection ConfigManager::getWheelDirection() const {
-    if (!const_cast<ConfigManager*>(this)->ensureInitialized()) {
-        LOG_ERROR(TAG, "NVS not initialized, returning default NORMAL");
-        return DEFAULT_WHEEL_DIR;
-    }
+    return snapshot.read().wheelDirection;
+}
 
-    uint8_t stored = prefs->getUChar(KEY_WHEEL_DIR, static_cast<uint8_t>(DEFAULT_WHEEL_DIR));
+Error ConfigManager::saveZoomStrategy(ZoomStrategy strategy) {
+    if (static_cast<uint8_t>(strategy) > ZoomStrategy_MAX) {
+        LOG_ERROR(TAG, "Invalid zoom strategy: %d", static_cast<uint8_t>(strategy));
+        return Error::INVALID_PARAM;
+    }
 
-    if (stored > WheelDirection_MAX) {
-        LOG_ERROR(TAG, "Invalid stored wheel direction: %d, returning default NORMAL", stored);
-        return DEFAULT_WHEEL_DIR;
+    if (store(ConfigChange::ZOOM_STRATEGY, [strategy](ConfigSnapshot& next) { next.zoomStrategy = strategy; }) != Error::OK) {
+        LOG_ERROR(TAG, "Failed to write zoom strategy to NVS");
+        return Error::NVS_WRITE_FAIL;
     }
 
-    WheelDirection direction = static_cast<WheelDirection>(stored);
-    LOG_DEBUG(TAG, "Loaded wheel direction: %s", wheelDirectionToString(direction));
-    return direction;
+    LOG_INFO(TAG, "Saved zoom strategy: %s", zoomStrategyToString(strategy));
+    return Error::OK;
+}
+
+ZoomStrategy ConfigManager::loadZoomStrategy() const {
+    return snapshot.read().zoomStrategy;
 }
 
 Error ConfigManager::saveButtonAction(uint8_t index, ButtonActionId action) {
     if (index >= BUTTON_COUNT) {
-        LOG_ERROR(TAG, "Invalid button index: %d (max: %d)", index, BUTTON_COUNT - 1);
+        LOG_ERROR(TAG, "Invalid button index: %d (max: %d)", index, static_cast<int>(BUTTON_COUNT) - 1);
         return Error::INVALID_PARAM;
     }
 
@@ -121,97 +509,124 @@ Error ConfigManager::saveButtonAction(uint8_t index, ButtonActionId action) {
         return Error::INVALID_PARAM;
     }
 
-    if (!ensureInitialized()) {
-        return Error::NVS_WRITE_FAIL;
-    }
-
-    char key[BUTTON_KEY_BUFFER_SIZE];
-    getButtonKey(index, key, sizeof(key));
-    size_t written = prefs->putUChar(key, action);
-    if (written == 0) {
-        LOG_ERROR(TAG, "Failed to write button action to NVS for key: %s", key);
+    if (store(ConfigChange::BUTTON_ACTION, [index, action](ConfigSnapshot& next) { next.buttonActions[index] = action; }) != Error::OK) {
+        LOG_ERROR(TAG, "Failed to write button %d action to NVS", index);
         return Error::NVS_WRITE_FAIL;
     }
 
-    const char* actionName = bleKeyboardService ? bleKeyboardService->getActionIdentifier(action) : "UNKNOWN";
-    LOG_INFO(TAG, "Saved button %d action: %s", index, actionName);
+    LOG_INFO(TAG, "Saved button %d action: %s", index,
+             bleKeyboardService ? bleKeyboardService->getActionIdentifier(action) : "UNKNOWN");
     return Error::OK;
 }
 
-ButtonActionId ConfigManager::loadButtonAction(uint8_t index) {
+ButtonActionId ConfigManager::loadButtonAction(uint8_t index) const {
     if (index >= BUTTON_COUNT) {
         LOG_ERROR(TAG, "Invalid button index: %d, returning default NONE", index);
         return 0;  // ID 0 = NONE
     }
 
-    if (!ensureInitialized()) {
-        LOG_ERROR(TAG, "NVS not initialized, returning default NONE");
-        return 0;  // ID 0 = NONE
+    return snapshot.read().buttonActions[index];
+}
+
+Error ConfigManager::loadMacro(uint8_t index, MacroDefinition& out) const {
+    if (index >= static_cast<uint8_t>(MacroInput::COUNT)) {
+        LOG_ERROR(TAG, "Invalid macro index: %d (max: %d)", index, static_cast<uint8_t>(MacroInput::COUNT) - 1);
+        return Error::INVALID_PARAM;
     }
 
-    char key[BUTTON_KEY_BUFFER_SIZE];
-    getButtonKey(index, key, sizeof(key));
-    uint8_t stored = prefs->getUChar(key, 0);  // Default to ID 0 (NONE)
+    out = MacroDefinition::fromPacked(snapshot.read().macros[index]);
+    return Error::OK;
+}
 
-    // Validate loaded ID via service
-    if (bleKeyboardService && !bleKeyboardService->isValidActionId(stored)) {
-        LOG_ERROR(TAG, "Invalid stored button action ID: %d for key: %s, returning default NONE", stored, key);
-        return 0;  // ID 0 = NONE
+Error ConfigManager::saveMacro(uint8_t index, uint16_t packed) {
+    if (index >= static_cast<uint8_t>(MacroInput::COUNT)) {
+        LOG_ERROR(TAG, "Invalid macro index: %d (max: %d)", index, static_cast<uint8_t>(MacroInput::COUNT) - 1);
+        return Error::INVALID_PARAM;
+    }
+
+    if (store(ConfigChange::MACRO, [index, packed](ConfigSnapshot& next) { next.macros[index] = packed; }) != Error::OK) {
+        LOG_ERROR(TAG, "Failed to write macro %d to NVS", index);
+        return Error::NVS_WRITE_FAIL;
     }
 
-    const char* actionName = bleKeyboardService ? bleKeyboardService->getActionIdentifier(stored) : "UNKNOWN";
-    LOG_DEBUG(TAG, "Loaded button %d action: %s", index, actionName);
-    return stored;
+    LOG_INFO(TAG, "Saved macro %d: 0x%04X", index, packed);
+    return Error::OK;
 }
 
-Error ConfigManager::loadMacro(uint8_t index, MacroDefinition& out) {
+Error ConfigManager::loadMacroProgram(uint8_t index, MacroProgram& out) {
+    out.length = 0;
     if (index >= static_cast<uint8_t>(MacroInput::COUNT)) {
         LOG_ERROR(TAG, "Invalid macro index: %d (max: %d)", index, static_cast<uint8_t>(MacroInput::COUNT) - 1);
         return Error::INVALID_PARAM;
     }
 
     if (!ensureInitialized()) {
-        LOG_ERROR(TAG, "NVS not initialized, returning empty macro");
-        out = MacroDefinition{0, 0};  // Return empty macro
-        return Error::NVS_READ_FAIL;
+        return Error::OK;  // Nothing loaded: no program
     }
 
-    char key[16];
-    snprintf(key, sizeof(key), "macro.%d", index);
+    xSemaphoreTake(writeLock, portMAX_DELAY);
+    out = programs[index];
+    xSemaphoreGive(writeLock);
+    return Error::OK;
+}
 
-    // Load from NVS (default to 0x0000 if key doesn't exist)
-    uint16_t packed = prefs->getUShort(key, 0x0000);
-    out = MacroDefinition::fromPacked(packed);
+Error ConfigManager::saveMacroProgram(uint8_t index, const MacroProgram& program) {
+    if (index >= static_cast<uint8_t>(MacroInput::COUNT) || program.length > MACRO_PROGRAM_MAX_BYTES) {
+        LOG_ERROR(TAG, "Invalid macro program: index %d, %u bytes", index, program.length);
+        return Error::INVALID_PARAM;
+    }
 
-    if (packed == 0x0000) {
-        LOG_DEBUG(TAG, "Macro %d is empty (key: %s)", index, key);
-    } else {
-        LOG_DEBUG(TAG, "Loaded macro %d: 0x%04X (key: %s)", index, packed, key);
+    if (!ensureInitialized()) {
+        return Error::NVS_WRITE_FAIL;
     }
 
+    xSemaphoreTake(writeLock, portMAX_DELAY);
+    programs[index] = program;
+    markDirty();
+    xSemaphoreGive(writeLock);
+
+    LOG_INFO(TAG, "Saved macro program %d: %u bytes", index, program.length);
     return Error::OK;
 }
 
-Error ConfigManager::saveMacro(uint8_t index, uint16_t packed) {
-    if (index >= static_cast<uint8_t>(MacroInput::COUNT)) {
-        LOG_ERROR(TAG, "Invalid macro index: %d (max: %d)", index, static_cast<uint8_t>(MacroInput::COUNT) - 1);
+AccelerationCurve ConfigManager::defaultAccelerationCurve(WheelMode mode) {
+    switch (mode) {
+        case WheelMode::SCROLL: return ACCEL_DEFAULT_SCROLL;
+        case WheelMode::VOLUME: return ACCEL_DEFAULT_VOLUME;
+        case WheelMode::ZOOM:   return ACCEL_DEFAULT_ZOOM;
+        default:                return AccelerationCurve::none();
+    }
+}
+
+Error ConfigManager::loadAccelerationCurve(WheelMode mode, AccelerationCurve& out) const {
+    if (static_cast<uint8_t>(mode) > WheelMode_MAX) {
+        LOG_ERROR(TAG, "Invalid wheel mode for acceleration: %d", static_cast<uint8_t>(mode));
         return Error::INVALID_PARAM;
     }
 
-    if (!ensureInitialized()) {
-        return Error::NVS_WRITE_FAIL;
+    out = snapshot.read().accelerationCurves[static_cast<uint8_t>(mode)];
+    return Error::OK;
+}
+
+Error ConfigManager::saveAccelerationCurve(WheelMode mode, const AccelerationCurve& curve) {
+    if (static_cast<uint8_t>(mode) > WheelMode_MAX) {
+        LOG_ERROR(TAG, "Invalid wheel mode for acceleration: %d", static_cast<uint8_t>(mode));
+        return Error::INVALID_PARAM;
     }
 
-    char key[16];
-    snprintf(key, sizeof(key), "macro.%d", index);
+    if (!AccelerationEngine::isValid(curve)) {
+        LOG_ERROR(TAG, "Invalid acceleration curve for %s", wheelModeToString(mode));
+        return Error::INVALID_PARAM;
+    }
 
-    size_t written = prefs->putUShort(key, packed);
-    if (written == 0) {
-        LOG_ERROR(TAG, "Failed to write macro to NVS for key: %s", key);
+    uint8_t slot = static_cast<uint8_t>(mode);
+    if (store(ConfigChange::ACCELERATION, [slot, &curve](ConfigSnapshot& next) { next.accelerationCurves[slot] = curve; }) != Error::OK) {
+        LOG_ERROR(TAG, "Failed to write acceleration curve for %s to NVS", wheelModeToString(mode));
         return Error::NVS_WRITE_FAIL;
     }
 
-    LOG_INFO(TAG, "Saved macro %d: 0x%04X", index, packed);
+    LOG_INFO(TAG, "Saved %s acceleration curve for %s",
+             accelerationCurveTypeToString(curve.type), wheelModeToString(mode));
     return Error::OK;
 }
 
@@ -220,7 +635,22 @@ Error ConfigManager::clearAll() {
         return Error::NVS_WRITE_FAIL;
     }
 
+    xSemaphoreTake(flushLock, portMAX_DELAY);
+    xSemaphoreTake(writeLock, portMAX_DELAY);
     bool cleared = prefs->clear();
+    if (cleared) {
+        clearPrograms();
+        commit(defaultSnapshot(), ConfigChange::ALL);
+        dirty = false;  // Defaults need no record
+        readOnly = false;  // Newer record is gone
+    }
+    xSemaphoreGive(writeLock);
+    xSemaphoreGive(flushLock);
+
+    if (cleared) {
+        notify(ConfigChange::ALL);
+    }
+
     if (!cleared) {
         LOG_ERROR(TAG, "Failed to clear NVS namespace: %s", NVS_NAMESPACE);
         return Error::NVS_WRITE_FAIL;
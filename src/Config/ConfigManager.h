@@ -1,52 +1,192 @@
 #pragma once
 
 #include <Preferences.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "Enum/ErrorEnum.h"
 #include "Enum/WheelModeEnum.h"
 #include "Enum/WheelDirection.h"
+#include "Enum/ZoomStrategyEnum.h"
+#include "Enum/ConfigChangeEnum.h"
 #include "Config/device_config.h"
 #include "Type/MacroDefinition.h"
+#include "Type/MacroProgram.h"
+#include "Type/AccelerationCurve.h"
+#include "Type/ConfigSnapshot.h"
+#include "state/Seqlock.h"
+#include "ConfigRecord.h"
 
 // Forward declarations
 class BleKeyboardService;
+class ConfigListenerInterface;
 
 using ButtonActionId = uint8_t;
 
+/**
+ * @brief Write-back counters, for projecting flash wear
+ */
+struct ConfigWriteStats {
+    uint32_t changes;         ///< Setting changes accepted (each one used to be a commit)
+    uint32_t coalesced;       ///< Changes merged into an already pending commit
+    uint32_t commits;         ///< Record writes to NVS
+    uint32_t failures;        ///< Record writes that failed (retried after the quiet period)
+    uint32_t bytesWritten;    ///< Record bytes written
+    uint32_t entriesWritten;  ///< NVS entries consumed, blob headers included
+    bool dirty;               ///< Changes not yet in flash
+};
+
+/**
+ * @brief Persistent configuration with a RAM-resident snapshot
+ *
+ * All settings and macro programs persist as one ConfigRecord blob
+ * (KEY_CONFIG_RECORD). begin() loads it with a single NVS read; a device
+ * still on the legacy per-key layout is migrated into the record once.
+ * After that all getters read a seqlock-protected snapshot (lock-free, no
+ * flash access). Setters update the snapshot, bump the generation and
+ * notify subscribed listeners at once, but only mark the record dirty:
+ * poll() writes it once settings have been quiet for
+ * CONFIG_WRITEBACK_QUIET_MS (or CONFIG_WRITEBACK_MAX_DELAY_MS after the
+ * first change), so scrolling through a menu costs one commit rather than
+ * one per step. flush() writes at once and is called before deep sleep.
+ *
+ * A record written by newer firmware (higher schema version) is never
+ * overwritten: the manager runs on defaults and stays read-only, so
+ * changes apply until reboot but are not written back. clearAll() lifts
+ * this by erasing the record.
+ */
 class ConfigManager {
 public:
+    static constexpr uint8_t MAX_LISTENERS = 8;
+
     ConfigManager(Preferences* preferences, BleKeyboardService* bleService);
 
+    /**
+     * @brief Load the complete snapshot from NVS (call once at boot)
+     *
+     * Reads the config record in one go. Without a record the legacy keys
+     * are read, written back as a record and removed.
+     * @return Error::OK on success, Error::NVS_READ_FAIL if NVS unavailable or the record is corrupt (defaults are used)
+     */
+    Error begin();
+
+    /**
+     * @brief Lock-free copy of the current configuration
+     */
+    ConfigSnapshot getSnapshot() const;
+
+    /**
+     * @brief Number of snapshot updates since boot (changes on every write)
+     */
+    uint32_t getGeneration() const;
+
+    /**
+     * @brief Register a listener for configuration changes
+     * @return Error::OK on success, Error::INVALID_PARAM if null or the listener table is full
+     */
+    Error subscribe(ConfigListenerInterface* listener);
+
     Error saveWheelMode(WheelMode mode);
-    WheelMode loadWheelMode();
+    WheelMode loadWheelMode() const;
 
     Error setWheelDirection(WheelDirection direction);
     WheelDirection getWheelDirection() const;
 
+    Error saveZoomStrategy(ZoomStrategy strategy);
+    ZoomStrategy loadZoomStrategy() const;
+
     Error saveButtonAction(uint8_t index, ButtonActionId action);
-    ButtonActionId loadButtonAction(uint8_t index);
+    ButtonActionId loadButtonAction(uint8_t index) const;
 
     /**
-     * @brief Load a macro definition from NVS
+     * @brief Get a macro definition from the snapshot
      * @param index Macro slot index (0 to MACRO_INPUT_COUNT-1)
-     * @param out Output parameter to store loaded macro (empty macro if key doesn't exist)
-     * @return Error::OK on success, Error::INVALID_PARAM if index out of range, Error::NVS_READ_FAIL if NVS not initialized
+     * @param out Output parameter to store the macro (empty macro if never assigned)
+     * @return Error::OK on success, Error::INVALID_PARAM if index out of range
      */
-    Error loadMacro(uint8_t index, MacroDefinition& out);
+    Error loadMacro(uint8_t index, MacroDefinition& out) const;
 
     /**
-     * @brief Save a macro definition to NVS
+     * @brief Set a macro definition; the record is written back later (see poll())
      * @param index Macro slot index (0 to MACRO_INPUT_COUNT-1)
      * @param packed Packed macro value (modifiers << 8 | keycode)
-     * @return Error::OK on success, Error::INVALID_PARAM if index out of range, Error::NVS_WRITE_FAIL on failure
+     * @return Error::OK on success, Error::INVALID_PARAM if index out of range, Error::NVS_WRITE_FAIL if NVS is unavailable
      */
     Error saveMacro(uint8_t index, uint16_t packed);
 
     /**
-     * @brief Clear all configuration data from NVS
+     * @brief Get a macro program loaded with the config record
+     *
+     * Programs are too large for the snapshot; they are kept beside it,
+     * and this is the only copy: MacroManager reads a program each time
+     * it runs one.
+     * @param index Macro slot index (0 to MACRO_INPUT_COUNT-1)
+     * @param out Output program (length 0 if none stored)
+     * @return Error::OK on success, Error::INVALID_PARAM if index out of range
+     */
+    Error loadMacroProgram(uint8_t index, MacroProgram& out);
+
+    /**
+     * @brief Set a macro program (an empty program removes it); written back with the record
+     * @param index Macro slot index (0 to MACRO_INPUT_COUNT-1)
+     * @param program Program to store (validate with MacroVm::validate first)
+     * @return Error::OK on success, Error::INVALID_PARAM if index out of range, Error::NVS_WRITE_FAIL if NVS is unavailable
+     */
+    Error saveMacroProgram(uint8_t index, const MacroProgram& program);
+
+    /**
+     * @brief Get the acceleration curve for a wheel mode from the snapshot
+     * @param mode Wheel mode the curve applies to
+     * @param out Output parameter (mode default if never stored)
+     * @return Error::OK on success, Error::INVALID_PARAM if mode out of range
+     */
+    Error loadAccelerationCurve(WheelMode mode, AccelerationCurve& out) const;
+
+    /**
+     * @brief Set the acceleration curve for a wheel mode; written back with the record
+     * @param mode Wheel mode the curve applies to
+     * @param curve Curve to store (validated first)
+     * @return Error::OK on success, Error::INVALID_PARAM if mode or curve invalid, Error::NVS_WRITE_FAIL if NVS is unavailable
+     */
+    Error saveAccelerationCurve(WheelMode mode, const AccelerationCurve& curve);
+
+    /**
+     * @brief Built-in curve used when nothing is stored for a mode
+     */
+    static AccelerationCurve defaultAccelerationCurve(WheelMode mode);
+
+    /**
+     * @brief Clear all configuration data from NVS and reset the snapshot to defaults
      * @return Error::OK on success, Error::NVS_WRITE_FAIL on failure
      */
     Error clearAll();
 
+    /**
+     * @brief Write pending changes once the quiet period is over (call periodically)
+     */
+    void poll();
+
+    /**
+     * @brief Write pending changes now (on demand, before sleep)
+     *
+     * Serializes under the write lock, then writes to flash without it, so
+     * setters on other tasks are not held up by the flash erase.
+     * @return Error::OK if nothing is pending or the record was written, Error::NVS_WRITE_FAIL otherwise (still pending)
+     */
+    Error flush();
+
+    bool isDirty() const { return dirty; }
+
+    /**
+     * @brief True if the stored record is from newer firmware and must not be overwritten
+     */
+    bool isReadOnly() const { return readOnly; }
+    ConfigWriteStats getStats() const;
+
+    /**
+     * @brief Log write-back counters and the flash lifetime projected from this session's write rate
+     */
+    void logStats() const;
+
 private:
     static constexpr uint8_t BUTTON_KEY_BUFFER_SIZE = 16;
 
@@ -54,6 +194,67 @@ private:
     BleKeyboardService* bleKeyboardService;
     bool initialized;
 
+    Seqlock<ConfigSnapshot> snapshot;
+    ConfigListenerInterface* listeners[MAX_LISTENERS];
+    uint8_t listenerCount;
+
+    MacroProgram programs[ConfigRecord::MACRO_COUNT];  ///< Persisted with the snapshot (guarded by writeLock)
+    uint8_t recordBuffer[ConfigRecord::MAX_BYTES];     ///< Serialized record (guarded by flushLock)
+    SemaphoreHandle_t writeLock;                       ///< Snapshot updates, programs, dirty state
+    SemaphoreHandle_t flushLock;                       ///< Record writes; taken before writeLock
+
+    volatile bool dirty;
+    bool readOnly;          ///< Record has a newer schema: never write it back
+    uint32_t dirtySinceMs;  ///< First change since the last commit (guarded by writeLock)
+    uint32_t lastChangeMs;  ///< Most recent change (guarded by writeLock)
+    ConfigWriteStats stats;
+    mutable portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
     bool ensureInitialized();
     void getButtonKey(uint8_t index, char* buffer, size_t bufferSize) const;
+
+    static ConfigSnapshot defaultSnapshot();
+    Error loadRecord(ConfigSnapshot& out);
+    void validate(ConfigSnapshot& config) const;
+    void readLegacy(ConfigSnapshot& out);
+    void removeLegacyKeys();
+    void clearPrograms();
+
+    /**
+     * @brief Serialize snapshot + programs into recordBuffer (caller holds both locks)
+     * @return Record length, 0 if it does not fit
+     */
+    size_t serialize(const ConfigSnapshot& config);
+
+    /**
+     * @brief Write recordBuffer to NVS and count it (caller holds flushLock)
+     */
+    bool writeRecord(size_t length);
+
+    /**
+     * @brief Note a change to be written back, unless read-only (caller holds writeLock)
+     */
+    void markDirty();
+
+    /**
+     * @brief Modify the current snapshot under writeLock, publish it and schedule write-back
+     *
+     * The read-modify-write happens under the lock, so concurrent setters
+     * never overwrite each other's fields. Listeners are notified after the
+     * lock is released.
+     * @param mutate Called as mutate(ConfigSnapshot&) on a copy of the current snapshot
+     * @return Error::OK, or Error::NVS_WRITE_FAIL if NVS is unavailable (snapshot unchanged)
+     */
+    template <typename Mutator>
+    Error store(ConfigChange change, Mutator mutate);
+
+    /**
+     * @brief Publish a snapshot (caller holds writeLock, or is begin())
+     */
+    void commit(const ConfigSnapshot& next, ConfigChange change);
+
+    /**
+     * @brief Tell listeners about a change (never called with writeLock held)
+     */
+    void notify(ConfigChange change);
 };
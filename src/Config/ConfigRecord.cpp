@@ -0,0 +1,205 @@
+#include "ConfigRecord.h"
+#include <string.h>
+#include "Enum/ConfigRecordTagEnum.h"
+#include "Enum/WheelDirection.h"
+#include "Enum/ZoomStrategyEnum.h"
+
+namespace {
+
+void putU16(uint8_t* p, uint16_t value) {
+    p[0] = static_cast<uint8_t>(value);
+    p[1] = static_cast<uint8_t>(value >> 8);
+}
+
+void putU32(uint8_t* p, uint32_t value) {
+    putU16(p, static_cast<uint16_t>(value));
+    putU16(p + 2, static_cast<uint16_t>(value >> 16));
+}
+
+uint16_t getU16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t getU32(const uint8_t* p) {
+    return getU16(p) | (static_cast<uint32_t>(getU16(p + 2)) << 16);
+}
+
+/**
+ * @brief Bounds-checked entry writer; any overflow sticks and fails the record
+ */
+struct EntryWriter {
+    uint8_t* out;
+    size_t capacity;
+    size_t used;
+    bool overflow;
+
+    uint8_t* begin(ConfigRecordTag tag, size_t length) {
+        if (overflow || length > UINT16_MAX || used + ConfigRecord::ENTRY_HEADER_BYTES + length > capacity) {
+            overflow = true;
+            return nullptr;
+        }
+        out[used] = static_cast<uint8_t>(tag);
+        putU16(out + used + 1, static_cast<uint16_t>(length));
+        uint8_t* value = out + used + ConfigRecord::ENTRY_HEADER_BYTES;
+        used += ConfigRecord::ENTRY_HEADER_BYTES + length;
+        return value;
+    }
+
+    void putByte(ConfigRecordTag tag, uint8_t value) {
+        uint8_t* p = begin(tag, 1);
+        if (p) {
+            p[0] = value;
+        }
+    }
+};
+
+}  // namespace
+
+size_t ConfigRecord::write(const ConfigSnapshot& config, const MacroProgram* programs,
+                           uint8_t* out, size_t capacity) {
+    if (capacity < HEADER_BYTES) {
+        return 0;
+    }
+
+    EntryWriter writer{ out + HEADER_BYTES, capacity - HEADER_BYTES, 0, false };
+
+    writer.putByte(ConfigRecordTag::WHEEL_MODE, static_cast<uint8_t>(config.wheelMode));
+    writer.putByte(ConfigRecordTag::WHEEL_DIRECTION, static_cast<uint8_t>(config.wheelDirection));
+    writer.putByte(ConfigRecordTag::ZOOM_STRATEGY, static_cast<uint8_t>(config.zoomStrategy));
+
+    if (uint8_t* p = writer.begin(ConfigRecordTag::BUTTON_ACTIONS, BUTTON_COUNT)) {
+        memcpy(p, config.buttonActions, BUTTON_COUNT);
+    }
+
+    if (uint8_t* p = writer.begin(ConfigRecordTag::MACROS, 2 * MACRO_COUNT)) {
+        for (uint8_t i = 0; i < MACRO_COUNT; i++) {
+            putU16(p + 2 * i, config.macros[i]);
+        }
+    }
+
+    for (uint8_t i = 0; i < CURVE_COUNT; i++) {
+        if (uint8_t* p = writer.begin(ConfigRecordTag::ACCEL_CURVE, 1 + sizeof(AccelerationCurve))) {
+            p[0] = i;
+            memcpy(p + 1, &config.accelerationCurves[i], sizeof(AccelerationCurve));
+        }
+    }
+
+    for (uint8_t i = 0; programs && i < MACRO_COUNT; i++) {
+        if (programs[i].isEmpty()) {
+            continue;
+        }
+        if (uint8_t* p = writer.begin(ConfigRecordTag::MACRO_PROGRAM, 1 + programs[i].length)) {
+            p[0] = i;
+            memcpy(p + 1, programs[i].code, programs[i].length);
+        }
+    }
+
+    if (writer.overflow) {
+        return 0;
+    }
+
+    putU32(out, MAGIC);
+    putU16(out + 4, SCHEMA_VERSION);
+    putU16(out + 6, static_cast<uint16_t>(writer.used));
+    putU32(out + 8, crc32(out + HEADER_BYTES, writer.used));
+    return HEADER_BYTES + writer.used;
+}
+
+Error ConfigRecord::read(const uint8_t* data, size_t length, ConfigSnapshot& config, MacroProgram* programs) {
+    if (length < HEADER_BYTES || getU32(data) != MAGIC) {
+        return Error::INVALID_PARAM;
+    }
+
+    uint16_t version = getU16(data + 4);
+    uint16_t payloadLength = getU16(data + 6);
+    if (version > SCHEMA_VERSION) {
+        return Error::INVALID_STATE;
+    }
+    if (HEADER_BYTES + payloadLength > length ||
+        crc32(data + HEADER_BYTES, payloadLength) != getU32(data + 8)) {
+        return Error::INVALID_PARAM;
+    }
+
+    // Check every entry header before applying anything, so a bad record changes nothing
+    const uint8_t* payload = data + HEADER_BYTES;
+    for (size_t pos = 0; pos < payloadLength;) {
+        if (pos + ENTRY_HEADER_BYTES > payloadLength ||
+            pos + ENTRY_HEADER_BYTES + getU16(payload + pos + 1) > payloadLength) {
+            return Error::INVALID_PARAM;
+        }
+        pos += ENTRY_HEADER_BYTES + getU16(payload + pos + 1);
+    }
+
+    // Schema 1 is the only layout so far; older versions would be converted here
+    for (size_t pos = 0; pos < payloadLength;) {
+        ConfigRecordTag tag = static_cast<ConfigRecordTag>(payload[pos]);
+        uint16_t size = getU16(payload + pos + 1);
+        const uint8_t* value = payload + pos + ENTRY_HEADER_BYTES;
+        pos += ENTRY_HEADER_BYTES + size;
+
+        switch (tag) {
+            case ConfigRecordTag::WHEEL_MODE:
+                if (size == 1 && value[0] <= WheelMode_MAX) {
+                    config.wheelMode = static_cast<WheelMode>(value[0]);
+                }
+                break;
+
+            case ConfigRecordTag::WHEEL_DIRECTION:
+                if (size == 1 && value[0] <= WheelDirection_MAX) {
+                    config.wheelDirection = static_cast<WheelDirection>(value[0]);
+                }
+                break;
+
+            case ConfigRecordTag::ZOOM_STRATEGY:
+                if (size == 1 && value[0] <= ZoomStrategy_MAX) {
+                    config.zoomStrategy = static_cast<ZoomStrategy>(value[0]);
+                }
+                break;
+
+            case ConfigRecordTag::BUTTON_ACTIONS:
+                // Button count may differ between builds: take what both know
+                memcpy(config.buttonActions, value, size < BUTTON_COUNT ? size : BUTTON_COUNT);
+                break;
+
+            case ConfigRecordTag::MACROS:
+                for (uint8_t i = 0; i < MACRO_COUNT && 2 * i + 1 < size; i++) {
+                    config.macros[i] = getU16(value + 2 * i);
+                }
+                break;
+
+            case ConfigRecordTag::ACCEL_CURVE:
+                if (size == 1 + sizeof(AccelerationCurve) && value[0] < CURVE_COUNT) {
+                    memcpy(&config.accelerationCurves[value[0]], value + 1, sizeof(AccelerationCurve));
+                }
+                break;
+
+            case ConfigRecordTag::MACRO_PROGRAM:
+                if (programs && size >= 2 && size - 1 <= MACRO_PROGRAM_MAX_BYTES && value[0] < MACRO_COUNT) {
+                    MacroProgram& program = programs[value[0]];
+                    program.length = size - 1;
+                    memcpy(program.code, value + 1, program.length);
+                }
+                break;
+
+            default:
+                break;  // Written by newer firmware: skip
+        }
+    }
+    return Error::OK;
+}
+
+uint32_t ConfigRecord::crc32(const uint8_t* data, size_t length) {
+    // Nibble table: 64 bytes of flash instead of 1 KB for the byte table
+    static const uint32_t TABLE[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    };
+
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ TABLE[crc & 0x0F];
+        crc = (crc >> 4) ^ TABLE[crc & 0x0F];
+    }
+    return ~crc;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+/**
+ * @file ConfigRecord.h
+ * @brief Binary layout of the single NVS config blob
+ *
+ * Record: header | payload
+ *   header:  magic u32 "KCFG" | schemaVersion u16 | payloadLength u16 | crc32 u32 (of payload)
+ *   payload: entries of tag u8 | length u16 LE | value (see ConfigRecordTag)
+ *
+ * Entries missing from a record keep the caller's defaults and unknown
+ * tags are skipped, so adding settings needs no migration. The schema
+ * version only changes when an existing entry changes meaning; read()
+ * then converts older layouts.
+ *
+ * Pure serialization with no NVS or Arduino dependency, so it builds and
+ * runs on the host as well. Multi-byte values are little endian, as on
+ * the ESP32.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "Enum/ErrorEnum.h"
+#include "Enum/MacroInputEnum.h"
+#include "Enum/WheelModeEnum.h"
+#include "Type/AccelerationCurve.h"
+#include "Type/ConfigSnapshot.h"
+#include "Type/MacroProgram.h"
+
+class ConfigRecord {
+public:
+    static constexpr uint32_t MAGIC = 0x4746434B;  // "KCFG" little endian
+    static constexpr uint16_t SCHEMA_VERSION = 1;
+    static constexpr size_t HEADER_BYTES = 12;
+    static constexpr size_t ENTRY_HEADER_BYTES = 3;
+    static constexpr uint8_t MACRO_COUNT = static_cast<uint8_t>(MacroInput::COUNT);
+    static constexpr uint8_t CURVE_COUNT = WheelMode_MAX + 1;
+
+    /// Largest possible record: every entry present, every program at full size
+    static constexpr size_t MAX_BYTES =
+        HEADER_BYTES +
+        3 * (ENTRY_HEADER_BYTES + 1) +
+        ENTRY_HEADER_BYTES + BUTTON_COUNT +
+        ENTRY_HEADER_BYTES + 2 * MACRO_COUNT +
+        CURVE_COUNT * (ENTRY_HEADER_BYTES + 1 + sizeof(AccelerationCurve)) +
+        MACRO_COUNT * (ENTRY_HEADER_BYTES + 1 + MACRO_PROGRAM_MAX_BYTES);
+
+    /**
+     * @brief Serialize a snapshot and the macro programs
+     * @param programs MACRO_COUNT programs (empty ones are not written)
+     * @return Bytes written, 0 if capacity is too small
+     */
+    static size_t write(const ConfigSnapshot& config, const MacroProgram* programs,
+                        uint8_t* out, size_t capacity);
+
+    /**
+     * @brief Parse a record over caller-provided defaults
+     *
+     * Enum values out of range are ignored (the default stays); callers
+     * still validate button action IDs, curves and program bytecode.
+     * @param programs MACRO_COUNT programs to fill (untouched entries keep their value)
+     * @return Error::OK, Error::INVALID_PARAM for a truncated/corrupt record (bad magic, length or CRC),
+     *         Error::INVALID_STATE for a schema newer than this firmware
+     */
+    static Error read(const uint8_t* data, size_t length, ConfigSnapshot& config, MacroProgram* programs);
+
+    /**
+     * @brief CRC-32 (IEEE 802.3, reflected, as zlib.crc32)
+     */
+    static uint32_t crc32(const uint8_t* data, size_t length);
+};
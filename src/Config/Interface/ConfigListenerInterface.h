@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Enum/ConfigChangeEnum.h"
+
+struct ConfigSnapshot;
+
+/**
+ * @brief Interface for components that react to configuration changes
+ *
+ * Register with ConfigManager::subscribe(). Called from the writer's task
+ * once the new value is in the RAM snapshot (write-back to NVS is deferred)
+ * and ConfigManager's locks are released, so a listener may call back into
+ * ConfigManager.
+ */
+class ConfigListenerInterface {
+public:
+    virtual ~ConfigListenerInterface() = default;
+
+    /**
+     * @brief Configuration changed
+     * @param change Which part of the snapshot was written
+     * @param snapshot The current snapshot (includes this change and any that raced with it)
+     */
+    virtual void onConfigChanged(ConfigChange change, const ConfigSnapshot& snapshot) = 0;
+};
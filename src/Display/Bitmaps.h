@@ -1,17 +1,23 @@
 #pragma once
 
-#include <Arduino.h>
 #include <stdint.h>
+#include "Frame/PageFormat.h"
 
 /**
  * @brief Icon bitmaps for OLED status display
  *
- * All bitmaps stored in PROGMEM (flash) to save RAM.
+ * Drawn here row by row (MSB = leftmost pixel) for readability and
+ * converted to SSD1306 page format at compile time; only the page-format
+ * copies are referenced, so they are what ends up in flash.
  * Icons are 8x8 pixels, designed for 128x32 OLED display.
  */
 
+// Icon dimensions
+constexpr uint8_t ICON_WIDTH = 8;
+constexpr uint8_t ICON_HEIGHT = 8;
+
 // Bluetooth icon (8x8) - Bluetooth symbol
-const unsigned char PROGMEM btIcon[] = {
+constexpr uint8_t btIconRows[] = {
     0b00010000,
     0b00011000,
     0b01010100,
@@ -23,7 +29,7 @@ const unsigned char PROGMEM btIcon[] = {
 };
 
 // Battery icon (8x8) - Battery outline
-const unsigned char PROGMEM batteryIcon[] = {
+constexpr uint8_t batteryIconRows[] = {
     0b00111100,
     0b01111110,
     0b01000010,
@@ -35,7 +41,7 @@ const unsigned char PROGMEM batteryIcon[] = {
 };
 
 // Arrow up icon (8x8) - Up arrow for normal direction
-const unsigned char PROGMEM arrowUpIcon[] = {
+constexpr uint8_t arrowUpIconRows[] = {
     0b00010000,
     0b00111000,
     0b01111100,
@@ -47,7 +53,7 @@ const unsigned char PROGMEM arrowUpIcon[] = {
 };
 
 // Arrow down icon (8x8) - Down arrow for reversed direction
-const unsigned char PROGMEM arrowDownIcon[] = {
+constexpr uint8_t arrowDownIconRows[] = {
     0b00010000,
     0b00010000,
     0b00010000,
@@ -58,6 +64,8 @@ const unsigned char PROGMEM arrowDownIcon[] = {
     0b00010000
 };
 
-// Icon dimensions
-constexpr uint8_t ICON_WIDTH = 8;
-constexpr uint8_t ICON_HEIGHT = 8;
+// Page-format icons for PageBlitter
+constexpr auto btIcon = toPageImage<ICON_WIDTH, ICON_HEIGHT>(btIconRows);
+constexpr auto batteryIcon = toPageImage<ICON_WIDTH, ICON_HEIGHT>(batteryIconRows);
+constexpr auto arrowUpIcon = toPageImage<ICON_WIDTH, ICON_HEIGHT>(arrowUpIconRows);
+constexpr auto arrowDownIcon = toPageImage<ICON_WIDTH, ICON_HEIGHT>(arrowDownIconRows);
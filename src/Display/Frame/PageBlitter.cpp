@@ -0,0 +1,151 @@
+#include "PageBlitter.h"
+#include <string.h>
+#include "PageFont.h"
+
+namespace {
+
+inline void paint(uint8_t& target, uint8_t bits, PageBlitter::Ink ink) {
+    if (ink == PageBlitter::Ink::WHITE) {
+        target |= bits;
+    } else {
+        target &= ~bits;
+    }
+}
+
+// Each nibble bit doubled: scales a glyph column to twice its height
+constexpr uint8_t DOUBLE_NIBBLE[16] = {
+    0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+    0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF
+};
+
+// Floor division by 8 for negative coordinates too
+inline int16_t pageOf(int16_t y) {
+    return y >= 0 ? y / 8 : -((7 - y) / 8);
+}
+
+}  // namespace
+
+PageBlitter::PageBlitter(uint8_t* frame)
+    : frame(frame) {
+}
+
+void PageBlitter::clear() {
+    memset(frame, 0, OLED_FRAME_BYTES);
+}
+
+void PageBlitter::blit(int16_t x, int16_t y, const uint8_t* columns, uint8_t width, uint8_t pages, Ink ink) {
+    // Clip columns once; rows are clipped per page below
+    int16_t first = x < 0 ? -x : 0;
+    int16_t last = x + width > OLED_SCREEN_WIDTH ? OLED_SCREEN_WIDTH - x : width;
+    if (first >= last) {
+        return;
+    }
+
+    int16_t topPage = pageOf(y);
+    uint8_t shift = static_cast<uint8_t>(y - topPage * 8);
+
+    for (uint8_t p = 0; p < pages; p++) {
+        const uint8_t* source = columns + p * width;
+        int16_t page = topPage + p;
+        bool upperVisible = page >= 0 && page < OLED_PAGE_COUNT;
+
+        if (shift == 0) {
+            // Page-aligned: one source byte lands in one frame byte
+            if (!upperVisible) {
+                continue;
+            }
+            uint8_t* target = frame + page * OLED_SCREEN_WIDTH;
+            for (int16_t i = first; i < last; i++) {
+                paint(target[x + i], source[i], ink);
+            }
+            continue;
+        }
+
+        bool lowerVisible = page + 1 >= 0 && page + 1 < OLED_PAGE_COUNT;
+        for (int16_t i = first; i < last; i++) {
+            uint8_t bits = source[i];
+            if (bits == 0) {
+                continue;
+            }
+            if (upperVisible) {
+                paint(frame[page * OLED_SCREEN_WIDTH + x + i], static_cast<uint8_t>(bits << shift), ink);
+            }
+            if (lowerVisible) {
+                paint(frame[(page + 1) * OLED_SCREEN_WIDTH + x + i], static_cast<uint8_t>(bits >> (8 - shift)), ink);
+            }
+        }
+    }
+}
+
+void PageBlitter::fillRect(int16_t x, int16_t y, int16_t width, int16_t height, Ink ink) {
+    int16_t left = x < 0 ? 0 : x;
+    int16_t right = x + width > OLED_SCREEN_WIDTH ? OLED_SCREEN_WIDTH : x + width;
+    int16_t top = y < 0 ? 0 : y;
+    int16_t bottom = y + height > OLED_SCREEN_HEIGHT ? OLED_SCREEN_HEIGHT : y + height;
+    if (left >= right || top >= bottom) {
+        return;
+    }
+
+    for (int16_t page = top / 8; page <= (bottom - 1) / 8; page++) {
+        // Rows of this page inside [top, bottom)
+        int16_t from = top > page * 8 ? top - page * 8 : 0;
+        int16_t to = bottom < (page + 1) * 8 ? bottom - page * 8 : 8;
+        uint8_t mask = static_cast<uint8_t>((0xFF << from) & (0xFF >> (8 - to)));
+
+        uint8_t* row = frame + page * OLED_SCREEN_WIDTH;
+        if (mask == 0xFF) {
+            memset(row + left, ink == Ink::WHITE ? 0xFF : 0x00, right - left);
+            continue;
+        }
+        for (int16_t column = left; column < right; column++) {
+            paint(row[column], mask, ink);
+        }
+    }
+}
+
+int16_t PageBlitter::drawText(int16_t x, int16_t y, const char* text, uint8_t scale, Ink ink) {
+    if (text == nullptr) {
+        return x;
+    }
+    if (scale < 1) {
+        scale = 1;
+    } else if (scale > MAX_TEXT_SCALE) {
+        scale = MAX_TEXT_SCALE;
+    }
+
+    for (const char* c = text; *c != '\0' && x < OLED_SCREEN_WIDTH; c++) {
+        drawGlyph(x, y, *c, scale, ink);
+        x += PAGE_FONT_ADVANCE * scale;
+    }
+    return x;
+}
+
+uint16_t PageBlitter::textWidth(const char* text, uint8_t scale) {
+    if (text == nullptr) {
+        return 0;
+    }
+    if (scale > MAX_TEXT_SCALE) {
+        scale = MAX_TEXT_SCALE;
+    }
+    return static_cast<uint16_t>(strlen(text) * PAGE_FONT_ADVANCE * (scale < 1 ? 1 : scale));
+}
+
+void PageBlitter::drawGlyph(int16_t x, int16_t y, char c, uint8_t scale, Ink ink) {
+    const uint8_t* glyph = pageFontGlyph(c);
+
+    if (scale == 1) {
+        blit(x, y, glyph, PAGE_FONT_GLYPH_WIDTH, 1, ink);
+        return;
+    }
+
+    // Scale 2: each column byte becomes two pages tall and two columns wide
+    constexpr uint8_t SCALED_WIDTH = PAGE_FONT_GLYPH_WIDTH * 2;
+    uint8_t scaled[2 * SCALED_WIDTH];
+    for (uint8_t i = 0; i < PAGE_FONT_GLYPH_WIDTH; i++) {
+        uint8_t upper = DOUBLE_NIBBLE[glyph[i] & 0x0F];
+        uint8_t lower = DOUBLE_NIBBLE[glyph[i] >> 4];
+        scaled[2 * i] = scaled[2 * i + 1] = upper;
+        scaled[SCALED_WIDTH + 2 * i] = scaled[SCALED_WIDTH + 2 * i + 1] = lower;
+    }
+    blit(x, y, scaled, SCALED_WIDTH, 2, ink);
+}
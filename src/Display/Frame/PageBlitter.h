@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdint.h>
+#include "Config/display_config.h"
+#include "PageFormat.h"
+
+/**
+ * @brief Byte-wise drawing into an SSD1306 page-format frame
+ *
+ * Replaces Adafruit GFX's per-pixel print/drawBitmap for the OLED
+ * screens: glyphs (PageFont) and icons (PageImage) are already stored as
+ * column bytes, so drawing ORs (or, for black ink, clears) whole bytes.
+ * Draws starting on a page boundary (y % 8 == 0) copy each byte into one
+ * frame byte; other rows split each byte across two pages with a shift.
+ * Everything is clipped to the frame.
+ *
+ * Works on any OLED_FRAME_BYTES buffer (the Adafruit buffer on target);
+ * no Arduino dependency.
+ */
+class PageBlitter {
+public:
+    enum class Ink : uint8_t {
+        WHITE,  ///< Set pixels
+        BLACK   ///< Clear pixels (text on a filled highlight)
+    };
+
+    static constexpr uint8_t MAX_TEXT_SCALE = 2;
+
+    explicit PageBlitter(uint8_t* frame);
+
+    void clear();
+
+    /**
+     * @brief Draw page-format columns at any position
+     * @param columns Page-major column bytes (width per page, pages pages)
+     */
+    void blit(int16_t x, int16_t y, const uint8_t* columns, uint8_t width, uint8_t pages, Ink ink = Ink::WHITE);
+
+    template <uint8_t W, uint8_t H>
+    void blit(int16_t x, int16_t y, const PageImage<W, H>& image, Ink ink = Ink::WHITE) {
+        blit(x, y, image.columns, W, PageImage<W, H>::PAGES, ink);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t width, int16_t height, Ink ink = Ink::WHITE);
+
+    /**
+     * @brief Draw a string with the 5x7 page font
+     * @param scale 1 or 2 (larger values are drawn at MAX_TEXT_SCALE)
+     * @return x after the last character
+     */
+    int16_t drawText(int16_t x, int16_t y, const char* text, uint8_t scale = 1, Ink ink = Ink::WHITE);
+
+    /**
+     * @brief Advance width of a string, as Adafruit getTextBounds reports it
+     */
+    static uint16_t textWidth(const char* text, uint8_t scale = 1);
+
+private:
+    uint8_t* frame;
+
+    void drawGlyph(int16_t x, int16_t y, char c, uint8_t scale, Ink ink);
+};
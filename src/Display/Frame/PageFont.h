@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief 5x7 ASCII font in SSD1306 page format
+ *
+ * Same metrics as the Adafruit GFX built-in font (5 columns plus one
+ * blank, 8 rows), so layouts computed for it still line up. Each glyph is
+ * PAGE_FONT_GLYPH_WIDTH column bytes, LSB on top.
+ */
+constexpr char PAGE_FONT_FIRST_CHAR = 0x20;
+constexpr char PAGE_FONT_LAST_CHAR = 0x7E;
+constexpr char PAGE_FONT_FALLBACK_CHAR = '?';     // Drawn for characters outside the table
+constexpr uint8_t PAGE_FONT_GLYPH_WIDTH = 5;
+constexpr uint8_t PAGE_FONT_ADVANCE = 6;          // Glyph plus one blank column
+constexpr uint8_t PAGE_FONT_HEIGHT = 8;
+
+extern const uint8_t PAGE_FONT_5X7[(PAGE_FONT_LAST_CHAR - PAGE_FONT_FIRST_CHAR + 1) * PAGE_FONT_GLYPH_WIDTH];
+
+/**
+ * @brief Column bytes of a character's glyph (fallback glyph if not in the table)
+ */
+inline const uint8_t* pageFontGlyph(char c) {
+    if (c < PAGE_FONT_FIRST_CHAR || c > PAGE_FONT_LAST_CHAR) {
+        c = PAGE_FONT_FALLBACK_CHAR;
+    }
+    return &PAGE_FONT_5X7[(c - PAGE_FONT_FIRST_CHAR) * PAGE_FONT_GLYPH_WIDTH];
+}
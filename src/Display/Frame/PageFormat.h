@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Bitmap in SSD1306 page format, built at compile time
+ *
+ * The panel (and the Adafruit buffer) stores 8 vertical pixels per byte,
+ * LSB on top, one byte per column, page after page. Images kept in that
+ * layout are copied into the frame a byte at a time instead of pixel by
+ * pixel. Storage is page-major: the WIDTH columns of page 0, then page 1.
+ */
+template <uint8_t W, uint8_t H>
+struct PageImage {
+    static constexpr uint8_t WIDTH = W;
+    static constexpr uint8_t HEIGHT = H;
+    static constexpr uint8_t PAGES = (H + 7) / 8;
+
+    uint8_t columns[W * PAGES];
+};
+
+/**
+ * @brief Convert a row-major bitmap (Adafruit drawBitmap layout, MSB = leftmost pixel)
+ *
+ * Meant for constexpr use, so icons can be drawn readably in source and
+ * only the page-format copy ends up in flash:
+ *   constexpr auto icon = toPageImage<8, 8>(iconRows);
+ */
+template <uint8_t W, uint8_t H>
+constexpr PageImage<W, H> toPageImage(const uint8_t (&rows)[(W + 7) / 8 * H]) {
+    PageImage<W, H> image{};
+    constexpr uint8_t bytesPerRow = (W + 7) / 8;
+
+    for (uint8_t y = 0; y < H; y++) {
+        for (uint8_t x = 0; x < W; x++) {
+            if (rows[y * bytesPerRow + x / 8] & (0x80 >> (x % 8))) {
+                image.columns[(y / 8) * W + x] |= static_cast<uint8_t>(1 << (y % 8));
+            }
+        }
+    }
+    return image;
+}
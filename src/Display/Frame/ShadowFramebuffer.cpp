@@ -0,0 +1,49 @@
+#include "ShadowFramebuffer.h"
+#include <string.h>
+
+ShadowFramebuffer::ShadowFramebuffer()
+    : shadow{}
+    , valid(false) {
+}
+
+uint8_t ShadowFramebuffer::diff(const uint8_t* frame, PageSpan* spans) const {
+    uint8_t count = 0;
+
+    for (uint8_t page = 0; page < OLED_PAGE_COUNT; page++) {
+        const uint8_t* next = frame + page * OLED_SCREEN_WIDTH;
+        const uint8_t* current = shadow + page * OLED_SCREEN_WIDTH;
+        uint8_t pageSpans = 0;
+
+        for (uint8_t column = 0; column < OLED_SCREEN_WIDTH; column++) {
+            if (valid && next[column] == current[column]) {
+                continue;
+            }
+
+            // Resending unchanged bytes is cheaper than a new window when the gap is short
+            if (pageSpans > 0 &&
+                (column - spans[count - 1].lastColumn - 1 <= OLED_SPAN_OVERHEAD_BYTES ||
+                 pageSpans == OLED_MAX_SPANS_PER_PAGE)) {
+                spans[count - 1].lastColumn = column;
+                continue;
+            }
+
+            spans[count++] = PageSpan{ page, column, column };
+            pageSpans++;
+        }
+    }
+    return count;
+}
+
+void ShadowFramebuffer::apply(const uint8_t* frame, const PageSpan* spans, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t offset = spans[i].page * OLED_SCREEN_WIDTH + spans[i].firstColumn;
+        memcpy(shadow + offset, frame + offset, spans[i].width());
+    }
+
+    // A full diff covers every page, so after applying it the shadow matches the panel
+    valid = true;
+}
+
+void ShadowFramebuffer::invalidate() {
+    valid = false;
+}
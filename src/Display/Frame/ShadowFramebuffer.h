@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+#include "Config/display_config.h"
+#include "Type/PageSpan.h"
+
+/**
+ * @brief Copy of what the SSD1306 currently shows, for partial flushes
+ *
+ * diff() compares a rendered frame (Adafruit_SSD1306 buffer layout: page
+ * major, one byte per column) against the shadow and returns the column
+ * spans per page that must be sent. Changed runs in a page are merged
+ * when the gap between them costs less than opening another address
+ * window (OLED_SPAN_OVERHEAD_BYTES), and at most OLED_MAX_SPANS_PER_PAGE
+ * spans are produced per page. After the spans were sent, apply() brings
+ * the shadow up to date.
+ *
+ * Pure logic (no Arduino or Wire dependency).
+ */
+class ShadowFramebuffer {
+public:
+    static constexpr uint8_t MAX_SPANS = OLED_PAGE_COUNT * OLED_MAX_SPANS_PER_PAGE;
+
+    ShadowFramebuffer();
+
+    /**
+     * @brief Find the spans where frame differs from the panel
+     * @param frame Rendered frame, OLED_FRAME_BYTES long
+     * @param spans Output, room for MAX_SPANS
+     * @return Number of spans (0 if nothing changed); every page in full while invalid
+     */
+    uint8_t diff(const uint8_t* frame, PageSpan* spans) const;
+
+    /**
+     * @brief Record that spans of frame are now on the panel
+     */
+    void apply(const uint8_t* frame, const PageSpan* spans, uint8_t count);
+
+    /**
+     * @brief Panel contents unknown (init, failed transfer): next diff sends everything
+     */
+    void invalidate();
+
+private:
+    uint8_t shadow[OLED_FRAME_BYTES];
+    bool valid;
+};
@@ -1,6 +1,7 @@
 #include "OLEDDisplay.h"
 #include "state/HardwareState.h"
 #include "../Bitmaps.h"
+#include "../Frame/PageBlitter.h"
 #include "Config/log_config.h"
 #include <Wire.h>
 
@@ -24,17 +25,27 @@ void OLEDDisplay::ensureInitialized() {
         return;
     }
 
+    // Text and icons are drawn by PageBlitter, so Adafruit's text state is never set up
     display.clearDisplay();
-    display.setTextSize(1);
-    display.setTextColor(SSD1306_WHITE);
-    display.setTextWrap(false);  // Prevent long text from wrapping
-    display.cp437(true);
-    display.display();
 
     initialized = true;
+    flushTask.start();  // On failure frames are sent synchronously
+    flush();            // The shadow starts invalid: clears all of the panel RAM
     LOG_INFO(TAG, "Initialized 128x32 SSD1306");
 }
 
+void OLEDDisplay::flush() {
+    flushTask.submit(display.getBuffer());
+}
+
+void OLEDDisplay::logStats() const {
+    FrameFlushStats s = flushTask.getStats();
+    [[maybe_unused]] uint32_t sentFrames = s.frames - s.unchangedFrames;
+    LOG_INFO(TAG, "flush: frames=%lu unchanged=%lu waited=%lu spans=%lu bytes=%lu avg=%lu/frame last=%u (full frame %u) failed=%lu",
+             s.frames, s.unchangedFrames, s.waits, s.spans, s.bytes, sentFrames ? s.bytes / sentFrames : 0,
+             s.lastFrameBytes, OLED_FRAME_BYTES, s.failures);
+}
+
 void OLEDDisplay::showMenu(const char* title, const char* const* items, uint8_t count, uint8_t selected, const HardwareState& hwState) {
     ensureInitialized();
 
@@ -42,10 +53,11 @@ void OLEDDisplay::showMenu(const char* title, const char* const* items, uint8_t
         return;
     }
 
-    display.clearDisplay();
+    PageBlitter canvas(display.getBuffer());
+    canvas.clear();
 
     // Draw status bar (y=0-7) with BT icon and mode indicator
-    drawMenuModeStatusBar(hwState);
+    drawMenuModeStatusBar(canvas, hwState);
 
     // Display menu items starting below status bar (y=8)
     // With 24 pixels available (y=8-31) and 8px font, we can show 3 items
@@ -66,36 +78,26 @@ void OLEDDisplay::showMenu(const char* title, const char* const* items, uint8_t
     }
 
     // Render menu items with highlighting for selected item
+    // Rows are page-aligned, so every fill and glyph is a whole-byte copy
     for (uint8_t i = 0; i < maxVisibleItems && (windowStart + i) < count; i++) {
         uint8_t itemIdx = windowStart + i;
         uint8_t itemY = startY + (i * lineHeight);
         bool isSelected = (itemIdx == selected);
+        PageBlitter::Ink ink = PageBlitter::Ink::WHITE;
 
         // Apply highlighting to selected item (inverted colors)
         if (isSelected) {
-            // Draw white filled rectangle behind selected item
-            display.fillRect(0, itemY, OLED_SCREEN_WIDTH, lineHeight, SSD1306_WHITE);
-            display.setTextColor(SSD1306_BLACK);
-        } else {
-            // Normal colors for non-selected items
-            display.setTextColor(SSD1306_WHITE);
-        }
-
-        // Draw arrow indicator for selected item
-        display.setCursor(0, itemY);
-        if (isSelected) {
-            display.print(">");
+            // Draw white filled rectangle behind selected item, arrow indicator on it
+            canvas.fillRect(0, itemY, OLED_SCREEN_WIDTH, lineHeight);
+            ink = PageBlitter::Ink::BLACK;
+            canvas.drawText(0, itemY, ">", 1, ink);
         }
 
         // Draw menu item text
-        display.setCursor(isSelected ? 10 : 4, itemY);  // Offset for arrow
-        display.print(items[itemIdx] != nullptr ? items[itemIdx] : "");
-
-        // Reset text color for next item
-        display.setTextColor(SSD1306_WHITE);
+        canvas.drawText(isSelected ? 10 : 4, itemY, items[itemIdx] != nullptr ? items[itemIdx] : "", 1, ink);  // Offset for arrow
     }
 
-    display.display();
+    flush();
 }
 
 void OLEDDisplay::showMessage(const char* message) {
@@ -105,14 +107,15 @@ void OLEDDisplay::showMessage(const char* message) {
         return;
     }
 
-    display.clearDisplay();
+    PageBlitter canvas(display.getBuffer());
+    canvas.clear();
 
     // Center message vertically (y=12 for 32px height)
     if (message != nullptr) {
-        centerText(message, 12);
+        centerText(canvas, message, 12);
     }
 
-    display.display();
+    flush();
 }
 
 void OLEDDisplay::showConfirmation(const char* message) {
@@ -122,19 +125,18 @@ void OLEDDisplay::showConfirmation(const char* message) {
         return;
     }
 
-    display.clearDisplay();
+    PageBlitter canvas(display.getBuffer());
+    canvas.clear();
 
     // Show checkmark or "OK" at top
-    display.setCursor(0, 0);
-    display.print("[OK]");
+    canvas.drawText(0, 0, "[OK]");
 
     // Show message below
     if (message != nullptr) {
-        display.setCursor(0, 12);
-        display.print(message);
+        canvas.drawText(0, 12, message);
     }
 
-    display.display();
+    flush();
 }
 
 void OLEDDisplay::showStatus(const char* key, const char* value) {
@@ -144,22 +146,21 @@ void OLEDDisplay::showStatus(const char* key, const char* value) {
         return;
     }
 
-    display.clearDisplay();
+    PageBlitter canvas(display.getBuffer());
+    canvas.clear();
 
     // Show key on first line
     if (key != nullptr) {
-        display.setCursor(0, 0);
-        display.print(key);
-        display.print(":");
+        int16_t x = canvas.drawText(0, 0, key);
+        canvas.drawText(x, 0, ":");
     }
 
     // Show value on second line
     if (value != nullptr) {
-        display.setCursor(0, 12);
-        display.print(value);
+        canvas.drawText(0, 12, value);
     }
 
-    display.display();
+    flush();
 }
 
 void OLEDDisplay::clear() {
@@ -169,8 +170,8 @@ void OLEDDisplay::clear() {
         return;
     }
 
-    display.clearDisplay();
-    display.display();
+    PageBlitter(display.getBuffer()).clear();
+    flush();
 }
 
 void OLEDDisplay::drawNormalMode(const HardwareState& hwState) {
@@ -180,150 +181,86 @@ void OLEDDisplay::drawNormalMode(const HardwareState& hwState) {
         return;
     }
 
-    display.clearDisplay();
-    drawStatusBar(hwState);
-    drawModeIndicator(hwState.encoderWheelState.mode);
-    drawDirectionIndicator(hwState.encoderWheelState.direction);
-    display.display();
+    PageBlitter canvas(display.getBuffer());
+    canvas.clear();
+    drawStatusBar(canvas, hwState);
+    drawModeIndicator(canvas, hwState.encoderWheelState.mode);
+    drawDirectionIndicator(canvas, hwState.encoderWheelState.direction);
+    flush();
 }
 
-void OLEDDisplay::drawStatusBar(const HardwareState& hwState) {
+void OLEDDisplay::drawStatusBar(PageBlitter& canvas, const HardwareState& hwState) {
     // STATUS BAR (y=0-7): BT icon + battery
     // Draw BT icon with flashing effect when pairing
     if (hwState.bleState.isConnected) {
         // Solid icon when connected
-        display.drawBitmap(0, 0, btIcon, ICON_WIDTH, ICON_HEIGHT, SSD1306_WHITE);
+        canvas.blit(0, 0, btIcon);
     } else if (hwState.bleState.isPairingMode) {
         // Flashing icon when pairing (time-based toggle for consistency)
         if ((millis() / 500) % 2 == 0) {  // Toggle every 500ms (1Hz blink rate)
-            display.drawBitmap(0, 0, btIcon, ICON_WIDTH, ICON_HEIGHT, SSD1306_WHITE);
+            canvas.blit(0, 0, btIcon);
         }
     }
 
-    // Draw battery percentage on right side of status bar
-    display.setTextSize(1);
-    display.setTextColor(SSD1306_WHITE);
+    // Draw battery percentage right-aligned on the status bar
     char batteryStr[8];
     snprintf(batteryStr, sizeof(batteryStr), "%d%%", hwState.batteryPercent);
-
-    // Calculate x position to right-align battery text
-    int16_t x1, y1;
-    uint16_t w, h;
-    display.getTextBounds(batteryStr, 0, 0, &x1, &y1, &w, &h);
-    display.setCursor(OLED_SCREEN_WIDTH - w - 2, 0);
-    display.print(batteryStr);
+    canvas.drawText(OLED_SCREEN_WIDTH - PageBlitter::textWidth(batteryStr) - 2, 0, batteryStr);
 }
 
-void OLEDDisplay::drawModeIndicator(WheelMode mode) {
+void OLEDDisplay::drawModeIndicator(PageBlitter& canvas, WheelMode mode) {
     // MAIN AREA (y=8-23): Large mode indicator (S/V/Z)
-    display.setTextSize(2);
-    const char* modeChar;
-    switch (mode) {
-        case WheelMode::SCROLL:
-            modeChar = "S";
-            break;
-        case WheelMode::VOLUME:
-            modeChar = "V";
-            break;
-        case WheelMode::ZOOM:
-            modeChar = "Z";
-            break;
-        default:
-            modeChar = "?";
-            break;
-    }
+    const char* modeChar = modeLabel(mode);
 
-    // Center mode indicator horizontally and vertically in main area
-    int16_t x1, y1;
-    uint16_t w, h;
-    display.getTextBounds(modeChar, 0, 0, &x1, &y1, &w, &h);
-    int16_t modeX = (OLED_SCREEN_WIDTH - w) / 2;
-    int16_t modeY = 8 + ((16 - h) / 2);  // 16 = height of main area (y=8-23)
-    display.setCursor(modeX, modeY);
-    display.print(modeChar);
+    // Center mode indicator horizontally; at scale 2 it fills the 16px main area (y=8-23)
+    int16_t modeX = (OLED_SCREEN_WIDTH - PageBlitter::textWidth(modeChar, 2)) / 2;
+    canvas.drawText(modeX, 8, modeChar, 2);
 }
 
-void OLEDDisplay::drawDirectionIndicator(WheelDirection direction) {
+void OLEDDisplay::drawDirectionIndicator(PageBlitter& canvas, WheelDirection direction) {
     // BOTTOM ROW (y=24-31): Direction indicator using arrow bitmaps
-    display.setTextSize(1);
-
     // Draw direction arrow icon (up for normal, down for reversed)
     if (direction == WheelDirection::NORMAL) {
-        display.drawBitmap(0, 24, arrowUpIcon, ICON_WIDTH, ICON_HEIGHT, SSD1306_WHITE);
+        canvas.blit(0, 24, arrowUpIcon);
     } else {
-        display.drawBitmap(0, 24, arrowDownIcon, ICON_WIDTH, ICON_HEIGHT, SSD1306_WHITE);
+        canvas.blit(0, 24, arrowDownIcon);
     }
 }
 
-void OLEDDisplay::drawMenuModeStatusBar(const HardwareState& hwState) {
+void OLEDDisplay::drawMenuModeStatusBar(PageBlitter& canvas, const HardwareState& hwState) {
     // STATUS BAR for MENU MODE (y=0-7): BT icon (left) + mode (center) + battery (right)
-
-    // Draw BT icon on left side with flashing effect when pairing
-    if (hwState.bleState.isConnected) {
-        // Solid icon when connected
-        display.drawBitmap(0, 0, btIcon, ICON_WIDTH, ICON_HEIGHT, SSD1306_WHITE);
-    } else if (hwState.bleState.isPairingMode) {
-        // Flashing icon when pairing (time-based toggle for consistency)
-        if ((millis() / 500) % 2 == 0) {  // Toggle every 500ms (1Hz blink rate)
-            display.drawBitmap(0, 0, btIcon, ICON_WIDTH, ICON_HEIGHT, SSD1306_WHITE);
-        }
-    }
-
-    display.setTextSize(1);
-    display.setTextColor(SSD1306_WHITE);
+    drawStatusBar(canvas, hwState);
 
     // Draw mode indicator in center
-    const char* modeChar;
-    switch (hwState.encoderWheelState.mode) {
-        case WheelMode::SCROLL:
-            modeChar = "S";
-            break;
-        case WheelMode::VOLUME:
-            modeChar = "V";
-            break;
-        case WheelMode::ZOOM:
-            modeChar = "Z";
-            break;
-        default:
-            modeChar = "?";
-            break;
-    }
-
-    // Calculate center position for mode indicator
-    int16_t x1, y1;
-    uint16_t w, h;
-    display.getTextBounds(modeChar, 0, 0, &x1, &y1, &w, &h);
-    int16_t modeX = (OLED_SCREEN_WIDTH - w) / 2;
-    display.setCursor(modeX, 0);
-    display.print(modeChar);
-
-    // Draw battery percentage on right side
-    char batteryStr[8];
-    snprintf(batteryStr, sizeof(batteryStr), "%d%%", hwState.batteryPercent);
-
-    // Calculate x position to right-align battery text
-    display.getTextBounds(batteryStr, 0, 0, &x1, &y1, &w, &h);
-    display.setCursor(OLED_SCREEN_WIDTH - w - 2, 0);
-    display.print(batteryStr);
+    const char* modeChar = modeLabel(hwState.encoderWheelState.mode);
+    canvas.drawText((OLED_SCREEN_WIDTH - PageBlitter::textWidth(modeChar)) / 2, 0, modeChar);
 
     // Draw horizontal separator line at y=7 (bottom of status bar)
-    display.drawLine(0, 7, OLED_SCREEN_WIDTH, 7, SSD1306_WHITE);
+    canvas.fillRect(0, 7, OLED_SCREEN_WIDTH, 1);
 }
 
-void OLEDDisplay::centerText(const char* text, uint8_t y) {
+void OLEDDisplay::centerText(PageBlitter& canvas, const char* text, uint8_t y) {
     if (text == nullptr) {
         return;
     }
 
-    int16_t x1, y1;
-    uint16_t w, h;
-    display.getTextBounds(text, 0, y, &x1, &y1, &w, &h);
-
     // Use int16_t to handle negative values when text > screen width
-    int16_t x = (OLED_SCREEN_WIDTH - w) / 2;
+    int16_t x = (OLED_SCREEN_WIDTH - static_cast<int16_t>(PageBlitter::textWidth(text))) / 2;
     if (x < 0) x = 0;  // Clamp to left edge if text too wide
-    display.setCursor(x, y);
-    display.print(text);
+    canvas.drawText(x, y, text);
+}
+
+const char* OLEDDisplay::modeLabel(WheelMode mode) {
+    switch (mode) {
+        case WheelMode::SCROLL:
+            return "S";
+        case WheelMode::VOLUME:
+            return "V";
+        case WheelMode::ZOOM:
+            return "Z";
+        default:
+            return "?";
+    }
 }
 
 void OLEDDisplay::setPower(bool on) {
@@ -333,16 +270,19 @@ void OLEDDisplay::setPower(bool on) {
         return;
     }
 
+    // The flush task may be mid-frame on the same bus
+    flushTask.lockBus();
+    display.ssd1306_command(on ? SSD1306_DISPLAYON : SSD1306_DISPLAYOFF);
+    flushTask.unlockBus();
+
     if (!on) {
-        display.ssd1306_command(SSD1306_DISPLAYOFF);
         displayOn = false;
-        hardwareState.displayPower = false;  // Update global hardware state
+        hardwareState.update([](HardwareState& state) { state.displayPower = false; });  // Update global hardware state
         LOG_INFO(TAG, "Display OFF");
         return;
     }
 
-    display.ssd1306_command(SSD1306_DISPLAYON);
     displayOn = true;
-    hardwareState.displayPower = true;  // Update global hardware state
+    hardwareState.update([](HardwareState& state) { state.displayPower = true; });  // Update global hardware state
     LOG_INFO(TAG, "Display ON");
 }
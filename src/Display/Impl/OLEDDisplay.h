@@ -6,12 +6,27 @@
 #include "../Interface/DisplayInterface.h"
 #include "state/HardwareState.h"
 #include "Config/display_config.h"
+#include "../Task/FrameFlushTask.h"
+
+class PageBlitter;
 
 /**
  * @brief OLED display implementation of DisplayInterface for 128x32 SSD1306
  *
  * Hardware-backed display implementation using Adafruit SSD1306 driver.
  * Displays menus, messages, and status on physical 128x32 OLED screen.
+ *
+ * Frames are still rendered into the Adafruit buffer, but flush() replaces
+ * Adafruit_SSD1306::display(): the frame is diffed against a shadow copy
+ * of the panel and only the changed column spans of each page are sent,
+ * so a moved menu highlight costs two short spans instead of 512 bytes.
+ * The transfer runs on FrameFlushTask, so the next frame renders into the
+ * Adafruit buffer (back buffer) while the previous one is on the bus.
+ *
+ * Adafruit is only used for init and the frame buffer: text and icons are
+ * drawn by PageBlitter from page-format glyphs and bitmaps, byte by byte
+ * instead of pixel by pixel. Glyph metrics match the Adafruit classic font
+ * (6px advance, 8px line), so layouts are unchanged.
  */
 class OLEDDisplay : public DisplayInterface {
 public:
@@ -35,21 +50,31 @@ public:
      */
     void setPower(bool on) override;
 
+    void logStats() const override;
+
 private:
     Adafruit_SSD1306 display;
     bool initialized;
     bool displayOn;
+    FrameFlushTask flushTask;
 
     void ensureInitialized();
-    void centerText(const char* text, uint8_t y);
+
+    /**
+     * @brief Hand the rendered frame to the flush task (sends only what changed)
+     */
+    void flush();
+    void centerText(PageBlitter& canvas, const char* text, uint8_t y);
 
     // Normal mode drawing helpers (decomposed from drawNormalMode)
-    void drawStatusBar(const HardwareState& hwState);
-    void drawModeIndicator(WheelMode mode);
-    void drawDirectionIndicator(WheelDirection direction);
+    void drawStatusBar(PageBlitter& canvas, const HardwareState& hwState);
+    void drawModeIndicator(PageBlitter& canvas, WheelMode mode);
+    void drawDirectionIndicator(PageBlitter& canvas, WheelDirection direction);
 
     // Menu mode drawing helpers
-    void drawMenuModeStatusBar(const HardwareState& hwState);
+    void drawMenuModeStatusBar(PageBlitter& canvas, const HardwareState& hwState);
+
+    static const char* modeLabel(WheelMode mode);
 
     static constexpr const char* TAG = "OLEDDisplay";
 };
@@ -67,4 +67,9 @@ public:
      * is disabled).
      */
     virtual void setPower(bool on) = 0;
+
+    /**
+     * @brief Log output counters (implementations without any keep the default)
+     */
+    virtual void logStats() const {}
 };
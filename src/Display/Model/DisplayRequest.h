@@ -1,7 +1,9 @@
 #pragma once
 
 #include <stdint.h>
-#include "state/HardwareState.h"
+#include <type_traits>
+
+struct MenuItem;
 
 /**
  * @brief Maximum number of menu items that can be displayed
@@ -26,19 +28,18 @@ enum class DisplayRequestType : uint8_t {
  * All display output goes through DisplayRequestQueue to DisplayTask,
  * which arbitrates access to the shared display hardware.
  *
- * Uses a union to minimize memory footprint while supporting
- * different request types.
+ * A request is an opcode plus a few bytes of arguments. Nothing that can
+ * be looked up at draw time is copied: menu labels are read from the
+ * (static) menu tree, and the status bar and status screen come from a
+ * HardwareStateStore snapshot taken when the frame is rendered.
  */
 struct DisplayRequest {
     DisplayRequestType type;
 
     union {
         struct {
-            const char* title;                          ///< Menu title
-            const char* items[DISPLAY_MAX_MENU_ITEMS];  ///< Array of menu item labels
-            uint8_t count;                              ///< Number of items
-            uint8_t selected;                           ///< Currently selected index
-            HardwareState hwState;                      ///< Hardware state for menu status bar
+            const MenuItem* parent;  ///< Menu whose children are listed (title = parent label)
+            uint8_t selected;        ///< Currently selected child index
         } menu;
 
         struct {
@@ -49,9 +50,7 @@ struct DisplayRequest {
         struct {
             const char* value;  ///< Message text to display
         } message;
-
-        struct {
-            HardwareState hwState;  ///< Hardware state for normal mode display
-        } normalMode;
     } data;
 };
+
+static_assert(std::is_trivially_copyable<DisplayRequest>::value, "DisplayRequest is copied through a FreeRTOS queue");
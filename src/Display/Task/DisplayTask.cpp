@@ -1,10 +1,17 @@
 #include "DisplayTask.h"
 #include "Config/log_config.h"
+#include "System/LatencyTrace.h"
+#include "Menu/Model/MenuItem.h"
+#include <string.h>
 
 DisplayTask::DisplayTask(DisplayInterface* display)
     : display(display)
     , requestQueue(nullptr)
-    , taskHandle(nullptr) {
+    , taskHandle(nullptr)
+    , hardwareState(nullptr)
+    , pendingCount(0)
+    , lastFrameTick(0)
+    , stats{} {
 }
 
 void DisplayTask::init(uint8_t queueSize) {
@@ -15,8 +22,8 @@ void DisplayTask::init(uint8_t queueSize) {
 }
 
 bool DisplayTask::start(uint32_t stackSize, UBaseType_t priority) {
-    if (requestQueue == nullptr || display == nullptr) {
-        LOG_ERROR(TAG, "Cannot start: queue or display not initialized");
+    if (requestQueue == nullptr || display == nullptr || hardwareState == nullptr) {
+        LOG_ERROR(TAG, "Cannot start: queue, display or hardware state not initialized");
         return false;
     }
 
@@ -42,27 +49,123 @@ QueueHandle_t DisplayTask::getQueue() const {
     return requestQueue;
 }
 
+void DisplayTask::setHardwareState(const HardwareStateStore* hwState) {
+    hardwareState = hwState;
+}
+
+bool DisplayTask::onStateChanged(const EventEnvelope& event) {
+    if (requestQueue == nullptr || hardwareState == nullptr) {
+        return false;
+    }
+
+    DisplayRequest request{};
+    request.type = DisplayRequestType::DRAW_NORMAL_MODE;  // State is read when the frame is drawn
+
+    // Animation refreshes come from the timer task and must not block it
+    TickType_t wait = event.payload.state.what == StateChange::REFRESH ? 0 : pdMS_TO_TICKS(10);
+    if (xQueueSend(requestQueue, &request, wait) != pdPASS) {
+        return false;
+    }
+    TRACE_STAMP_ORIGIN(TraceStage::DISPLAY_SUBMIT, event.originUs);
+    return true;
+}
+
+DisplayTaskStats DisplayTask::getStats() const {
+    taskENTER_CRITICAL(&statsMux);
+    DisplayTaskStats snapshot = stats;
+    taskEXIT_CRITICAL(&statsMux);
+    return snapshot;
+}
+
+void DisplayTask::logStats() const {
+    [[maybe_unused]] DisplayTaskStats s = getStats();
+    LOG_INFO(TAG, "requests: received=%lu collapsed=%lu rendered=%lu maxPending=%u",
+             s.received, s.collapsed, s.rendered, s.maxPending);
+}
+
 void DisplayTask::taskFunction(void* params) {
-    DisplayTask* self = static_cast<DisplayTask*>(params);
+    static_cast<DisplayTask*>(params)->taskLoop();
+}
+
+void DisplayTask::taskLoop() {
     DisplayRequest request;
 
     while (true) {
-        if (xQueueReceive(self->requestQueue, &request, portMAX_DELAY) == pdTRUE) {
-            self->processRequest(request);
+        if (pendingCount == 0) {
+            if (xQueueReceive(requestQueue, &request, portMAX_DELAY) != pdTRUE) {
+                continue;
+            }
+            collect(request);
+        }
+
+        drain();
+        waitForFrameSlot();
+        drain();  // Whatever arrived during the wait collapses into this frame
+
+        processRequest(pending[0]);
+        lastFrameTick = xTaskGetTickCount();
+
+        pendingCount--;
+        memmove(&pending[0], &pending[1], pendingCount * sizeof(DisplayRequest));
+
+        taskENTER_CRITICAL(&statsMux);
+        stats.rendered++;
+        taskEXIT_CRITICAL(&statsMux);
+    }
+}
+
+void DisplayTask::drain() {
+    DisplayRequest request;
+
+    // A full pending list leaves the rest queued for the next frame
+    while (pendingCount < DISPLAY_PENDING_REQUESTS &&
+           xQueueReceive(requestQueue, &request, 0) == pdTRUE) {
+        collect(request);
+    }
+}
+
+void DisplayTask::collect(const DisplayRequest& request) {
+    bool collapsed = false;
+
+    if (isCollapsible(request.type)) {
+        for (uint8_t i = 0; i < pendingCount; i++) {
+            if (pending[i].type == request.type) {
+                // At most one per type is pending, so the first match is the only one
+                pendingCount--;
+                memmove(&pending[i], &pending[i + 1], (pendingCount - i) * sizeof(DisplayRequest));
+                collapsed = true;
+                break;
+            }
         }
     }
+
+    pending[pendingCount++] = request;
+
+    taskENTER_CRITICAL(&statsMux);
+    stats.received++;
+    stats.collapsed += collapsed ? 1 : 0;
+    if (pendingCount > stats.maxPending) {
+        stats.maxPending = pendingCount;
+    }
+    taskEXIT_CRITICAL(&statsMux);
+}
+
+void DisplayTask::waitForFrameSlot() {
+    TickType_t interval = pdMS_TO_TICKS(DISPLAY_MIN_FRAME_INTERVAL_MS);
+    TickType_t elapsed = xTaskGetTickCount() - lastFrameTick;
+    if (elapsed < interval) {
+        vTaskDelay(interval - elapsed);
+    }
+}
+
+bool DisplayTask::isCollapsible(DisplayRequestType type) {
+    return type == DisplayRequestType::DRAW_MENU || type == DisplayRequestType::DRAW_NORMAL_MODE;
 }
 
 void DisplayTask::processRequest(const DisplayRequest& request) {
     switch (request.type) {
         case DisplayRequestType::DRAW_MENU:
-            display->showMenu(
-                request.data.menu.title,
-                request.data.menu.items,
-                request.data.menu.count,
-                request.data.menu.selected,
-                request.data.menu.hwState
-            );
+            drawMenu(request.data.menu.parent, request.data.menu.selected, hardwareState->read());
             break;
 
         case DisplayRequestType::SHOW_STATUS:
@@ -81,16 +184,29 @@ void DisplayTask::processRequest(const DisplayRequest& request) {
             break;
 
         case DisplayRequestType::CLEAR_WARNING:
-            // Clear warning and restore last normal mode state
+            // Clear warning and restore normal mode with the current state
             display->clear();
-            display->drawNormalMode(lastNormalModeState);
+            display->drawNormalMode(hardwareState->read());
             LOG_DEBUG(TAG, "Warning cleared, normal mode restored");
             break;
 
         case DisplayRequestType::DRAW_NORMAL_MODE:
-            // Cache state for restoration after warning
-            lastNormalModeState = request.data.normalMode.hwState;
-            display->drawNormalMode(request.data.normalMode.hwState);
+            display->drawNormalMode(hardwareState->read());
             break;
     }
 }
+
+void DisplayTask::drawMenu(const MenuItem* parent, uint8_t selected, const HardwareState& state) {
+    if (parent == nullptr || parent->children == nullptr) {
+        return;
+    }
+
+    // Labels live in the static menu tree; only pointers are gathered here
+    const char* items[DISPLAY_MAX_MENU_ITEMS];
+    uint8_t count = parent->childCount < DISPLAY_MAX_MENU_ITEMS ? parent->childCount : DISPLAY_MAX_MENU_ITEMS;
+    for (uint8_t i = 0; i < count; i++) {
+        items[i] = parent->children[i].label;
+    }
+
+    display->showMenu(parent->label, items, count, selected, state);
+}
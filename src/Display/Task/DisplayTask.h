@@ -6,6 +6,18 @@
 #include "../Interface/DisplayInterface.h"
 #include "../Model/DisplayRequest.h"
 #include "state/HardwareState.h"
+#include "Type/EventEnvelope.h"
+#include "Config/display_config.h"
+
+/**
+ * @brief Request handling counters
+ */
+struct DisplayTaskStats {
+    uint32_t received;   ///< Requests taken from the queue
+    uint32_t collapsed;  ///< Requests dropped because a newer one of the same kind replaced them
+    uint32_t rendered;   ///< Requests drawn
+    uint8_t maxPending;  ///< High-water mark of drained, not yet drawn requests
+};
 
 /**
  * @brief FreeRTOS task that arbitrates display access
@@ -14,6 +26,19 @@
  * All display output must go through this task to prevent race conditions
  * on the shared display hardware.
  *
+ * The status screen is redrawn from STATE_CHANGED events on the EventBus
+ * (see onStateChanged) rather than by every component that touches HardwareState.
+ * Menus and the status screen are drawn from a HardwareStateStore snapshot
+ * read at render time, so a frame never shows state older than its request.
+ *
+ * Each wakeup drains the whole queue. A DRAW_MENU or DRAW_NORMAL_MODE
+ * replaces any older pending request of the same type (latest wins, at
+ * the newer position), so fast menu rotation renders the current
+ * selection once instead of every intermediate frame; messages, status,
+ * clears and warnings are kept and drawn in order. Frames are spaced at
+ * least DISPLAY_MIN_FRAME_INTERVAL_MS apart, and requests arriving during
+ * that wait are collapsed too.
+ *
  * Architecture: Display Arbitration Pattern
  * *Handler -> DisplayRequestQueue -> DisplayTask -> DisplayInterface
  */
@@ -45,14 +70,44 @@ public:
      */
     QueueHandle_t getQueue() const;
 
+    /**
+     * @brief Set the state store rendered into status bars and the status screen
+     * @param hwState Hardware state snapshot source (must outlive task)
+     */
+    void setHardwareState(const HardwareStateStore* hwState);
+
+    /**
+     * @brief EventBus listener: queue a status screen redraw on STATE_CHANGED
+     */
+    bool onStateChanged(const EventEnvelope& event);
+
+    DisplayTaskStats getStats() const;
+    void logStats() const;
+
 private:
     DisplayInterface* display;
     QueueHandle_t requestQueue;
     TaskHandle_t taskHandle;
-    HardwareState lastNormalModeState;  // Cached state for restoring after warning
+    const HardwareStateStore* hardwareState;
+
+    DisplayRequest pending[DISPLAY_PENDING_REQUESTS];  // Drained requests in arrival order (task only)
+    uint8_t pendingCount;
+    TickType_t lastFrameTick;
+    DisplayTaskStats stats;
+    mutable portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
 
     static void taskFunction(void* params);
+    void taskLoop();
+    void drain();
+    void collect(const DisplayRequest& request);
+    void waitForFrameSlot();
     void processRequest(const DisplayRequest& request);
+    void drawMenu(const MenuItem* parent, uint8_t selected, const HardwareState& state);
+
+    /**
+     * @brief Full-screen redraws where only the newest pending one matters
+     */
+    static bool isCollapsible(DisplayRequestType type);
 
     static constexpr const char* TAG = "DisplayTask";
 };
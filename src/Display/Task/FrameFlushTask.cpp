@@ -0,0 +1,193 @@
+#include "FrameFlushTask.h"
+#include <string.h>
+#include <Wire.h>
+#include <Adafruit_SSD1306.h>
+#include "Config/log_config.h"
+
+FrameFlushTask::FrameFlushTask()
+    : taskHandle(nullptr)
+    , busLock(nullptr)
+    , busy(false)
+    , waiter(nullptr)
+    , front{}
+    , spans{}
+    , spanCount(0)
+    , stats{} {
+}
+
+bool FrameFlushTask::start(uint32_t stackSize, UBaseType_t priority) {
+    if (taskHandle) {
+        return true;
+    }
+
+    if (!busLock) {
+        busLock = xSemaphoreCreateMutex();
+        if (!busLock) {
+            LOG_ERROR(TAG, "Failed to create bus lock");
+            return false;
+        }
+    }
+
+    if (xTaskCreate(taskEntry, "FrameFlush", stackSize, this, priority, &taskHandle) != pdPASS) {
+        taskHandle = nullptr;
+        LOG_ERROR(TAG, "Failed to create task, flushing synchronously");
+        return false;
+    }
+
+    LOG_INFO(TAG, "Started");
+    return true;
+}
+
+void FrameFlushTask::submit(const uint8_t* frame) {
+    waitIdle();
+
+    // The flush task is idle: shadow, front and spans are ours until busy is set
+    spanCount = shadow.diff(frame, spans);
+
+    taskENTER_CRITICAL(&statsMux);
+    stats.frames++;
+    stats.unchangedFrames += spanCount == 0 ? 1 : 0;
+    taskEXIT_CRITICAL(&statsMux);
+
+    if (spanCount == 0) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < spanCount; i++) {
+        uint16_t offset = spans[i].page * OLED_SCREEN_WIDTH + spans[i].firstColumn;
+        memcpy(front + offset, frame + offset, spans[i].width());
+    }
+    shadow.apply(frame, spans, spanCount);  // Undone by invalidate() if the transfer fails
+
+    if (!taskHandle) {
+        busy = true;
+        transfer();
+        return;
+    }
+
+    busy = true;
+    xTaskNotifyGive(taskHandle);
+}
+
+void FrameFlushTask::waitIdle() {
+    bool counted = false;
+
+    while (true) {
+        taskENTER_CRITICAL(&flushMux);
+        if (!busy) {
+            taskEXIT_CRITICAL(&flushMux);
+            return;
+        }
+        waiter = xTaskGetCurrentTaskHandle();
+        taskEXIT_CRITICAL(&flushMux);
+
+        if (!counted) {
+            counted = true;
+            taskENTER_CRITICAL(&statsMux);
+            stats.waits++;
+            taskEXIT_CRITICAL(&statsMux);
+        }
+
+        // Timeout only guards against a notification consumed by someone else
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(OLED_FLUSH_WAIT_MS));
+    }
+}
+
+void FrameFlushTask::lockBus() {
+    if (busLock) {
+        xSemaphoreTake(busLock, portMAX_DELAY);
+    }
+}
+
+void FrameFlushTask::unlockBus() {
+    if (busLock) {
+        xSemaphoreGive(busLock);
+    }
+}
+
+FrameFlushStats FrameFlushTask::getStats() const {
+    taskENTER_CRITICAL(&statsMux);
+    FrameFlushStats snapshot = stats;
+    taskEXIT_CRITICAL(&statsMux);
+    return snapshot;
+}
+
+void FrameFlushTask::taskEntry(void* param) {
+    static_cast<FrameFlushTask*>(param)->taskLoop();
+}
+
+void FrameFlushTask::taskLoop() {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (busy) {
+            transfer();
+        }
+    }
+}
+
+void FrameFlushTask::transfer() {
+    uint32_t bytes = 0;
+    bool sent = true;
+
+    lockBus();
+    for (uint8_t i = 0; i < spanCount && sent; i++) {
+        sent = sendSpan(spans[i], bytes);
+    }
+    unlockBus();
+
+    if (!sent) {
+        shadow.invalidate();  // Unknown how much reached the panel
+        LOG_ERROR(TAG, "I2C transfer failed, next frame is sent in full");
+    }
+
+    taskENTER_CRITICAL(&statsMux);
+    stats.spans += spanCount;
+    stats.bytes += bytes;
+    stats.lastFrameBytes = static_cast<uint16_t>(bytes);
+    stats.failures += sent ? 0 : 1;
+    taskEXIT_CRITICAL(&statsMux);
+
+    LOG_DEBUG(TAG, "Frame: %u spans, %lu bytes", spanCount, bytes);
+
+    taskENTER_CRITICAL(&flushMux);
+    busy = false;
+    TaskHandle_t wake = waiter;
+    waiter = nullptr;
+    taskEXIT_CRITICAL(&flushMux);
+
+    if (wake) {
+        xTaskNotifyGive(wake);
+    }
+}
+
+bool FrameFlushTask::sendSpan(const PageSpan& span, uint32_t& bytes) {
+    // Horizontal addressing (set by begin()): data fills the window column by column
+    const uint8_t window[] = {
+        SSD1306_COLUMNADDR, span.firstColumn, span.lastColumn,
+        SSD1306_PAGEADDR, span.page, span.page
+    };
+
+    Wire.beginTransmission(OLED_I2C_ADDRESS);
+    Wire.write(static_cast<uint8_t>(0x00));  // Control byte: command stream
+    Wire.write(window, sizeof(window));
+    if (Wire.endTransmission() != 0) {
+        return false;
+    }
+    bytes += 2 + sizeof(window);
+
+    const uint8_t* data = front + span.page * OLED_SCREEN_WIDTH + span.firstColumn;
+    uint8_t width = span.width();
+    for (uint8_t offset = 0; offset < width;) {
+        uint8_t chunk = width - offset < OLED_I2C_CHUNK_BYTES ? width - offset : OLED_I2C_CHUNK_BYTES;
+
+        Wire.beginTransmission(OLED_I2C_ADDRESS);
+        Wire.write(static_cast<uint8_t>(0x40));  // Control byte: data stream
+        Wire.write(data + offset, chunk);
+        if (Wire.endTransmission() != 0) {
+            return false;
+        }
+        bytes += 2 + chunk;
+        offset += chunk;
+    }
+    return true;
+}
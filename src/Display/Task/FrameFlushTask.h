@@ -0,0 +1,89 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "Config/display_config.h"
+#include "Type/PageSpan.h"
+#include "../Frame/ShadowFramebuffer.h"
+
+/**
+ * @brief I2C transfer counters for the partial flush
+ */
+struct FrameFlushStats {
+    uint32_t frames;           ///< Frames submitted
+    uint32_t unchangedFrames;  ///< Frames identical to the panel (nothing sent)
+    uint32_t waits;            ///< Frames that had to wait for the previous transfer
+    uint32_t spans;            ///< Address windows opened
+    uint32_t bytes;            ///< Bytes on the bus, I2C address and control bytes included
+    uint16_t lastFrameBytes;   ///< Bus bytes of the most recent transfer
+    uint32_t failures;         ///< Transfers that failed (next frame is sent in full)
+};
+
+/**
+ * @brief Streams rendered frames to the SSD1306 on its own task
+ *
+ * Double buffering: the renderer draws into its back buffer (the Adafruit
+ * buffer) and submit()s it; the changed spans are diffed against the
+ * shadow, the frame is copied into the front buffer and the flush task
+ * sends it while the renderer goes on with the next frame. submit() only
+ * blocks if the previous transfer is still running; the flush task wakes
+ * the waiting renderer with a task notification when it is done.
+ *
+ * All Wire traffic to the panel goes through busLock, so other callers
+ * (power commands from the menu or PowerManager) take lockBus() first.
+ *
+ * Without a running task (start() failed or not called) submit() sends
+ * the frame itself.
+ */
+class FrameFlushTask {
+public:
+    FrameFlushTask();
+
+    /**
+     * @brief Create the bus lock and start the flush task
+     * @return true if task started successfully
+     */
+    bool start(uint32_t stackSize = OLED_FLUSH_TASK_STACK, UBaseType_t priority = OLED_FLUSH_TASK_PRIORITY);
+
+    /**
+     * @brief Hand over a rendered frame; returns once it is copied, not sent
+     * @param frame Back buffer, OLED_FRAME_BYTES long (free to redraw on return)
+     */
+    void submit(const uint8_t* frame);
+
+    /**
+     * @brief Block until the frame in flight has been sent
+     */
+    void waitIdle();
+
+    /**
+     * @brief Serialize other Wire access to the panel with the flush task
+     */
+    void lockBus();
+    void unlockBus();
+
+    FrameFlushStats getStats() const;
+
+private:
+    TaskHandle_t taskHandle;
+    SemaphoreHandle_t busLock;
+    volatile bool busy;
+    TaskHandle_t waiter;  ///< Renderer blocked in waitIdle() (guarded by flushMux)
+    mutable portMUX_TYPE flushMux = portMUX_INITIALIZER_UNLOCKED;
+
+    ShadowFramebuffer shadow;                 ///< Panel contents once the frame in flight is sent
+    uint8_t front[OLED_FRAME_BYTES];          ///< Frame being sent (owned by the flush task while busy)
+    PageSpan spans[ShadowFramebuffer::MAX_SPANS];
+    uint8_t spanCount;
+
+    FrameFlushStats stats;
+    mutable portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+    static void taskEntry(void* param);
+    void taskLoop();
+    void transfer();
+    bool sendSpan(const PageSpan& span, uint32_t& bytes);
+
+    static constexpr const char* TAG = "FrameFlush";
+};
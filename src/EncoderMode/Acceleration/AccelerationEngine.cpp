@@ -0,0 +1,221 @@
+#include "AccelerationEngine.h"
+#include "Arduino.h"
+#include "Config/acceleration_config.h"
+#include "Config/ConfigManager.h"
+#include "Config/log_config.h"
+#include "Type/ConfigSnapshot.h"
+
+static const char* TAG = "AccelerationEngine";
+
+AccelerationEngine::AccelerationEngine() : states{} {
+    for (uint8_t i = 0; i < MODE_COUNT; i++) {
+        curves[i] = AccelerationCurve::none();
+        pendingCurves[i] = AccelerationCurve::none();
+    }
+}
+
+void AccelerationEngine::setCurve(WheelMode mode, const AccelerationCurve& curve) {
+    uint8_t index = static_cast<uint8_t>(mode);
+    if (index >= MODE_COUNT) {
+        return;
+    }
+    curves[index] = isValid(curve) ? curve : AccelerationCurve::none();
+    states[index] = ModeState{};
+}
+
+const AccelerationCurve& AccelerationEngine::getCurve(WheelMode mode) const {
+    uint8_t index = static_cast<uint8_t>(mode);
+    return curves[index < MODE_COUNT ? index : 0];
+}
+
+void AccelerationEngine::onConfigChanged(ConfigChange change, const ConfigSnapshot& snapshot) {
+    if (change != ConfigChange::ACCELERATION && change != ConfigChange::ALL) {
+        return;
+    }
+
+    // Only copies under the lock; apply() swaps them in on the input task
+    portENTER_CRITICAL(&pendingMux);
+    for (uint8_t i = 0; i < MODE_COUNT; i++) {
+        pendingCurves[i] = snapshot.accelerationCurves[i];
+    }
+    pendingMask = (1 << MODE_COUNT) - 1;
+    portEXIT_CRITICAL(&pendingMux);
+    LOG_DEBUG(TAG, "Acceleration curves queued from config snapshot");
+}
+
+void AccelerationEngine::adoptPendingCurves() {
+    AccelerationCurve adopted[MODE_COUNT];
+    portENTER_CRITICAL(&pendingMux);
+    uint8_t mask = pendingMask;
+    for (uint8_t i = 0; i < MODE_COUNT; i++) {
+        adopted[i] = pendingCurves[i];
+    }
+    pendingMask = 0;
+    portEXIT_CRITICAL(&pendingMux);
+
+    for (uint8_t i = 0; i < MODE_COUNT; i++) {
+        if (mask & (1 << i)) {
+            setCurve(static_cast<WheelMode>(i), adopted[i]);
+        }
+    }
+}
+
+Error AccelerationEngine::receiveCurve(Stream& in, ConfigManager& config) {
+    in.setTimeout(ACCEL_CURVE_UPLOAD_TIMEOUT_MS);
+
+    uint8_t mode;
+    AccelerationCurve curve;
+    if (in.readBytes(&mode, 1) != 1 ||
+        in.readBytes(reinterpret_cast<uint8_t*>(&curve), sizeof(curve)) != sizeof(curve)) {
+        LOG_ERROR(TAG, "Curve upload timed out");
+        return Error::INVALID_PARAM;
+    }
+
+    // ConfigManager validates; the change comes back through onConfigChanged()
+    Error result = config.saveAccelerationCurve(static_cast<WheelMode>(mode), curve);
+    if (result == Error::OK) {
+        result = config.flush();  // The host tool reports this result: it should mean "in flash"
+    }
+    LOG_INFO(TAG, "Curve upload for mode %d: %s", mode, errorToString(result));
+    return result;
+}
+
+void AccelerationEngine::reset() {
+    for (uint8_t i = 0; i < MODE_COUNT; i++) {
+        states[i] = ModeState{};
+    }
+}
+
+int32_t AccelerationEngine::apply(WheelMode mode, int32_t delta, uint64_t timestampUs) {
+    if (pendingMask != 0) {
+        adoptPendingCurves();
+    }
+
+    uint8_t index = static_cast<uint8_t>(mode);
+    if (delta == 0 || index >= MODE_COUNT) {
+        return delta;
+    }
+
+    const AccelerationCurve& curve = curves[index];
+    ModeState& state = states[index];
+
+    int8_t direction = delta > 0 ? 1 : -1;
+    uint32_t magnitude = static_cast<uint32_t>(delta > 0 ? delta : -delta);
+
+    if (curve.type == AccelerationCurveType::NONE || timestampUs == 0) {
+        state = ModeState{};
+        return delta;
+    }
+
+    // Velocity from the per-detent interval; a pause or reversal restarts at 1.0x
+    uint64_t elapsedUs = timestampUs - state.lastTimestampUs;
+    if (state.lastTimestampUs == 0 || timestampUs <= state.lastTimestampUs ||
+        elapsedUs > ACCEL_IDLE_RESET_US || direction != state.lastDirection) {
+        state.velocityDps = 0;
+        state.carryQ8 = 0;
+    } else {
+        uint64_t intervalUs = elapsedUs / magnitude;
+        if (intervalUs < ACCEL_MIN_INTERVAL_US) {
+            intervalUs = ACCEL_MIN_INTERVAL_US;
+        }
+        uint32_t instantDps = static_cast<uint32_t>(1000000ULL / intervalUs);
+        // EMA with alpha = 1/2: responsive but rejects single jittery intervals
+        state.velocityDps = state.velocityDps == 0 ? instantDps : (state.velocityDps + instantDps) / 2;
+    }
+    state.lastTimestampUs = timestampUs;
+    state.lastDirection = direction;
+
+    uint32_t gainQ8 = gainForVelocity(curve, state.velocityDps);
+    uint32_t scaledQ8 = magnitude * gainQ8 + state.carryQ8;
+    uint32_t output = scaledQ8 >> 8;
+    state.carryQ8 = scaledQ8 & 0xFF;
+
+    if (output > static_cast<uint32_t>(ACCEL_MAX_OUTPUT_DELTA)) {
+        output = ACCEL_MAX_OUTPUT_DELTA;
+        state.carryQ8 = 0;
+    }
+
+    return direction * static_cast<int32_t>(output);
+}
+
+uint32_t AccelerationEngine::gainForVelocity(const AccelerationCurve& curve, uint32_t velocityDps) {
+    uint32_t gainQ8 = ACCEL_GAIN_ONE_Q8;
+
+    switch (curve.type) {
+        case AccelerationCurveType::LINEAR:
+            if (velocityDps > curve.thresholdDps) {
+                gainQ8 += (velocityDps - curve.thresholdDps) * curve.slopeQ8;
+            }
+            break;
+
+        case AccelerationCurveType::POWER:
+            if (velocityDps > curve.thresholdDps && curve.scaleDps > 0) {
+                // x = (v - v0) / scale in Q8, then x^n keeping Q8 after each multiply
+                uint64_t xQ8 = (static_cast<uint64_t>(velocityDps - curve.thresholdDps) << 8) / curve.scaleDps;
+                uint64_t powQ8 = ACCEL_GAIN_ONE_Q8;
+                for (uint8_t i = 0; i < curve.exponent && powQ8 <= curve.maxGainQ8; i++) {
+                    powQ8 = (powQ8 * xQ8) >> 8;
+                }
+                uint64_t total = ACCEL_GAIN_ONE_Q8 + powQ8;
+                gainQ8 = total > curve.maxGainQ8 ? curve.maxGainQ8 : static_cast<uint32_t>(total);
+            }
+            break;
+
+        case AccelerationCurveType::TABLE: {
+            const AccelerationCurvePoint* p = curve.points;
+            uint8_t n = curve.pointCount;
+            if (n == 0) {
+                break;
+            }
+            if (velocityDps <= p[0].velocityDps) {
+                gainQ8 = p[0].gainQ8;
+            } else if (velocityDps >= p[n - 1].velocityDps) {
+                gainQ8 = p[n - 1].gainQ8;
+            } else {
+                for (uint8_t i = 1; i < n; i++) {
+                    if (velocityDps <= p[i].velocityDps) {
+                        uint32_t span = p[i].velocityDps - p[i - 1].velocityDps;
+                        int32_t rise = static_cast<int32_t>(p[i].gainQ8) - static_cast<int32_t>(p[i - 1].gainQ8);
+                        int32_t offset = static_cast<int32_t>(velocityDps - p[i - 1].velocityDps);
+                        gainQ8 = static_cast<uint32_t>(p[i - 1].gainQ8 + rise * offset / static_cast<int32_t>(span));
+                        break;
+                    }
+                }
+            }
+            break;
+        }
+
+        case AccelerationCurveType::NONE:
+        default:
+            break;
+    }
+
+    if (curve.type != AccelerationCurveType::TABLE && gainQ8 > curve.maxGainQ8) {
+        gainQ8 = curve.maxGainQ8;
+    }
+    return gainQ8 < ACCEL_GAIN_ONE_Q8 ? ACCEL_GAIN_ONE_Q8 : gainQ8;
+}
+
+bool AccelerationEngine::isValid(const AccelerationCurve& curve) {
+    switch (curve.type) {
+        case AccelerationCurveType::NONE:
+            return true;
+        case AccelerationCurveType::LINEAR:
+            return curve.maxGainQ8 >= ACCEL_GAIN_ONE_Q8;
+        case AccelerationCurveType::POWER:
+            return curve.maxGainQ8 >= ACCEL_GAIN_ONE_Q8 && curve.scaleDps > 0 &&
+                   curve.exponent >= 1 && curve.exponent <= 4;
+        case AccelerationCurveType::TABLE:
+            if (curve.pointCount == 0 || curve.pointCount > ACCEL_TABLE_MAX_POINTS) {
+                return false;
+            }
+            for (uint8_t i = 1; i < curve.pointCount; i++) {
+                if (curve.points[i].velocityDps <= curve.points[i - 1].velocityDps) {
+                    return false;
+                }
+            }
+            return true;
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "Enum/ErrorEnum.h"
+#include "Enum/WheelModeEnum.h"
+#include "Type/AccelerationCurve.h"
+#include "Config/Interface/ConfigListenerInterface.h"
+
+class ConfigManager;
+class Stream;
+
+/**
+ * @brief Velocity-based encoder acceleration
+ *
+ * Estimates angular velocity from the ISR timestamps of consecutive detents
+ * and scales each delta through the curve configured for the active wheel
+ * mode. The fractional part of every scaled delta is carried per mode, so
+ * slow turns stay exact (gain 1.0 never rounds) and fast spins don't lose
+ * sub-unit motion.
+ *
+ * Pure integer math. Curves changed in ConfigManager arrive through
+ * onConfigChanged() on the writer's task and are handed over to the next
+ * apply(), so the input task never sees a half-copied curve.
+ */
+class AccelerationEngine : public ConfigListenerInterface {
+public:
+    static constexpr uint8_t MODE_COUNT = WheelMode_MAX + 1;
+
+    AccelerationEngine();
+
+    /**
+     * @brief Replace a curve immediately (setup, or the task calling apply())
+     */
+    void setCurve(WheelMode mode, const AccelerationCurve& curve);
+
+    /**
+     * @brief Curve in use; one queued by onConfigChanged() shows after the next apply()
+     */
+    const AccelerationCurve& getCurve(WheelMode mode) const;
+
+    /**
+     * @brief Queue the snapshot's curves for the next apply() (any task)
+     */
+    void onConfigChanged(ConfigChange change, const ConfigSnapshot& snapshot) override;
+
+    /**
+     * @brief Read one curve from the serial console and save it
+     *
+     * Format: wheel mode byte, then the AccelerationCurve blob as stored in
+     * NVS (little-endian, sizeof(AccelerationCurve) bytes). The saved curve
+     * reaches the engine through onConfigChanged().
+     */
+    Error receiveCurve(Stream& in, ConfigManager& config);
+
+    /**
+     * @brief Scale a detent delta for the given mode
+     * @param mode Active wheel mode (selects curve and carry state)
+     * @param delta Signed detents from the encoder
+     * @param timestampUs ISR timestamp of the delta (0 = unknown, pass-through)
+     * @return Scaled delta (may be 0 while a fraction accumulates)
+     */
+    int32_t apply(WheelMode mode, int32_t delta, uint64_t timestampUs);
+
+    /**
+     * @brief Forget velocity and carry for all modes (e.g. on mode switch)
+     */
+    void reset();
+
+    /**
+     * @brief Evaluate a curve at a velocity
+     * @return Gain in Q8, never below 1.0
+     */
+    static uint32_t gainForVelocity(const AccelerationCurve& curve, uint32_t velocityDps);
+
+    /**
+     * @brief Check curve parameters before they're stored or applied
+     */
+    static bool isValid(const AccelerationCurve& curve);
+
+private:
+    struct ModeState {
+        uint64_t lastTimestampUs;
+        uint32_t velocityDps;  ///< Smoothed velocity estimate
+        uint32_t carryQ8;      ///< Unemitted fraction, same sign as lastDirection
+        int8_t lastDirection;
+    };
+
+    /**
+     * @brief Move queued curves into use and restart their modes at 1.0x
+     */
+    void adoptPendingCurves();
+
+    AccelerationCurve curves[MODE_COUNT];
+    ModeState states[MODE_COUNT];
+
+    AccelerationCurve pendingCurves[MODE_COUNT];
+    volatile uint8_t pendingMask = 0;  ///< Bit per mode with a queued curve
+    portMUX_TYPE pendingMux = portMUX_INITIALIZER_UNLOCKED;
+};
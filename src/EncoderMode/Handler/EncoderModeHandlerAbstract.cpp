@@ -1,7 +1,7 @@
 #include "EncoderModeHandlerAbstract.h"
 
-EncoderModeHandlerAbstract::EncoderModeHandlerAbstract(AppEventDispatcher* dispatcher, BleKeyboard* bleKeyboard)
-    : appEventDispatcher(dispatcher), bleKeyboard(bleKeyboard) {}
+EncoderModeHandlerAbstract::EncoderModeHandlerAbstract(AppEventDispatcher* dispatcher, HidOutputTask* hidOutput)
+    : appEventDispatcher(dispatcher), hidOutput(hidOutput) {}
 
 void EncoderModeHandlerAbstract::handleLongClick() {
     Serial.println("AbstractModeHandler: Long click → entering mode selection...");
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "Arduino.h"
-#include "BleKeyboard.h"
+#include "BLE/HidOutputTask.h"
 
 #include "EncoderModeHandlerInterface.h"
 #include "Event/Dispatcher/AppEventDispatcher.h"
@@ -9,12 +9,12 @@
 
 class EncoderModeHandlerAbstract : public EncoderModeHandlerInterface {
 public:
-    EncoderModeHandlerAbstract(AppEventDispatcher* dispatcher, BleKeyboard* bleKeyboard);
+    EncoderModeHandlerAbstract(AppEventDispatcher* dispatcher, HidOutputTask* hidOutput);
 
     virtual void handleLongClick() override;
     const char* getModeName() const override;
 
 protected:
     AppEventDispatcher* appEventDispatcher;
-    BleKeyboard* bleKeyboard;
+    HidOutputTask* hidOutput;  // Reports are queued, never sent from the input task
 };
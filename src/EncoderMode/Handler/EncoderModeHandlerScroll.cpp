@@ -1,18 +1,19 @@
 #include "EncoderModeHandlerScroll.h"
+#include "System/LatencyTrace.h"
 
-EncoderModeHandlerScroll::EncoderModeHandlerScroll(AppEventDispatcher* dispatcher, BleKeyboard* bleKeyboard)
-    : EncoderModeHandlerAbstract(dispatcher, bleKeyboard){}
+EncoderModeHandlerScroll::EncoderModeHandlerScroll(AppEventDispatcher* dispatcher, HidOutputTask* hidOutput)
+    : EncoderModeHandlerAbstract(dispatcher, hidOutput){}
 
 void EncoderModeHandlerScroll::handleRotate(int delta) {
     Serial.printf("EncoderModeHandlerScroll: Rotating by %d\n", delta);
 
     if (isVerticalScroll) {
-        bleKeyboard->mouseMove(0, 0, delta, 0);
+        hidOutput->enqueueWheel(delta, 0, TRACE_ACTIVE_ORIGIN());
 
         return;
     }
 
-    bleKeyboard->mouseMove(0, 0, 0, delta);
+    hidOutput->enqueueWheel(0, delta, TRACE_ACTIVE_ORIGIN());
 }
 
 void EncoderModeHandlerScroll::handleShortClick() {
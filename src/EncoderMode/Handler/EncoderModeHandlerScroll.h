@@ -8,7 +8,7 @@
 
 class EncoderModeHandlerScroll : public EncoderModeHandlerAbstract {
 public:
-    EncoderModeHandlerScroll(AppEventDispatcher* dispatcher, BleKeyboard* bleKeyboard);
+    EncoderModeHandlerScroll(AppEventDispatcher* dispatcher, HidOutputTask* hidOutput);
 
     void handleRotate(int delta) override;
     void handleShortClick() override;
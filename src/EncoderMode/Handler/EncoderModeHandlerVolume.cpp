@@ -1,24 +1,75 @@
 #include "EncoderModeHandlerVolume.h"
+#include "System/LatencyTrace.h"
+#include "Config/volume_config.h"
+#include "Config/log_config.h"
 
-EncoderModeHandlerVolume::EncoderModeHandlerVolume(AppEventDispatcher* dispatcher, BleKeyboard* bleKeyboard)
-    : EncoderModeHandlerAbstract(dispatcher, bleKeyboard) {}
+[[maybe_unused]] static const char* TAG = "EncoderModeHandlerVolume";
+
+EncoderModeHandlerVolume::EncoderModeHandlerVolume(AppEventDispatcher* dispatcher, HidOutputTask* hidOutput)
+    : EncoderModeHandlerAbstract(dispatcher, hidOutput) {}
 
 void EncoderModeHandlerVolume::handleRotate(int delta) {
-    Serial.printf("EncoderModeHandlerVolume: Rotating by %d\n", delta);
+    LOG_DEBUG(TAG, "Rotating by %d", delta);
+
+    if (delta == 0) {
+        return;
+    }
+
+    const int8_t direction = delta > 0 ? 1 : -1;
+
+    // Reversal: drop leftover fraction and, optionally, steps still waiting to be sent
+    if (lastDirection != 0 && direction != lastDirection) {
+        stepAccumulatorQ8 = 0;
+        if (VOLUME_CANCEL_ON_REVERSAL) {
+            hidOutput->cancelConsumerKey(lastDirection > 0 ? KEY_MEDIA_VOLUME_UP : KEY_MEDIA_VOLUME_DOWN);
+        }
+    }
+    lastDirection = direction;
 
-    if (delta > 0) {
-        bleKeyboard->write(KEY_MEDIA_VOLUME_UP);
+    stepAccumulatorQ8 += delta * VOLUME_STEPS_PER_DETENT_Q8;
+    int32_t steps = stepAccumulatorQ8 / 256;  // Truncates toward zero, remainder keeps its sign
+    stepAccumulatorQ8 -= steps * 256;
 
+    uint32_t count = static_cast<uint32_t>(steps < 0 ? -steps : steps);
+    if (count == 0) {
         return;
     }
+    uint32_t capped = 0;
+    if (count > VOLUME_MAX_BURST_STEPS) {
+        capped = count - VOLUME_MAX_BURST_STEPS;
+        count = VOLUME_MAX_BURST_STEPS;
+    }
+
+    bool queued = hidOutput->enqueueConsumerKey(direction > 0 ? KEY_MEDIA_VOLUME_UP : KEY_MEDIA_VOLUME_DOWN,
+                                                static_cast<uint8_t>(count), TRACE_ACTIVE_ORIGIN(),
+                                                VOLUME_STEP_INTERVAL_MS);
+
+    taskENTER_CRITICAL(&statsMux);
+    stats.capped += capped;
+    if (queued) {
+        stats.sent += count;
+    } else {
+        stats.rejected += count;
+    }
+    taskEXIT_CRITICAL(&statsMux);
 
-    bleKeyboard->write(KEY_MEDIA_VOLUME_DOWN);
+    if (capped > 0 || !queued) {
+        LOG_DEBUG(TAG, "Volume steps lost: %u above burst cap, %u refused",
+                  static_cast<unsigned>(capped), static_cast<unsigned>(queued ? 0 : count));
+    }
 }
 
 void EncoderModeHandlerVolume::handleShortClick() {
     Serial.println("EncoderModeHandlerVolume: Short click detected.");
 
-    bleKeyboard->write(KEY_MEDIA_MUTE);
+    hidOutput->enqueueConsumerKey(KEY_MEDIA_MUTE, 1, TRACE_ACTIVE_ORIGIN());
+}
+
+VolumeStepStats EncoderModeHandlerVolume::getStats() const {
+    taskENTER_CRITICAL(&statsMux);
+    VolumeStepStats snapshot = stats;
+    taskEXIT_CRITICAL(&statsMux);
+    return snapshot;
 }
 
 const char* EncoderModeHandlerVolume::getModeName() const {
@@ -6,11 +6,38 @@
 #include "Enum/EventEnum.h"
 #include "Helper/EncoderModeHelper.h"
 
+/**
+ * @brief Volume steps that did not reach HidOutputTask
+ */
+struct VolumeStepStats {
+    uint32_t sent;      ///< Steps handed to HidOutputTask
+    uint32_t capped;    ///< Steps above VOLUME_MAX_BURST_STEPS in one event
+    uint32_t rejected;  ///< Steps refused by HidOutputTask (queue full or link down)
+};
+
+/**
+ * @brief Volume mode: rotation emits host volume steps proportional to delta
+ *
+ * Steps per detent are Q8 fixed point, so fractional ratios carry over
+ * between events. A single event emits at most VOLUME_MAX_BURST_STEPS,
+ * sent by HidOutputTask at VOLUME_STEP_INTERVAL_MS spacing. Steps above
+ * the cap or refused by HidOutputTask are not carried forward (they would
+ * fire after the knob stops) but counted in getStats().
+ */
 class EncoderModeHandlerVolume : public EncoderModeHandlerAbstract {
 public:
-    EncoderModeHandlerVolume(AppEventDispatcher* dispatcher, BleKeyboard* bleKeyboard);
+    EncoderModeHandlerVolume(AppEventDispatcher* dispatcher, HidOutputTask* hidOutput);
 
     void handleRotate(int delta) override;
     void handleShortClick() override;
     const char* getModeName() const override;
+
+    VolumeStepStats getStats() const;
+
+private:
+    VolumeStepStats stats{};
+    mutable portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+    int32_t stepAccumulatorQ8 = 0;  // Fractional steps not yet sent
+    int8_t lastDirection = 0;       // Sign of the previous rotation (0 = none yet)
 };
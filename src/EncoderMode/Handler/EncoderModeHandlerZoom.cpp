@@ -1,36 +1,53 @@
 #include "EncoderModeHandlerZoom.h"
+#include "BLE/BleKeyboardService.h"
 #include "Config/log_config.h"
+#include "Config/hid_config.h"
+#include "System/LatencyTrace.h"
+#include "Type/ConfigSnapshot.h"
 
-static const char* TAG = "EncoderModeHandlerZoom";
+[[maybe_unused]] static const char* TAG = "EncoderModeHandlerZoom";
 
-EncoderModeHandlerZoom::EncoderModeHandlerZoom(AppEventDispatcher* dispatcher, BleKeyboard* bleKeyboard)
-    : EncoderModeHandlerAbstract(dispatcher, bleKeyboard) {}
+static constexpr uint8_t CTRL_MODIFIER = 1 << (KEY_LEFT_CTRL - 0x80);  // Bitmask for left Ctrl
+
+EncoderModeHandlerZoom::EncoderModeHandlerZoom(AppEventDispatcher* dispatcher, HidOutputTask* hidOutput)
+    : EncoderModeHandlerAbstract(dispatcher, hidOutput) {}
 
 void EncoderModeHandlerZoom::handleRotate(int delta) {
     LOG_DEBUG(TAG, "Rotating by %d", delta);
 
-    if (!bleKeyboard->isConnected()) {
+    if (!hidOutput->isConnected()) {
         LOG_DEBUG(TAG, "BLE keyboard not connected, skipping zoom command");
         return;
     }
 
-    // Determine zoom direction: positive delta = zoom in (Ctrl++), negative = zoom out (Ctrl+-)
-    const uint8_t zoomKey = (delta > 0) ? KEY_NUM_PLUS : KEY_NUM_MINUS;
-    const int repeatCount = abs(delta);
+    const bool zoomIn = delta > 0;  // Positive delta = zoom in, negative = zoom out
+    const int steps = abs(delta) > UINT8_MAX ? UINT8_MAX : abs(delta);
 
-    LOG_DEBUG(TAG, "Sending zoom %s command %d times", (delta > 0) ? "in" : "out", repeatCount);
+    switch (strategy) {
+        case ZoomStrategy::CTRL_WHEEL:
+            // One wheel report carries every step; Ctrl held around it
+            hidOutput->enqueueWheel(zoomIn ? steps : -steps, 0, TRACE_ACTIVE_ORIGIN(), CTRL_MODIFIER);
+            break;
 
-    // Press Ctrl once before loop for efficiency
-    bleKeyboard->press(KEY_LEFT_CTRL);
+#if HID_AC_ZOOM_AVAILABLE
+        case ZoomStrategy::AC_ZOOM:
+            hidOutput->enqueueConsumerKey(zoomIn ? KEY_MEDIA_AC_ZOOM_IN : KEY_MEDIA_AC_ZOOM_OUT,
+                                          static_cast<uint8_t>(steps), TRACE_ACTIVE_ORIGIN());
+            break;
+#endif
 
-    // Send Plus or Minus for each delta step
-    for (int i = 0; i < repeatCount; i++) {
-        bleKeyboard->press(zoomKey);
-        bleKeyboard->release(zoomKey);
+        case ZoomStrategy::CTRL_KEYS:
+        default: {
+            // One Ctrl hold around all Num+/Num- steps: two reports per step
+            const uint8_t key = zoomIn ? KEY_NUM_PLUS : KEY_NUM_MINUS;
+            KeyReport report;
+            BleKeyboardService::composeKeyReport(report, CTRL_MODIFIER, &key, 1);
+            hidOutput->enqueueKeyChord(report, static_cast<uint8_t>(steps), TRACE_ACTIVE_ORIGIN());
+            break;
+        }
     }
 
-    // Release Ctrl once after loop
-    bleKeyboard->release(KEY_LEFT_CTRL);
+    LOG_DEBUG(TAG, "Queued zoom %s x%d (%s)", zoomIn ? "in" : "out", steps, zoomStrategyToString(strategy));
 }
 
 void EncoderModeHandlerZoom::handleShortClick() {
@@ -40,3 +57,18 @@ void EncoderModeHandlerZoom::handleShortClick() {
 const char* EncoderModeHandlerZoom::getModeName() const {
     return EncoderModeHelper::toString(EventEnum::EncoderModeEventTypes::ENCODER_MODE_ZOOM);
 }
+
+void EncoderModeHandlerZoom::onConfigChanged(ConfigChange change, const ConfigSnapshot& snapshot) {
+    if (change != ConfigChange::ZOOM_STRATEGY && change != ConfigChange::ALL) {
+        return;
+    }
+
+    strategy = snapshot.zoomStrategy;
+#if !HID_AC_ZOOM_AVAILABLE
+    if (strategy == ZoomStrategy::AC_ZOOM) {
+        // Stored by a build that had the usages; the menu no longer offers it
+        LOG_INFO(TAG, "AC Zoom not in HID descriptor, using Ctrl+Wheel");
+        strategy = ZoomStrategy::CTRL_WHEEL;
+    }
+#endif
+}
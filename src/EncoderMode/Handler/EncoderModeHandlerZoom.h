@@ -4,13 +4,32 @@
 
 #include "EncoderModeHandlerAbstract.h"
 #include "Enum/EventEnum.h"
+#include "Enum/ZoomStrategyEnum.h"
 #include "Helper/EncoderModeHelper.h"
+#include "Config/Interface/ConfigListenerInterface.h"
 
-class EncoderModeHandlerZoom : public EncoderModeHandlerAbstract {
+/**
+ * @brief Zoom mode: rotation zooms the host in/out
+ *
+ * The report sequence depends on the ZoomStrategy from the configuration
+ * (see ZoomStrategyEnum.h). Per rotate event of n steps:
+ * - CTRL_KEYS:  2 + 2n keyboard reports
+ * - CTRL_WHEEL: 2 keyboard reports + 1 wheel report
+ * - AC_ZOOM:    2n consumer reports
+ */
+class EncoderModeHandlerZoom : public EncoderModeHandlerAbstract, public ConfigListenerInterface {
 public:
-    EncoderModeHandlerZoom(AppEventDispatcher* dispatcher, BleKeyboard* bleKeyboard);
+    EncoderModeHandlerZoom(AppEventDispatcher* dispatcher, HidOutputTask* hidOutput);
 
     void handleRotate(int delta) override;
     void handleShortClick() override;
     const char* getModeName() const override;
+
+    /**
+     * @brief Pick up the zoom strategy when it changes in ConfigManager
+     */
+    void onConfigChanged(ConfigChange change, const ConfigSnapshot& snapshot) override;
+
+private:
+    volatile ZoomStrategy strategy = DEFAULT_ZOOM_STRATEGY;
 };
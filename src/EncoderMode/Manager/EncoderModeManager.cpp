@@ -1,20 +1,20 @@
 #include "EncoderModeManager.h"
 #include "Helper/EncoderModeHelper.h"
-#include "Display/Model/DisplayRequest.h"
+#include "Event/Bus/EventBus.h"
 #include "state/HardwareState.h"
 
 EncoderModeManager::EncoderModeManager(
     EncoderEventHandler* encoderEventHandler,
     EncoderModeSelector* encoderModeSelector,
-    QueueHandle_t displayQueue,
-    HardwareState* hwState
+    EventBus* bus,
+    HardwareStateStore* hwState
 )
-    : encoderEventHandler(encoderEventHandler),
+    : currentMode(EventEnum::EncoderModeEventTypes::ENCODER_MODE_SCROLL),
+      previousMode(EventEnum::EncoderModeEventTypes::ENCODER_MODE_SCROLL),
       encoderModeSelector(encoderModeSelector),
-      displayQueue(displayQueue),
-      hardwareState(hwState),
-      currentMode(EventEnum::EncoderModeEventTypes::ENCODER_MODE_SCROLL),
-      previousMode(EventEnum::EncoderModeEventTypes::ENCODER_MODE_SCROLL) {}
+      encoderEventHandler(encoderEventHandler),
+      eventBus(bus),
+      hardwareState(hwState) {}
 
 void EncoderModeManager::registerHandler(EventEnum::EncoderModeEventTypes mode, EncoderModeHandlerInterface* handler) {
     if (static_cast<int>(mode) >= static_cast<int>(EventEnum::EncoderModeEventTypes::__ENCODER_MODE_SELECTION_LIMIT)) return;
@@ -43,7 +43,8 @@ void EncoderModeManager::setMode(EventEnum::EncoderModeEventTypes mode) {
     }
 
     // Update hardware state and refresh display
-    hardwareState->encoderWheelState.mode = EncoderModeHelper::toWheelMode(mode);
+    WheelMode wheelMode = EncoderModeHelper::toWheelMode(mode);
+    hardwareState->update([wheelMode](HardwareState& state) { state.encoderWheelState.mode = wheelMode; });
     updateDisplayState();
 }
 
@@ -61,10 +62,7 @@ void EncoderModeManager::cancelModeSelection() {
 }
 
 void EncoderModeManager::updateDisplayState() {
-    DisplayRequest request;
-    request.type = DisplayRequestType::DRAW_NORMAL_MODE;
-    request.data.normalMode.hwState = *hardwareState;
-
-    // Non-blocking send with short timeout
-    xQueueSend(displayQueue, &request, pdMS_TO_TICKS(10));
+    if (eventBus) {
+        eventBus->publishStateChanged(StateChange::WHEEL_MODE, EventSource::ENCODER_MODE);
+    }
 }
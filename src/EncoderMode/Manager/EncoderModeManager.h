@@ -1,26 +1,25 @@
 #pragma once
 
 #include "Arduino.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/queue.h"
 
 #include "Enum/EventEnum.h"
 #include "EncoderMode/Handler/EncoderModeHandlerInterface.h"
 #include "EncoderMode/Selector/EncoderModeSelector.h"
 #include "EncoderMode/Interface/EncoderModeBaseInterface.h"
 #include "Event/Handler/EncoderEventHandler.h"
+#include "state/HardwareState.h"
 
 // Forward declarations
 class EncoderEventHandler;
-struct HardwareState;
+class EventBus;
 
 class EncoderModeManager {
 public:
     EncoderModeManager(
         EncoderEventHandler* encoderEventHandler,
         EncoderModeSelector* encoderModeSelector,
-        QueueHandle_t displayQueue,
-        HardwareState* hwState
+        EventBus* bus,
+        HardwareStateStore* hwState
     );
 
     void registerHandler(EventEnum::EncoderModeEventTypes mode, EncoderModeHandlerInterface* handler);
@@ -37,9 +36,9 @@ private:
     EncoderModeSelector* encoderModeSelector = nullptr;
 
     EncoderEventHandler* encoderEventHandler;
-    QueueHandle_t displayQueue;  ///< For sending state updates to display
-    HardwareState* hardwareState;  ///< Hardware state for display requests
+    EventBus* eventBus;  ///< For announcing mode changes (display refresh subscribes)
+    HardwareStateStore* hardwareState;  ///< Hardware state for display requests
 
     void setCurrentHandler(EncoderModeBaseInterface* handler);
-    void updateDisplayState();  // Helper to send DRAW_NORMAL_MODE request
+    void updateDisplayState();  // Helper to publish STATE_CHANGED (WHEEL_MODE)
 };
@@ -0,0 +1,210 @@
+#include "EventBus.h"
+#include "Arduino.h"
+#include "Config/log_config.h"
+#include "System/LatencyTrace.h"
+
+EventBus::EventBus() {
+    for (uint8_t i = 0; i < EVENT_TOPIC_COUNT; i++) {
+        topics[i].subscriberCount = 0;
+        topics[i].stats = {};
+    }
+}
+
+Error EventBus::subscribe(EventTopic topic, EventListener listener) {
+    if (!listener) {
+        return Error::INVALID_PARAM;
+    }
+    return addSubscriber(topic, Subscriber{ listener, nullptr });
+}
+
+Error EventBus::subscribeQueue(EventTopic topic, QueueHandle_t queue) {
+    if (queue == nullptr) {
+        return Error::INVALID_PARAM;
+    }
+    return addSubscriber(topic, Subscriber{ EventListener(), queue });
+}
+
+Error EventBus::addSubscriber(EventTopic topic, const Subscriber& subscriber) {
+    uint8_t index = static_cast<uint8_t>(topic);
+    if (index >= EVENT_TOPIC_COUNT) {
+        return Error::INVALID_PARAM;
+    }
+
+    Topic& t = topics[index];
+
+    // Slot is written before the count is published, so a concurrent
+    // publish() never sees a half-initialized subscriber
+    taskENTER_CRITICAL(&busMux);
+    if (t.subscriberCount >= EVENT_BUS_MAX_SUBSCRIBERS) {
+        taskEXIT_CRITICAL(&busMux);
+        LOG_ERROR(TAG, "Topic %s has no free subscriber slot", eventTopicToString(topic));
+        return Error::INVALID_STATE;
+    }
+    t.subscribers[t.subscriberCount] = subscriber;
+    t.subscriberCount++;
+    taskEXIT_CRITICAL(&busMux);
+
+    return Error::OK;
+}
+
+QueueHandle_t EventBus::createQueue(uint8_t depth) {
+    QueueHandle_t queue = xQueueCreate(depth, sizeof(EventEnvelope));
+    if (queue == nullptr) {
+        LOG_ERROR(TAG, "Failed to create subscriber queue");
+    }
+    return queue;
+}
+
+bool EventBus::publish(EventEnvelope& envelope) {
+    uint8_t index = static_cast<uint8_t>(envelope.topic);
+    if (index >= EVENT_TOPIC_COUNT) {
+        return false;
+    }
+
+    if (envelope.timestampMs == 0) {
+        envelope.timestampMs = millis();
+    }
+
+    // Events published while handling an input inherit that input's origin
+    if (envelope.originUs == 0) {
+        envelope.originUs = TRACE_ACTIVE_ORIGIN();
+    }
+    TRACE_STAMP_ORIGIN(TraceStage::DISPATCH, envelope.originUs);
+
+    Topic& t = topics[index];
+
+    taskENTER_CRITICAL(&busMux);
+    uint8_t count = t.subscriberCount;
+    t.stats.published++;
+    taskEXIT_CRITICAL(&busMux);
+
+    uint32_t delivered = 0;
+    uint32_t dropped = 0;
+    uint8_t depth = 0;
+
+    for (uint8_t i = 0; i < count; i++) {
+        const Subscriber& s = t.subscribers[i];
+
+        if (s.listener) {
+            if (s.listener(envelope)) {
+                delivered++;
+            } else {
+                dropped++;
+            }
+            continue;
+        }
+
+        if (sendToQueue(s.queue, envelope)) {
+            delivered++;
+        } else {
+            dropped++;
+        }
+
+        uint8_t waiting = static_cast<uint8_t>(uxQueueMessagesWaiting(s.queue));
+        if (waiting > depth) {
+            depth = waiting;
+        }
+    }
+
+    taskENTER_CRITICAL(&busMux);
+    t.stats.delivered += delivered;
+    t.stats.dropped += dropped;
+    t.stats.depth = depth;
+    if (depth > t.stats.maxDepth) {
+        t.stats.maxDepth = depth;
+    }
+    taskEXIT_CRITICAL(&busMux);
+
+    if (dropped > 0) {
+        LOG_DEBUG(TAG, "%s event dropped by %u subscriber(s)",
+                  eventTopicToString(envelope.topic), static_cast<unsigned>(dropped));
+    }
+
+    return dropped == 0;
+}
+
+bool EventBus::sendToQueue(QueueHandle_t queue, const EventEnvelope& envelope) {
+    switch (envelope.priority) {
+        case EventPriority::URGENT:
+            // Appended, not sent to the front: a click must not overtake the rotation before it
+            return xQueueSend(queue, &envelope, pdMS_TO_TICKS(EVENT_BUS_URGENT_WAIT_MS)) == pdPASS;
+
+        case EventPriority::BACKGROUND:
+            // Shed early so a burst of low-value events cannot crowd out input
+            if (uxQueueSpacesAvailable(queue) < EVENT_BUS_BACKGROUND_MIN_FREE) {
+                return false;
+            }
+            return xQueueSend(queue, &envelope, 0) == pdPASS;
+
+        case EventPriority::NORMAL:
+        default:
+            return xQueueSend(queue, &envelope, 0) == pdPASS;
+    }
+}
+
+EventEnvelope EventBus::makeEnvelope(EventTopic topic, EventSource source, EventPriority priority) {
+    EventEnvelope envelope;
+    envelope.topic = topic;
+    envelope.source = source;
+    envelope.priority = priority;
+    envelope.timestampMs = millis();
+    envelope.originUs = 0;
+    return envelope;
+}
+
+bool EventBus::publish(const EncoderInputEvent& event, EventSource source, EventPriority priority) {
+    EventEnvelope envelope = makeEnvelope(EventTopic::ENCODER_INPUT, source, priority);
+    envelope.originUs = event.timestampUs;
+    envelope.payload.encoder = event;
+    return publish(envelope);
+}
+
+bool EventBus::publish(const ButtonEvent& event, EventSource source, EventPriority priority) {
+    EventEnvelope envelope = makeEnvelope(EventTopic::BUTTON_INPUT, source, priority);
+    envelope.originUs = static_cast<uint64_t>(event.timestampMs) * 1000;  // millis() shares the esp_timer base
+    envelope.payload.button = event;
+    return publish(envelope);
+}
+
+bool EventBus::publish(const AppEvent& event, EventSource source, EventPriority priority) {
+    EventEnvelope envelope = makeEnvelope(EventTopic::APP, source, priority);
+    envelope.payload.app = event;
+    return publish(envelope);
+}
+
+bool EventBus::publish(const MenuEvent& event, EventSource source, EventPriority priority) {
+    EventEnvelope envelope = makeEnvelope(EventTopic::MENU, source, priority);
+    envelope.payload.menu = event;
+    return publish(envelope);
+}
+
+bool EventBus::publishStateChanged(StateChange what, EventSource source, EventPriority priority) {
+    EventEnvelope envelope = makeEnvelope(EventTopic::STATE_CHANGED, source, priority);
+    envelope.payload.state = StateChangedEvent{ what };
+    return publish(envelope);
+}
+
+EventTopicStats EventBus::getStats(EventTopic topic) const {
+    uint8_t index = static_cast<uint8_t>(topic);
+    if (index >= EVENT_TOPIC_COUNT) {
+        return EventTopicStats{};
+    }
+
+    taskENTER_CRITICAL(&busMux);
+    EventTopicStats stats = topics[index].stats;
+    taskEXIT_CRITICAL(&busMux);
+    return stats;
+}
+
+void EventBus::logStats() const {
+    for (uint8_t i = 0; i < EVENT_TOPIC_COUNT; i++) {
+        EventTopic topic = static_cast<EventTopic>(i);
+        [[maybe_unused]] EventTopicStats stats = getStats(topic);
+        LOG_INFO(TAG, "%-13s pub=%u dlv=%u drop=%u depth=%u max=%u",
+                 eventTopicToString(topic),
+                 static_cast<unsigned>(stats.published),
+                 static_cast<unsigned>(stats.delivered),
+                 static_cast<unsigned>(stats.dropped),
+                 stats.depth, stats.maxDepth);
+    }
+}
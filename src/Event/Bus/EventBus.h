@@ -0,0 +1,107 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "Config/event_bus_config.h"
+#include "Enum/ErrorEnum.h"
+#include "Enum/EventTopicEnum.h"
+#include "Type/EventEnvelope.h"
+#include "Delegate.h"
+
+/**
+ * @brief Synchronous subscriber, called on the publisher's task
+ *
+ * Must be short and must not block (typically: bump a counter, forward into
+ * a component's own queue). Returns false if the event was dropped.
+ */
+using EventListener = Delegate<bool(const EventEnvelope& event)>;
+
+/**
+ * @brief Per-topic delivery counters
+ */
+struct EventTopicStats {
+    uint32_t published;  ///< publish() calls on the topic
+    uint32_t delivered;  ///< Successful listener calls + queue sends
+    uint32_t dropped;    ///< Rejected by a listener, queue full, or shed (BACKGROUND priority)
+    uint8_t depth;       ///< Deepest subscriber queue right now
+    uint8_t maxDepth;    ///< Deepest subscriber queue ever seen after a send
+};
+
+/**
+ * @brief Typed publish/subscribe bus for input and state events
+ *
+ * Each topic fans out to up to EVENT_BUS_MAX_SUBSCRIBERS subscribers. A
+ * subscriber is either a listener callback or a FreeRTOS queue of
+ * EventEnvelope drained by the subscriber's own task. Several topics may
+ * share one queue. Subscriptions are expected during setup; publishing is
+ * safe from any task (not from ISRs).
+ *
+ * Architecture: Event Bus
+ * *Dispatcher -> EventBus -> {listeners, subscriber queues} -> *Handler
+ */
+class EventBus {
+public:
+    EventBus();
+
+    /**
+     * @brief Subscribe a callback to a topic
+     *
+     * Typically a bound member: EventListener::bind<T, &T::onEvent>(obj)
+     *
+     * @return Error::INVALID_PARAM on empty listener, Error::INVALID_STATE if the topic is full
+     */
+    Error subscribe(EventTopic topic, EventListener listener);
+
+    /**
+     * @brief Subscribe a queue (created with createQueue) to a topic
+     * @return Error::INVALID_PARAM on null queue, Error::INVALID_STATE if the topic is full
+     */
+    Error subscribeQueue(EventTopic topic, QueueHandle_t queue);
+
+    /**
+     * @brief Create a subscriber queue sized for EventEnvelope
+     * @param depth Number of envelopes the queue can hold
+     */
+    static QueueHandle_t createQueue(uint8_t depth = EVENT_BUS_QUEUE_DEPTH);
+
+    /**
+     * @brief Deliver an envelope to every subscriber of its topic
+     * @param envelope Topic, source and payload set; timestamp is filled if zero
+     * @return true if no subscriber dropped it
+     */
+    bool publish(EventEnvelope& envelope);
+
+    bool publish(const EncoderInputEvent& event, EventSource source, EventPriority priority = EventPriority::NORMAL);
+    bool publish(const ButtonEvent& event, EventSource source, EventPriority priority = EventPriority::NORMAL);
+    bool publish(const AppEvent& event, EventSource source, EventPriority priority = EventPriority::NORMAL);
+    bool publish(const MenuEvent& event, EventSource source, EventPriority priority = EventPriority::NORMAL);
+    bool publishStateChanged(StateChange what, EventSource source, EventPriority priority = EventPriority::NORMAL);
+
+    EventTopicStats getStats(EventTopic topic) const;
+
+    /**
+     * @brief Log one line of statistics per topic
+     */
+    void logStats() const;
+
+private:
+    struct Subscriber {
+        EventListener listener;
+        QueueHandle_t queue;
+    };
+
+    struct Topic {
+        Subscriber subscribers[EVENT_BUS_MAX_SUBSCRIBERS];
+        uint8_t subscriberCount;
+        EventTopicStats stats;
+    };
+
+    Topic topics[EVENT_TOPIC_COUNT];
+    mutable portMUX_TYPE busMux = portMUX_INITIALIZER_UNLOCKED;
+
+    Error addSubscriber(EventTopic topic, const Subscriber& subscriber);
+    bool sendToQueue(QueueHandle_t queue, const EventEnvelope& envelope);
+    static EventEnvelope makeEnvelope(EventTopic topic, EventSource source, EventPriority priority);
+
+    static constexpr const char* TAG = "EventBus";
+};
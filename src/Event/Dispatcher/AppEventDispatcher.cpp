@@ -1,15 +1,16 @@
 #include "AppEventDispatcher.h"
+#include "Event/Bus/EventBus.h"
 
-AppEventDispatcher::AppEventDispatcher(QueueHandle_t queue)
-    : appEventQueue(queue) {}
+AppEventDispatcher::AppEventDispatcher(EventBus* bus)
+    : eventBus(bus) {}
 
 void AppEventDispatcher::dispatchAppEvent(EventEnum::EncoderModeEventTypes type) {
-    if (appEventQueue) {
+    if (eventBus) {
         AppEvent event{ type };
 
         Serial.print("Dispatching AppEvent: ");
         Serial.println(EncoderModeHelper::toString(type));
 
-        xQueueSend(appEventQueue, &event, 0);
+        eventBus->publish(event, EventSource::ENCODER_MODE);
     }
 }
@@ -1,19 +1,19 @@
 #pragma once
 
 #include "Arduino.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/queue.h"
 
 #include "Type/AppEvent.h"
 #include "Enum/EventEnum.h"
 #include "Helper/EncoderModeHelper.h"
 
+class EventBus;
+
 class AppEventDispatcher {
 public:
-    AppEventDispatcher(QueueHandle_t queue);
+    AppEventDispatcher(EventBus* bus);
 
     void dispatchAppEvent(EventEnum::EncoderModeEventTypes type);
 
 private:
-    QueueHandle_t appEventQueue;
+    EventBus* eventBus;
 };
@@ -1,23 +1,43 @@
 #include "ButtonEventDispatcher.h"
+#include "Event/Bus/EventBus.h"
+#include "System/LatencyTrace.h"
 #include "Config/log_config.h"
 
-ButtonEventDispatcher::ButtonEventDispatcher(QueueHandle_t queue)
-    : eventQueue(queue) {}
+ButtonEventDispatcher::ButtonEventDispatcher(EventBus* bus)
+    : eventBus(bus) {}
 
-void ButtonEventDispatcher::onButtonShortPress(uint8_t buttonIndex) {
-    if (eventQueue) {
-        ButtonEvent evt{ EventEnum::ButtonEventTypes::SHORT_PRESS, buttonIndex };
-        if (xQueueSend(eventQueue, &evt, pdMS_TO_TICKS(10)) != pdPASS) {
-            LOG_ERROR("ButtonEventDispatcher", "Failed to send SHORT_PRESS event to queue");
-        }
+void ButtonEventDispatcher::onButtonGesture(uint8_t buttonIndex, const GestureEvent& gesture) {
+    if (!eventBus) {
+        return;
     }
-}
 
-void ButtonEventDispatcher::onButtonLongPress(uint8_t buttonIndex) {
-    if (eventQueue) {
-        ButtonEvent evt{ EventEnum::ButtonEventTypes::LONG_PRESS, buttonIndex };
-        if (xQueueSend(eventQueue, &evt, pdMS_TO_TICKS(10)) != pdPASS) {
-            LOG_ERROR("ButtonEventDispatcher", "Failed to send LONG_PRESS event to queue");
-        }
+    TRACE_STAMP_ORIGIN(TraceStage::DRIVER, static_cast<uint64_t>(gesture.timestampMs) * 1000);
+
+    EventEnum::ButtonEventTypes type;
+    switch (gesture.type) {
+        case GestureEvent::Type::CLICK:
+            type = gesture.clickCount >= 3 ? EventEnum::ButtonEventTypes::TRIPLE_PRESS
+                 : gesture.clickCount == 2 ? EventEnum::ButtonEventTypes::DOUBLE_PRESS
+                 : EventEnum::ButtonEventTypes::SHORT_PRESS;
+            break;
+        case GestureEvent::Type::LONG_PRESS:
+            type = EventEnum::ButtonEventTypes::LONG_PRESS;
+            break;
+        case GestureEvent::Type::REPEAT:
+            type = EventEnum::ButtonEventTypes::REPEAT;
+            break;
+        default:
+            return;
+    }
+
+    // Repeats are disposable: shed them first when the consumer falls behind
+    EventPriority priority = type == EventEnum::ButtonEventTypes::REPEAT
+        ? EventPriority::BACKGROUND
+        : EventPriority::NORMAL;
+
+    ButtonEvent evt{ type, buttonIndex, gesture.timestampMs };
+    if (!eventBus->publish(evt, EventSource::BUTTON, priority) && priority != EventPriority::BACKGROUND) {
+        LOG_ERROR("ButtonEventDispatcher", "Failed to publish button %d event %d",
+                  buttonIndex, static_cast<int>(type));
     }
 }
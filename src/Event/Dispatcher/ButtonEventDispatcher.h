@@ -1,16 +1,24 @@
 #pragma once
 
-#include "freertos/FreeRTOS.h"
-#include "freertos/queue.h"
 #include "Type/ButtonEvent.h"
+#include "GestureEngine.h"
+
+class EventBus;
 
 class ButtonEventDispatcher {
 public:
-    explicit ButtonEventDispatcher(QueueHandle_t queue);
+    explicit ButtonEventDispatcher(EventBus* bus);
 
-    void onButtonShortPress(uint8_t buttonIndex);
-    void onButtonLongPress(uint8_t buttonIndex);
+    /**
+     * @brief Translate a recognized gesture into a ButtonEvent
+     *
+     * Runs in the timer service task (see ButtonDriver::setOnGesture), and
+     * so do the bus listeners of BUTTON_INPUT; the queue send never waits.
+     * @param buttonIndex Index of the button (0 to BUTTON_COUNT-1)
+     * @param gesture Gesture reported by ButtonDriver
+     */
+    void onButtonGesture(uint8_t buttonIndex, const GestureEvent& gesture);
 
 private:
-    QueueHandle_t eventQueue;
+    EventBus* eventBus;
 };
@@ -1,51 +1,39 @@
 #include "EncoderEventDispatcher.h"
 #include "Config/ConfigManager.h"
 #include "Enum/WheelDirection.h"
+#include "Event/Bus/EventBus.h"
+#include "System/LatencyTrace.h"
+#include "esp_timer.h"
 
-EncoderEventDispatcher::EncoderEventDispatcher(QueueHandle_t queue, ConfigManager* configManager)
-    : eventQueue(queue), configManager(configManager) {}
+EncoderEventDispatcher::EncoderEventDispatcher(EventBus* bus, ConfigManager* configManager)
+    : eventBus(bus), configManager(configManager) {}
+
+void EncoderEventDispatcher::onEncoderRotate(int32_t delta, uint64_t timestampUs) {
+    TRACE_STAMP_ORIGIN(TraceStage::DRIVER, timestampUs);
 
-void EncoderEventDispatcher::onEncoderValueChange(int32_t newValue) {
-    // Encoder boundaries: 0-1000 with circular mode enabled
-    constexpr int32_t MIN_VALUE = 0;
-    constexpr int32_t MAX_VALUE = 1000;
-    constexpr int32_t RANGE = MAX_VALUE - MIN_VALUE;
-    constexpr int32_t WRAP_THRESHOLD = RANGE / 2;  // 500 - detect wrap if delta > this
-    
-    int32_t delta = newValue - lastValue;
-    
-    // Detect and correct wrap-around
-    if (delta > WRAP_THRESHOLD) {
-        // Wrapped backward: 5 -> 998 should be -7, not +993
-        delta = delta - RANGE;
-    } else if (delta < -WRAP_THRESHOLD) {
-        // Wrapped forward: 998 -> 5 should be +7, not -993
-        delta = delta + RANGE;
-    }
-    
     // Apply wheel direction inversion if configured
     if (configManager && configManager->getWheelDirection() == WheelDirection::REVERSED) {
         delta = -delta;
     }
-    
-    lastValue = newValue;
 
-    if (delta != 0 && eventQueue) {
-        EncoderInputEvent evt{ EventEnum::EncoderInputEventTypes::ROTATE, delta };
-        xQueueSend(eventQueue, &evt, 0);
+    if (delta != 0 && eventBus) {
+        EncoderInputEvent evt{ EventEnum::EncoderInputEventTypes::ROTATE, delta, timestampUs };
+        eventBus->publish(evt, EventSource::ENCODER);
     }
 }
 
+// Clicks drive the menu and mode switches, and arrive from the encoder driver task,
+// which may wait briefly for a slot rather than lose one
 void EncoderEventDispatcher::onShortClick() {
-    if (eventQueue) {
-        EncoderInputEvent evt{ EventEnum::EncoderInputEventTypes::SHORT_CLICK };
-        xQueueSend(eventQueue, &evt, 0);
+    if (eventBus) {
+        EncoderInputEvent evt{ EventEnum::EncoderInputEventTypes::SHORT_CLICK, 0, static_cast<uint64_t>(esp_timer_get_time()) };
+        eventBus->publish(evt, EventSource::ENCODER, EventPriority::URGENT);
     }
 }
 
 void EncoderEventDispatcher::onLongClick() {
-    if (eventQueue) {
-        EncoderInputEvent evt{ EventEnum::EncoderInputEventTypes::LONG_CLICK };
-        xQueueSend(eventQueue, &evt, 0);
+    if (eventBus) {
+        EncoderInputEvent evt{ EventEnum::EncoderInputEventTypes::LONG_CLICK, 0, static_cast<uint64_t>(esp_timer_get_time()) };
+        eventBus->publish(evt, EventSource::ENCODER, EventPriority::URGENT);
     }
 }
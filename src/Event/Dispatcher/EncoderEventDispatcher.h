@@ -1,21 +1,20 @@
 #pragma once
 
-#include "freertos/FreeRTOS.h"
-#include "freertos/queue.h"
 #include "Type/EncoderInputEvent.h"
 
+class EventBus;
+
 class ConfigManager;
 
 class EncoderEventDispatcher {
 public:
-    EncoderEventDispatcher(QueueHandle_t queue, ConfigManager* configManager);
+    EncoderEventDispatcher(EventBus* bus, ConfigManager* configManager);
 
-    void onEncoderValueChange(int32_t newValue);
+    void onEncoderRotate(int32_t delta, uint64_t timestampUs);
     void onShortClick();
     void onLongClick();
 
 private:
-    QueueHandle_t eventQueue;
+    EventBus* eventBus;
     ConfigManager* configManager;
-    int32_t lastValue = 500;  // Match encoder initial value from EncoderDriver::begin()
 };
@@ -1,12 +1,13 @@
 #include "MenuEventDispatcher.h"
+#include "Event/Bus/EventBus.h"
 #include "Config/log_config.h"
 
 static constexpr const char* TAG = "MenuEventDispatcher";
 
-QueueHandle_t MenuEventDispatcher::eventQueue = nullptr;
+EventBus* MenuEventDispatcher::eventBus = nullptr;
 
-void MenuEventDispatcher::init(QueueHandle_t queue) {
-    eventQueue = queue;
+void MenuEventDispatcher::init(EventBus* bus) {
+    eventBus = bus;
 }
 
 void MenuEventDispatcher::dispatchActivated(const MenuItem* currentItem, uint8_t selectedIndex, uint8_t itemCount) {
@@ -46,8 +47,8 @@ void MenuEventDispatcher::dispatchItemSelected(const MenuItem* selectedItem) {
 }
 
 void MenuEventDispatcher::dispatch(const MenuEvent& event) {
-    if (eventQueue) {
-        if (xQueueSend(eventQueue, &event, 0) != pdTRUE) {
+    if (eventBus) {
+        if (!eventBus->publish(event, EventSource::MENU)) {
             LOG_INFO(TAG, "Event queue full, event dropped");
         }
     }
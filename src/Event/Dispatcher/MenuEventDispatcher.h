@@ -1,25 +1,26 @@
 #pragma once
 
-#include "freertos/FreeRTOS.h"
-#include "freertos/queue.h"
 #include "Type/MenuEvent.h"
 
+class EventBus;
+
 /**
  * @brief Singleton dispatcher for menu events
  *
  * MenuController uses this dispatcher to emit events when menu state changes.
- * MenuEventHandler subscribes by consuming events from the queue.
+ * Events are published on the MENU topic of the EventBus; MenuEventHandler
+ * subscribes with its own queue.
  *
  * Architecture: Distributed Event Pipeline (Option B)
- * MenuController -> MenuEventDispatcher -> MenuEventQueue -> MenuEventHandler
+ * MenuController -> MenuEventDispatcher -> EventBus -> MenuEventHandler
  */
 class MenuEventDispatcher {
 public:
     /**
-     * @brief Initialize the dispatcher with a queue handle
-     * @param queue FreeRTOS queue for MenuEvent structs
+     * @brief Initialize the dispatcher with the event bus
+     * @param bus EventBus to publish MENU events on
      */
-    static void init(QueueHandle_t queue);
+    static void init(EventBus* bus);
 
     /**
      * @brief Dispatch a menu activated event
@@ -49,7 +50,7 @@ public:
     static void dispatchItemSelected(const MenuItem* selectedItem);
 
 private:
-    static QueueHandle_t eventQueue;
+    static EventBus* eventBus;
 
     static void dispatch(const MenuEvent& event);
 };
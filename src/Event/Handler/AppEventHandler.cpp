@@ -1,4 +1,5 @@
 #include "AppEventHandler.h"
+#include "System/LatencyTrace.h"
 
 AppEventHandler::AppEventHandler(QueueHandle_t queue, EncoderModeManager* encoderModeManager)
     : eventQueue(queue), encoderModeManager(encoderModeManager) {}
@@ -12,10 +13,14 @@ void AppEventHandler::taskEntry(void* param) {
 }
 
 void AppEventHandler::taskLoop() {
-    AppEvent evt;
+    EventEnvelope envelope;
 
     while (true) {
-        if (xQueueReceive(eventQueue, &evt, portMAX_DELAY)) {
+        if (xQueueReceive(eventQueue, &envelope, portMAX_DELAY)) {
+            const AppEvent& evt = envelope.payload.app;
+            TRACE_BEGIN(envelope.originUs);
+            TRACE_STAMP(TraceStage::HANDLER);
+
             Serial.print("AppEvent received: ");
             Serial.println(EncoderModeHelper::toString(evt.type));
 
@@ -5,7 +5,7 @@
 #include "Arduino.h"
 
 #include "Enum/EventEnum.h"
-#include "Type/AppEvent.h"
+#include "Type/EventEnvelope.h"
 #include "EncoderMode/Manager/EncoderModeManager.h"
 #include "Helper/EncoderModeHelper.h"
 
@@ -3,28 +3,23 @@
 #include "Config/ConfigManager.h"
 #include "Config/button_config.h"
 #include "BLE/BleKeyboardService.h"
-#include "System/PowerManager.h"
+#include "Event/Bus/EventBus.h"
+#include "System/LatencyTrace.h"
 #include "Macro/Manager/MacroManager.h"
 #include "state/HardwareState.h"
 #include "Enum/MacroInputEnum.h"
 
-ButtonEventHandler::ButtonEventHandler(QueueHandle_t queue, ConfigManager* config, BleKeyboardService* bleService, PowerManager* pm, HardwareState* hwState, MacroManager* macroMgr)
+ButtonEventHandler::ButtonEventHandler(QueueHandle_t queue, ConfigManager* config, BleKeyboardService* bleService, EventBus* bus, HardwareStateStore* hwState, MacroManager* macroMgr)
     : eventQueue(queue)
     , configManager(config)
     , bleKeyboardService(bleService)
-    , powerManager(pm)
+    , eventBus(bus)
     , hardwareState(hwState)
-    , macroManager(macroMgr)
-    , cacheValid(false) {
+    , macroManager(macroMgr) {
     // Dependencies are required - validate they are not null
     if (!config || !bleService || !hwState || !macroMgr) {
         LOG_ERROR("ButtonEventHandler", "Constructor called with null dependencies");
     }
-
-    // Initialize cache to NONE (safe default - ID 0)
-    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
-        actionCache[i] = 0;  // ID 0 = NONE action
-    }
 }
 
 void ButtonEventHandler::start() {
@@ -58,89 +53,81 @@ void ButtonEventHandler::start() {
     LOG_INFO("ButtonEventHandler", "Task started successfully");
 }
 
-void ButtonEventHandler::invalidateCache() {
-    cacheValid = false;
-    LOG_DEBUG("ButtonEventHandler", "Button action cache invalidated");
+void ButtonEventHandler::taskEntry(void* param) {
+    static_cast<ButtonEventHandler*>(param)->taskLoop();
 }
 
-void ButtonEventHandler::loadCache() {
-    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
-        actionCache[i] = configManager->loadButtonAction(i);
+void ButtonEventHandler::taskLoop() {
+    EventEnvelope envelope;
+
+    while (true) {
+        if (xQueueReceive(eventQueue, &envelope, portMAX_DELAY)) {
+            handleEvent(envelope);
+        }
     }
-    cacheValid = true;
-    LOG_INFO("ButtonEventHandler", "Button action cache loaded from NVS");
 }
 
-void ButtonEventHandler::notifyUserActivity() {
-    if (powerManager) {
-        powerManager->resetActivity();
+void ButtonEventHandler::handleEvent(const EventEnvelope& envelope) {
+    const ButtonEvent& evt = envelope.payload.button;
+    TRACE_BEGIN(envelope.originUs);
+    TRACE_STAMP(TraceStage::HANDLER);
+
+    // Priority 1: Macro button long press toggles macro mode
+    if (evt.buttonIndex == MACRO_BUTTON_INDEX && evt.type == EventEnum::ButtonEventTypes::LONG_PRESS) {
+        macroManager->toggleMacroMode();
+        bool active = macroManager->isMacroModeActive();
+        hardwareState->update([active](HardwareState& state) { state.macroModeActive = active; });
+        LOG_INFO("ButtonEventHandler", "Macro mode toggled to %s", active ? "ON" : "OFF");
+        if (eventBus) {
+            eventBus->publishStateChanged(StateChange::MACRO_MODE, EventSource::BUTTON);
+        }
+        return;
     }
-}
 
-void ButtonEventHandler::taskEntry(void* param) {
-    static_cast<ButtonEventHandler*>(param)->taskLoop();
-}
+    // Ignore short press on macro button
+    if (evt.buttonIndex == MACRO_BUTTON_INDEX && evt.type == EventEnum::ButtonEventTypes::SHORT_PRESS) {
+        LOG_INFO("ButtonEventHandler", "Macro button short press ignored");
+        return;
+    }
 
-void ButtonEventHandler::taskLoop() {
-    ButtonEvent evt;
+    // Only process regular buttons when NOT in macro button context
+    if (evt.buttonIndex == MACRO_BUTTON_INDEX) {
+        return;
+    }
 
-    while (true) {
-        if (xQueueReceive(eventQueue, &evt, portMAX_DELAY)) {
-            // Interface-enforced user activity notification
-            notifyUserActivity();
-
-            // Priority 1: Macro button long press toggles macro mode
-            if (evt.buttonIndex == MACRO_BUTTON_INDEX && evt.type == EventEnum::ButtonEventTypes::LONG_PRESS) {
-                macroManager->toggleMacroMode();
-                hardwareState->macroModeActive = macroManager->isMacroModeActive();
-                LOG_INFO("ButtonEventHandler", "Macro mode toggled to %s",
-                         hardwareState->macroModeActive ? "ON" : "OFF");
-                continue;
-            }
-
-            // Ignore short press on macro button
-            if (evt.buttonIndex == MACRO_BUTTON_INDEX && evt.type == EventEnum::ButtonEventTypes::SHORT_PRESS) {
-                LOG_INFO("ButtonEventHandler", "Macro button short press ignored");
-                continue;
-            }
-
-            // Only process short press events for regular buttons
-            if (evt.type != EventEnum::ButtonEventTypes::SHORT_PRESS) {
-                LOG_INFO("ButtonEventHandler", "Button %d long press (no action)", evt.buttonIndex);
-                continue;
-            }
-
-            // Only process regular buttons when NOT in macro button context
-            if (evt.buttonIndex == MACRO_BUTTON_INDEX) {
-                continue;
-            }
-
-            LOG_INFO("ButtonEventHandler", "Button %d short press", evt.buttonIndex);
-
-            // Priority 2: Try macro execution if macro mode active
-            if (hardwareState->macroModeActive) {
-                MacroInput input = static_cast<MacroInput>(mapButtonIndexToMacroInput(evt.buttonIndex));
-                if (macroManager->executeMacro(input)) {
-                    LOG_INFO("ButtonEventHandler", "Macro executed for button %d", evt.buttonIndex);
-                    continue;
-                }
-                LOG_INFO("ButtonEventHandler", "No macro assigned for button %d, falling through", evt.buttonIndex);
-            }
-
-            // Priority 3: Normal button action
-            executeButtonAction(evt.buttonIndex);
+    // Hold-to-repeat only re-sends repeatable actions, never macros
+    if (evt.type == EventEnum::ButtonEventTypes::REPEAT) {
+        if (!hardwareState->read().macroModeActive) {
+            repeatButtonAction(evt.buttonIndex);
         }
+        return;
     }
-}
 
-void ButtonEventHandler::executeButtonAction(uint8_t buttonIndex) {
-    // Load cache if invalid (first press or after config change)
-    if (!cacheValid) {
-        loadCache();
+    // Only process short press events for regular buttons
+    if (evt.type != EventEnum::ButtonEventTypes::SHORT_PRESS) {
+        LOG_INFO("ButtonEventHandler", "Button %d gesture %d (no action)", evt.buttonIndex, static_cast<int>(evt.type));
+        return;
+    }
+
+    LOG_INFO("ButtonEventHandler", "Button %d short press", evt.buttonIndex);
+
+    // Priority 2: Try macro execution if macro mode active
+    if (hardwareState->read().macroModeActive) {
+        MacroInput input = static_cast<MacroInput>(mapButtonIndexToMacroInput(evt.buttonIndex));
+        if (macroManager->executeMacro(input)) {
+            LOG_INFO("ButtonEventHandler", "Macro executed for button %d", evt.buttonIndex);
+            return;
+        }
+        LOG_INFO("ButtonEventHandler", "No macro assigned for button %d, falling through", evt.buttonIndex);
     }
 
-    // Get action ID from RAM cache (fast: <100ns vs ~1-5ms NVS read)
-    ButtonActionId actionId = actionCache[buttonIndex];
+    // Priority 3: Normal button action
+    executeButtonAction(evt.buttonIndex);
+}
+
+void ButtonEventHandler::executeButtonAction(uint8_t buttonIndex) {
+    // Lock-free read of ConfigManager's RAM snapshot (never touches NVS)
+    ButtonActionId actionId = configManager->loadButtonAction(buttonIndex);
 
     // Execute via service - service handles connection check, validation, and execution
     if (!bleKeyboardService->executeMediaKey(actionId)) {
@@ -148,6 +135,15 @@ void ButtonEventHandler::executeButtonAction(uint8_t buttonIndex) {
     }
 }
 
+void ButtonEventHandler::repeatButtonAction(uint8_t buttonIndex) {
+    ButtonActionId actionId = configManager->loadButtonAction(buttonIndex);
+    if (!bleKeyboardService->isRepeatable(actionId)) {
+        return;
+    }
+
+    bleKeyboardService->executeMediaKey(actionId);
+}
+
 uint8_t ButtonEventHandler::mapButtonIndexToMacroInput(uint8_t buttonIndex) {
     switch (buttonIndex) {
         case 0:
@@ -1,72 +1,63 @@
 #pragma once
 
 #include "Arduino.h"
-#include "Type/ButtonEvent.h"
+#include "Type/EventEnvelope.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
 #include "Config/button_config.h"
-#include "Event/Handler/Interface/EventHandlerInterface.h"
+#include "state/HardwareState.h"
 
 // Forward declarations
 class ConfigManager;
-class PowerManager;
+class EventBus;
 class BleKeyboardService;
 class MacroManager;
-struct HardwareState;
 
 using ButtonActionId = uint8_t;
 
-class ButtonEventHandler : public EventHandlerInterface {
+class ButtonEventHandler {
 public:
     /**
      * @brief Constructor with dependency injection
-     * @param queue Event queue for button events
+     * @param queue EventEnvelope queue subscribed to BUTTON_INPUT
      * @param config ConfigManager instance to read button action configuration
      * @param bleService BLE keyboard service to execute actions
-     * @param pm PowerManager instance to reset activity timer
+     * @param bus EventBus to announce macro mode changes on
      * @param hwState HardwareState instance to track macro mode state
      * @param macroMgr MacroManager instance for macro mode toggle and execution
      */
-    ButtonEventHandler(QueueHandle_t queue, ConfigManager* config, BleKeyboardService* bleService, PowerManager* pm, HardwareState* hwState, MacroManager* macroMgr);
+    ButtonEventHandler(QueueHandle_t queue, ConfigManager* config, BleKeyboardService* bleService, EventBus* bus, HardwareStateStore* hwState, MacroManager* macroMgr);
 
     void start();
 
     /**
-     * @brief Invalidate the button action cache, forcing reload from NVS on next button press
-     * Called by SetButtonBehaviorAction when configuration changes
+     * @brief Act on one BUTTON_INPUT envelope (the task calls this per queued event)
      */
-    void invalidateCache();
-
-    // EventHandlerInterface implementation
-    void notifyUserActivity() override;
+    void handleEvent(const EventEnvelope& envelope);
 
 private:
     QueueHandle_t eventQueue;
     ConfigManager* configManager;
     BleKeyboardService* bleKeyboardService;
-    PowerManager* powerManager;
-    HardwareState* hardwareState;
+    EventBus* eventBus;
+    HardwareStateStore* hardwareState;
     MacroManager* macroManager;
 
-    // RAM cache for button actions (avoid NVS read latency on every button press)
-    // Size automatically syncs with BUTTON_COUNT from button_config.h (compile-time constant)
-    ButtonActionId actionCache[BUTTON_COUNT];
-    bool cacheValid;
-
     static void taskEntry(void* param);
     void taskLoop();
     
-    /**
-     * @brief Load button action configuration from NVS into RAM cache
-     */
-    void loadCache();
-    
     /**
      * @brief Execute the configured action for a button press
      * @param buttonIndex Index of the button (0 to BUTTON_COUNT-1)
      */
     void executeButtonAction(uint8_t buttonIndex);
 
+    /**
+     * @brief Re-send the configured action while a button is held, if it is repeatable
+     * @param buttonIndex Index of the button (0 to BUTTON_COUNT-1)
+     */
+    void repeatButtonAction(uint8_t buttonIndex);
+
     /**
      * @brief Convert button index to MacroInput enum
      * @param buttonIndex Button index (0-3 for regular buttons)
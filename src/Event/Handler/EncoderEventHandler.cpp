@@ -1,13 +1,15 @@
 #include "EncoderEventHandler.h"
 #include "Menu/Controller/MenuController.h"
 #include "Config/log_config.h"
-#include "System/PowerManager.h"
 #include "Macro/Manager/MacroManager.h"
 #include "state/HardwareState.h"
 #include "Enum/MacroInputEnum.h"
+#include "EncoderMode/Acceleration/AccelerationEngine.h"
+#include "Event/Queue/EncoderEventQueue.h"
+#include "System/LatencyTrace.h"
 
-EncoderEventHandler::EncoderEventHandler(QueueHandle_t queue, PowerManager* pm, HardwareState* hwState, MacroManager* macroMgr)
-    : eventQueue(queue), powerManager(pm), hardwareState(hwState), macroManager(macroMgr) {
+EncoderEventHandler::EncoderEventHandler(EncoderEventQueue* queue, HardwareStateStore* hwState, MacroManager* macroMgr)
+    : eventQueue(queue), hardwareState(hwState), macroManager(macroMgr) {
     // Validate dependencies
     if (!hwState || !macroMgr) {
         LOG_ERROR("EncoderEventHandler", "Constructor called with null dependencies");
@@ -29,14 +31,12 @@ void EncoderEventHandler::setMenuController(MenuController* controller) {
     menuController = controller;
 }
 
-void EncoderEventHandler::start() {
-    xTaskCreate(taskEntry, "EncoderEventTask", 4096, this, 1, nullptr);
+void EncoderEventHandler::setAccelerationEngine(AccelerationEngine* engine) {
+    accelerationEngine = engine;
 }
 
-void EncoderEventHandler::notifyUserActivity() {
-    if (powerManager) {
-        powerManager->resetActivity();
-    }
+void EncoderEventHandler::start() {
+    xTaskCreate(taskEntry, "EncoderEventTask", 4096, this, 1, nullptr);
 }
 
 void EncoderEventHandler::taskEntry(void* param) {
@@ -47,57 +47,69 @@ void EncoderEventHandler::taskLoop() {
     EncoderInputEvent evt;
 
     while (true) {
-        if (xQueueReceive(eventQueue, &evt, portMAX_DELAY)) {
-            // Interface-enforced user activity notification
-            notifyUserActivity();
-
-            // Priority 1: Menu intercepts events when active
-            if (menuController && menuController->isActive()) {
-                switch (evt.type) {
-                    case EventEnum::EncoderInputEventTypes::ROTATE:
-                        menuController->handleRotation(evt.delta);
-                        break;
-                    case EventEnum::EncoderInputEventTypes::SHORT_CLICK:
-                        menuController->handleSelect();
-                        break;
-                    case EventEnum::EncoderInputEventTypes::LONG_CLICK:
-                        menuController->handleBack();
-                        break;
-                }
-                continue;  // Event consumed by menu
-            }
+        if (eventQueue->receive(evt, portMAX_DELAY)) {
+            handleEvent(evt);
+        }
+    }
+}
 
-            // Long-press activates menu when inactive
-            if (menuController && evt.type == EventEnum::EncoderInputEventTypes::LONG_CLICK) {
-                menuController->activate();
-                continue;  // Event consumed
-            }
+void EncoderEventHandler::handleEvent(const EncoderInputEvent& evt) {
+    TRACE_BEGIN(evt.timestampUs);
+    TRACE_STAMP(TraceStage::HANDLER);
+
+    // Priority 1: Menu intercepts events when active
+    if (menuController && menuController->isActive()) {
+        switch (evt.type) {
+            case EventEnum::EncoderInputEventTypes::ROTATE:
+                menuController->handleRotation(evt.delta);
+                break;
+            case EventEnum::EncoderInputEventTypes::SHORT_CLICK:
+                menuController->handleSelect();
+                break;
+            case EventEnum::EncoderInputEventTypes::LONG_CLICK:
+                menuController->handleBack();
+                break;
+        }
+        return;  // Event consumed by menu
+    }
 
-            // Priority 2: Try macro execution if macro mode active
-            if (hardwareState->macroModeActive) {
-                MacroInput input = static_cast<MacroInput>(mapEncoderEventToMacroInput(evt));
-                if (macroManager->executeMacro(input)) {
-                    LOG_INFO("EncoderEventHandler", "Macro executed for input");
-                    continue;
-                }
-                LOG_INFO("EncoderEventHandler", "No macro assigned, falling through");
-            }
+    // Long-press activates menu when inactive
+    if (menuController && evt.type == EventEnum::EncoderInputEventTypes::LONG_CLICK) {
+        menuController->activate();
+        return;  // Event consumed
+    }
 
-            // Priority 3: Normal mode handling
-            if (!currentHandler) continue;
-
-            switch (evt.type) {
-                case EventEnum::EncoderInputEventTypes::ROTATE:
-                    currentHandler->handleRotate(evt.delta);
-                    break;
-                case EventEnum::EncoderInputEventTypes::SHORT_CLICK:
-                    currentHandler->handleShortClick();
-                    break;
-                case EventEnum::EncoderInputEventTypes::LONG_CLICK:
-                    currentHandler->handleLongClick();
-                    break;
+    // Priority 2: Try macro execution if macro mode active
+    if (hardwareState->read().macroModeActive) {
+        MacroInput input = static_cast<MacroInput>(mapEncoderEventToMacroInput(evt));
+        if (macroManager->executeMacro(input)) {
+            LOG_INFO("EncoderEventHandler", "Macro executed for input");
+            return;
+        }
+        LOG_INFO("EncoderEventHandler", "No macro assigned, falling through");
+    }
+
+    // Priority 3: Normal mode handling
+    if (!currentHandler) return;
+
+    switch (evt.type) {
+        case EventEnum::EncoderInputEventTypes::ROTATE: {
+            // Menu and macro paths above stay exact; only wheel modes accelerate
+            int32_t delta = evt.delta;
+            if (accelerationEngine) {
+                delta = accelerationEngine->apply(hardwareState->read().encoderWheelState.mode, delta, evt.timestampUs);
+            }
+            if (delta != 0) {
+                currentHandler->handleRotate(delta);
             }
+            break;
         }
+        case EventEnum::EncoderInputEventTypes::SHORT_CLICK:
+            currentHandler->handleShortClick();
+            break;
+        case EventEnum::EncoderInputEventTypes::LONG_CLICK:
+            currentHandler->handleLongClick();
+            break;
     }
 }
 
@@ -6,30 +6,35 @@
 #include "freertos/queue.h"
 #include "EncoderMode/Handler/EncoderModeHandlerInterface.h"
 #include "EncoderMode/Interface/EncoderModeBaseInterface.h"
-#include "Event/Handler/Interface/EventHandlerInterface.h"
+#include "state/HardwareState.h"
 
 class MenuController;
-class PowerManager;
 class MacroManager;
-struct HardwareState;
+class AccelerationEngine;
+class EncoderEventQueue;
 
-class EncoderEventHandler : public EventHandlerInterface {
+class EncoderEventHandler {
 public:
-    EncoderEventHandler(QueueHandle_t queue, PowerManager* pm, HardwareState* hwState, MacroManager* macroMgr);
+    EncoderEventHandler(EncoderEventQueue* queue, HardwareStateStore* hwState, MacroManager* macroMgr);
 
     void setModeHandler(EncoderModeBaseInterface* handler);
     void setMenuController(MenuController* controller);
+    void setAccelerationEngine(AccelerationEngine* engine);
     void start();
 
-    // EventHandlerInterface implementation
-    void notifyUserActivity() override;
+    /**
+     * @brief Route one input to the menu, a macro or the wheel mode handler
+     *
+     * The task calls this for every event it takes off the queue.
+     */
+    void handleEvent(const EncoderInputEvent& evt);
 
 private:
-    QueueHandle_t eventQueue;
+    EncoderEventQueue* eventQueue;
     EncoderModeBaseInterface* currentHandler = nullptr;
     MenuController* menuController = nullptr;
-    PowerManager* powerManager;
-    HardwareState* hardwareState;
+    AccelerationEngine* accelerationEngine = nullptr;
+    HardwareStateStore* hardwareState;
     MacroManager* macroManager;
 
     static void taskEntry(void* param);
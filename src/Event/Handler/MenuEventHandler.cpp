@@ -1,12 +1,11 @@
 #include "MenuEventHandler.h"
 #include "Menu/Model/MenuItem.h"
 #include "Config/log_config.h"
-#include "state/HardwareState.h"
+#include "System/LatencyTrace.h"
 
-MenuEventHandler::MenuEventHandler(QueueHandle_t menuEventQueue, QueueHandle_t displayRequestQueue, HardwareState* hwState)
+MenuEventHandler::MenuEventHandler(QueueHandle_t menuEventQueue, QueueHandle_t displayRequestQueue)
     : menuEventQueue(menuEventQueue)
-    , displayRequestQueue(displayRequestQueue)
-    , hardwareState(hwState) {
+    , displayRequestQueue(displayRequestQueue) {
 }
 
 void MenuEventHandler::start(uint32_t stackSize, UBaseType_t priority) {
@@ -19,10 +18,14 @@ void MenuEventHandler::taskEntry(void* param) {
 }
 
 void MenuEventHandler::taskLoop() {
-    MenuEvent event;
+    EventEnvelope envelope;
 
     while (true) {
-        if (xQueueReceive(menuEventQueue, &event, portMAX_DELAY) == pdTRUE) {
+        if (xQueueReceive(menuEventQueue, &envelope, portMAX_DELAY) == pdTRUE) {
+            const MenuEvent& event = envelope.payload.menu;
+            TRACE_BEGIN(envelope.originUs);
+            TRACE_STAMP(TraceStage::HANDLER);
+
             switch (event.type) {
                 case MenuEventType::MENU_ACTIVATED:
                     handleMenuActivated(event);
@@ -71,35 +74,17 @@ void MenuEventHandler::sendDrawMenuRequest(const MenuEvent& event) {
         return;
     }
 
+    // Labels and status bar state are read by DisplayTask when it draws
     DisplayRequest request{};
     request.type = DisplayRequestType::DRAW_MENU;
-    request.data.menu.title = event.currentItem->label;
-    request.data.menu.count = event.itemCount;
+    request.data.menu.parent = event.currentItem;
     request.data.menu.selected = event.selectedIndex;
-    request.data.menu.hwState = *hardwareState;  // Pass hardware state for menu status bar
-
-    // Populate menu items from children
-    const MenuItem* children = event.currentItem->children;
-    uint8_t count = event.itemCount;
-
-    if (count > DISPLAY_MAX_MENU_ITEMS) {
-        count = DISPLAY_MAX_MENU_ITEMS;
-    }
-
-    for (uint8_t i = 0; i < count; i++) {
-        request.data.menu.items[i] = children[i].label;
-    }
-
-    // Clear remaining slots
-    for (uint8_t i = count; i < DISPLAY_MAX_MENU_ITEMS; i++) {
-        request.data.menu.items[i] = nullptr;
-    }
-
-    request.data.menu.count = count;
 
     if (xQueueSend(displayRequestQueue, &request, 0) != pdTRUE) {
         LOG_INFO(TAG, "Display queue full, menu request dropped");
+        return;
     }
+    TRACE_STAMP(TraceStage::DISPLAY_SUBMIT);
 }
 
 void MenuEventHandler::sendClearRequest() {
@@ -114,9 +99,10 @@ void MenuEventHandler::sendClearRequest() {
 void MenuEventHandler::sendDrawNormalModeRequest() {
     DisplayRequest request{};
     request.type = DisplayRequestType::DRAW_NORMAL_MODE;
-    request.data.normalMode.hwState = *hardwareState;
 
     if (xQueueSend(displayRequestQueue, &request, 0) != pdTRUE) {
         LOG_INFO(TAG, "Display queue full, normal mode request dropped");
+        return;
     }
+    TRACE_STAMP(TraceStage::DISPLAY_SUBMIT);
 }
@@ -2,30 +2,26 @@
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
-#include "Type/MenuEvent.h"
+#include "Type/EventEnvelope.h"
 #include "Display/Model/DisplayRequest.h"
 
-// Forward declarations
-struct HardwareState;
-
 /**
  * @brief Handles menu events and translates them to display requests
  *
- * Consumes MenuEvent from MenuEventQueue and pushes DisplayRequest
- * to DisplayRequestQueue. This decouples menu logic from display output.
+ * Consumes MENU events from its EventBus subscriber queue and pushes
+ * DisplayRequest to DisplayRequestQueue. This decouples menu logic from display output.
  *
  * Architecture: Menu Event Pipeline (Option B)
- * MenuController -> MenuEventDispatcher -> MenuEventQueue -> MenuEventHandler -> DisplayRequestQueue
+ * MenuController -> MenuEventDispatcher -> EventBus -> MenuEventHandler -> DisplayRequestQueue
  */
 class MenuEventHandler {
 public:
     /**
      * @brief Construct MenuEventHandler with required dependencies
-     * @param menuEventQueue Queue to receive MenuEvent from
+     * @param menuEventQueue EventEnvelope queue subscribed to MENU
      * @param displayRequestQueue Queue to send DisplayRequest to
-     * @param hwState Pointer to hardware state for display requests
      */
-    MenuEventHandler(QueueHandle_t menuEventQueue, QueueHandle_t displayRequestQueue, HardwareState* hwState);
+    MenuEventHandler(QueueHandle_t menuEventQueue, QueueHandle_t displayRequestQueue);
 
     /**
      * @brief Start the event handler task
@@ -37,7 +33,6 @@ public:
 private:
     QueueHandle_t menuEventQueue;
     QueueHandle_t displayRequestQueue;
-    HardwareState* hardwareState;  ///< Hardware state for display requests
 
     static void taskEntry(void* param);
     void taskLoop();
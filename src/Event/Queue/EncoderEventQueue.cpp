@@ -0,0 +1,141 @@
+#include "EncoderEventQueue.h"
+#include "Config/log_config.h"
+
+static const char* TAG = "EncoderEventQueue";
+
+static bool isRotate(const EncoderInputEvent& evt) {
+    return evt.type == EventEnum::EncoderInputEventTypes::ROTATE;
+}
+
+EncoderEventQueue::EncoderEventQueue() : slots{}, stats{} {}
+
+bool EncoderEventQueue::init() {
+    if (!notEmpty) {
+        notEmpty = xSemaphoreCreateBinary();
+    }
+    if (!notEmpty) {
+        LOG_ERROR(TAG, "Failed to create semaphore");
+        return false;
+    }
+    return true;
+}
+
+bool EncoderEventQueue::send(const EncoderInputEvent& evt) {
+    bool stored = true;
+
+    taskENTER_CRITICAL(&queueMux);
+    if (isRotate(evt) && tryMergeIntoTail(evt)) {
+        stats.mergedEvents++;
+    } else {
+        if (count == CAPACITY && !makeRoom()) {
+            // Only clicks queued: the new event has nowhere to go
+            stats.droppedEvents++;
+            if (isRotate(evt)) {
+                stats.droppedDetents += static_cast<uint32_t>(evt.delta < 0 ? -evt.delta : evt.delta);
+            }
+            stored = false;
+        } else {
+            at(count) = evt;
+            count++;
+        }
+    }
+    taskEXIT_CRITICAL(&queueMux);
+
+    if (stored && notEmpty) {
+        xSemaphoreGive(notEmpty);
+    }
+    return stored;
+}
+
+bool EncoderEventQueue::onBusEvent(const EventEnvelope& event) {
+    if (!send(event.payload.encoder)) {
+        LOG_DEBUG(TAG, "Rotate dropped, queue full of clicks (dropped total: %u)",
+                  getStats().droppedEvents);
+        return false;
+    }
+    return true;
+}
+
+bool EncoderEventQueue::receive(EncoderInputEvent& out, TickType_t timeout) {
+    while (true) {
+        taskENTER_CRITICAL(&queueMux);
+        if (count > 0) {
+            out = at(0);
+            head = (head + 1) % CAPACITY;
+            count--;
+            taskEXIT_CRITICAL(&queueMux);
+            return true;
+        }
+        taskEXIT_CRITICAL(&queueMux);
+
+        // Binary semaphore may carry a stale give; loop re-checks the ring
+        if (!notEmpty || xSemaphoreTake(notEmpty, timeout) != pdTRUE) {
+            return false;
+        }
+    }
+}
+
+EncoderEventQueueStats EncoderEventQueue::getStats() const {
+    taskENTER_CRITICAL(&queueMux);
+    EncoderEventQueueStats snapshot = stats;
+    taskEXIT_CRITICAL(&queueMux);
+    return snapshot;
+}
+
+bool EncoderEventQueue::tryMergeIntoTail(const EncoderInputEvent& evt) {
+    if (count == 0) {
+        return false;
+    }
+
+    EncoderInputEvent& tail = at(count - 1);
+    if (!isRotate(tail)) {
+        return false;
+    }
+
+    // Same direction only while there is room, so a reversal stays visible downstream
+    bool sameDirection = (tail.delta < 0) == (evt.delta < 0);
+    if (!sameDirection && count < CAPACITY) {
+        return false;
+    }
+
+    tail.delta += evt.delta;
+    tail.timestampUs = evt.timestampUs;
+    if (tail.delta == 0) {
+        removeAt(count - 1);
+    }
+    return true;
+}
+
+bool EncoderEventQueue::makeRoom() {
+    // First choice: sum two adjacent rotations (net motion is preserved)
+    for (uint8_t i = 0; i + 1 < count; i++) {
+        EncoderInputEvent& first = at(i);
+        EncoderInputEvent& second = at(i + 1);
+        if (isRotate(first) && isRotate(second)) {
+            second.delta += first.delta;
+            removeAt(i);
+            stats.mergedEvents++;
+            return true;
+        }
+    }
+
+    // Last resort: evict the oldest rotation so a click is never lost
+    for (uint8_t i = 0; i < count; i++) {
+        const EncoderInputEvent& evt = at(i);
+        if (isRotate(evt)) {
+            stats.droppedEvents++;
+            stats.droppedDetents += static_cast<uint32_t>(evt.delta < 0 ? -evt.delta : evt.delta);
+            removeAt(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void EncoderEventQueue::removeAt(uint8_t offset) {
+    for (uint8_t i = offset; i + 1 < count; i++) {
+        at(i) = at(i + 1);
+    }
+    count--;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "Type/EncoderInputEvent.h"
+#include "Type/EventEnvelope.h"
+#include "Config/encoder_config.h"
+
+/**
+ * @brief Coalescing counters for the encoder input stage
+ */
+struct EncoderEventQueueStats {
+    uint32_t mergedEvents;   ///< ROTATE events folded into an already queued ROTATE
+    uint32_t droppedEvents;  ///< Events discarded because no slot could be freed
+    uint32_t droppedDetents; ///< Rotation lost with dropped ROTATE events
+};
+
+/**
+ * @brief Bounded encoder event queue that coalesces rotation
+ *
+ * Replaces a plain FreeRTOS queue between EncoderEventDispatcher and
+ * EncoderEventHandler. While the consumer is busy, a ROTATE is summed into
+ * a queued ROTATE at the tail instead of taking a new slot, so a burst of
+ * detents arrives as one event carrying the total delta. Clicks always get
+ * their own slot; when the queue is full, adjacent queued rotations are
+ * compacted (or the oldest rotation evicted) to make room for them.
+ *
+ * Fed from the ENCODER_INPUT topic of the EventBus via onBusEvent().
+ * Single consumer; producers may be any task.
+ */
+class EncoderEventQueue {
+public:
+    EncoderEventQueue();
+
+    /**
+     * @brief Create the wake-up semaphore (call once before use)
+     * @return true on success
+     */
+    bool init();
+
+    /**
+     * @brief Enqueue an event, coalescing rotation where possible
+     * @return false if the event (or part of the queue) had to be dropped
+     */
+    bool send(const EncoderInputEvent& evt);
+
+    /**
+     * @brief Dequeue the oldest event
+     * @param out Received event
+     * @param timeout Ticks to wait for an event
+     * @return true if an event was received
+     */
+    bool receive(EncoderInputEvent& out, TickType_t timeout);
+
+    EncoderEventQueueStats getStats() const;
+
+    /**
+     * @brief EventBus listener that forwards ENCODER_INPUT events into the queue
+     */
+    bool onBusEvent(const EventEnvelope& event);
+
+private:
+    static constexpr uint8_t CAPACITY = ENCODER_EVENT_QUEUE_CAPACITY;
+
+    EncoderInputEvent slots[CAPACITY];
+    uint8_t head = 0;   ///< Index of oldest event
+    uint8_t count = 0;
+    EncoderEventQueueStats stats;
+
+    SemaphoreHandle_t notEmpty = nullptr;
+    mutable portMUX_TYPE queueMux = portMUX_INITIALIZER_UNLOCKED;
+
+    EncoderInputEvent& at(uint8_t offset) { return slots[(head + offset) % CAPACITY]; }
+    bool tryMergeIntoTail(const EncoderInputEvent& evt);
+    bool makeRoom();
+    void removeAt(uint8_t offset);
+};
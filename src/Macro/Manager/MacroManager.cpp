@@ -1,17 +1,28 @@
 #include "MacroManager.h"
+#include <string.h>
+#include "Arduino.h"
+#include "BLE/BleKeyboardService.h"
 #include "Config/log_config.h"
+#include "Config/macro_config.h"
+#include "Macro/Vm/MacroVm.h"
+#include "System/LatencyTrace.h"
 
 static const char* TAG = "MacroManager";
 
-MacroManager::MacroManager(BleKeyboard* ble)
-    : bleKeyboard(ble)
+MacroManager::MacroManager(HidOutputTask* hidOutput, MacroVm* macroVm)
+    : hidOutput(hidOutput)
+    , macroVm(macroVm)
     , macroModeActive(false)
-    , macros{} {  // Zero-initialize array
+    , macros{}      // Zero-initialize arrays
+    , programStore(nullptr) {
     LOG_INFO(TAG, "MacroManager initialized");
 }
 
 void MacroManager::toggleMacroMode() {
     macroModeActive = !macroModeActive;
+    if (!macroModeActive && macroVm) {
+        macroVm->stop();
+    }
     LOG_INFO(TAG, "Macro mode toggled: %s", macroModeActive ? "ON" : "OFF");
 }
 
@@ -29,45 +40,60 @@ bool MacroManager::executeMacro(MacroInput input) {
 
     MacroDefinition& macro = macros[index];
 
+    // Copy out so an upload cannot change the program while it is queued
+    MacroProgram program;
+    program.length = 0;
+    if (programStore) {
+        programStore->loadMacroProgram(index, program);
+    }
+    if (!program.isEmpty() && !MacroVm::validate(program)) {
+        LOG_ERROR(TAG, "Stored macro program %d is invalid, ignoring it", index);
+        program.length = 0;
+    }
+
     // Check if macro is empty
-    if (macro.isEmpty()) {
+    if (macro.isEmpty() && program.isEmpty()) {
         LOG_DEBUG(TAG, "Macro %d is empty, skipping", index);
         return false;
     }
 
     // Check if BLE is connected
-    if (!bleKeyboard->isConnected()) {
+    if (!hidOutput->isConnected()) {
         LOG_DEBUG(TAG, "BLE not connected, skipping macro %d", index);
         return false;
     }
 
-    // Execute macro: press modifiers + key, then release
+    // A stored program takes precedence over the packed chord
+    if (!program.isEmpty() && macroVm) {
+        LOG_DEBUG(TAG, "Running macro program %d (%u bytes)", index, program.length);
+        if (!macroVm->run(program)) {
+            LOG_DEBUG(TAG, "Macro VM busy, macro %d dropped", index);
+            return false;
+        }
+        return true;
+    }
+
+    // Execute macro: one report with modifiers + key, then an empty release report
     LOG_DEBUG(TAG, "Executing macro %d: modifiers=0x%02X, keycode=0x%02X",
               index, macro.modifiers, macro.keycode);
 
-    // Send key combination
-    // Press each modifier individually (library expects keycodes 0x80-0x87, not bitmask)
-    for (uint8_t bit = 0; bit < 8; bit++) {
-        if (macro.modifiers & (1 << bit)) {
-            bleKeyboard->press(0x80 + bit);
-        }
+    KeyReport report;
+    uint8_t keyCount = macro.keycode != 0 ? 1 : 0;
+    if (!BleKeyboardService::composeKeyReport(report, macro.modifiers, &macro.keycode, keyCount)) {
+        LOG_ERROR(TAG, "Macro %d has no HID report for keycode 0x%02X", index, macro.keycode);
+        return false;
     }
 
-    // Press and release the keycode
-    bleKeyboard->press(macro.keycode);
-    bleKeyboard->release(macro.keycode);
-
-    // Release each modifier individually
-    for (uint8_t bit = 0; bit < 8; bit++) {
-        if (macro.modifiers & (1 << bit)) {
-            bleKeyboard->release(0x80 + bit);
-        }
+    if (!hidOutput->enqueueKeyChord(report, 1, TRACE_ACTIVE_ORIGIN())) {
+        LOG_DEBUG(TAG, "HID output queue full, macro %d dropped", index);
+        return false;
     }
 
     return true;
 }
 
 void MacroManager::loadFromNVS(ConfigManager& config) {
+    programStore = &config;
     uint8_t loadedCount = 0;
 
     for (uint8_t i = 0; i < static_cast<uint8_t>(MacroInput::COUNT); i++) {
@@ -87,7 +113,20 @@ void MacroManager::loadFromNVS(ConfigManager& config) {
         }
     }
 
-    LOG_DEBUG(TAG, "Loaded %d non-empty macros from NVS", loadedCount);
+    uint8_t programCount = 0;
+    for (uint8_t i = 0; i < static_cast<uint8_t>(MacroInput::COUNT); i++) {
+        MacroProgram program;
+        if (config.loadMacroProgram(i, program) != Error::OK || program.isEmpty()) {
+            continue;
+        }
+        if (!MacroVm::validate(program)) {
+            LOG_ERROR(TAG, "Stored macro program %d is invalid, ignoring it", i);
+            continue;
+        }
+        programCount++;
+    }
+
+    LOG_DEBUG(TAG, "Loaded %d non-empty macros and %d programs from NVS", loadedCount, programCount);
 }
 
 Error MacroManager::saveMacro(ConfigManager& config, MacroInput input, MacroDefinition macro) {
@@ -101,7 +140,7 @@ Error MacroManager::saveMacro(ConfigManager& config, MacroInput input, MacroDefi
     // Update local array
     macros[index] = macro;
 
-    // Save to NVS
+    // Schedules the record write-back
     Error result = config.saveMacro(index, macro.toPacked());
 
     if (result == Error::OK) {
@@ -111,3 +150,62 @@ Error MacroManager::saveMacro(ConfigManager& config, MacroInput input, MacroDefi
 
     return result;
 }
+
+Error MacroManager::saveProgram(ConfigManager& config, MacroInput input, const MacroProgram& program) {
+    uint8_t index = static_cast<uint8_t>(input);
+
+    if (index >= static_cast<uint8_t>(MacroInput::COUNT)) {
+        LOG_ERROR(TAG, "Invalid macro index: %d", index);
+        return Error::INVALID_PARAM;
+    }
+
+    if (!program.isEmpty() && !MacroVm::validate(program)) {
+        LOG_ERROR(TAG, "Rejected invalid macro program for slot %d", index);
+        return Error::INVALID_PARAM;
+    }
+
+    // ConfigManager holds the only copy; the next executeMacro() runs it
+    return config.saveMacroProgram(index, program);
+}
+
+Error MacroManager::receiveProgram(Stream& in, ConfigManager& config) {
+    in.setTimeout(MACRO_UPLOAD_TIMEOUT_MS);
+
+    uint8_t header[3];
+    if (in.readBytes(header, sizeof(header)) != sizeof(header)) {
+        LOG_ERROR(TAG, "Macro upload: header timed out");
+        return Error::INVALID_PARAM;
+    }
+
+    uint8_t slot = header[0];
+    uint16_t length = header[1] | (header[2] << 8);
+    if (length > MACRO_PROGRAM_MAX_BYTES) {
+        LOG_ERROR(TAG, "Macro upload: %u bytes exceeds %u", length, MACRO_PROGRAM_MAX_BYTES);
+        return Error::INVALID_PARAM;
+    }
+
+    MacroProgram program;
+    program.length = length;
+    if (in.readBytes(program.code, length) != length) {
+        LOG_ERROR(TAG, "Macro upload: body timed out");
+        return Error::INVALID_PARAM;
+    }
+
+    Error result = saveProgram(config, static_cast<MacroInput>(slot), program);
+    if (result == Error::OK) {
+        result = config.flush();  // The host tool reports this result: it should mean "in flash"
+    }
+    LOG_INFO(TAG, "Macro upload slot %d (%u bytes): %s", slot, length, errorToString(result));
+    return result;
+}
+
+void MacroManager::onConfigChanged(ConfigChange change, const ConfigSnapshot& snapshot) {
+    if (change != ConfigChange::MACRO && change != ConfigChange::ALL) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < static_cast<uint8_t>(MacroInput::COUNT); i++) {
+        macros[i] = MacroDefinition::fromPacked(snapshot.macros[i]);
+    }
+    LOG_DEBUG(TAG, "Macro table refreshed from config snapshot");
+}
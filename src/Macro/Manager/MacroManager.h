@@ -7,37 +7,46 @@
  * MacroManager handles:
  * - Loading/saving macro definitions from/to NVS
  * - Tracking macro mode state (toggle ON/OFF)
- * - Executing macros via BleKeyboard when macro mode is active
+ * - Executing macros when macro mode is active: a stored bytecode
+ *   program runs on MacroVm, otherwise the packed chord goes to HidOutputTask
  */
 
-#include "BleKeyboard.h"
+#include "BLE/HidOutputTask.h"
 #include <stdint.h>
+#include "freertos/FreeRTOS.h"
 
 #include "Config/ConfigManager.h"
 #include "Enum/ErrorEnum.h"
 #include "Enum/MacroInputEnum.h"
 #include "Type/MacroDefinition.h"
+#include "Type/MacroProgram.h"
+#include "Config/Interface/ConfigListenerInterface.h"
+
+class MacroVm;
+class Stream;
 
 /**
  * @class MacroManager
  * @brief Manages macro button state and macro execution
  *
  * Usage:
- * 1. Construct with BleKeyboard pointer
+ * 1. Construct with HidOutputTask and MacroVm pointers
  * 2. Load macros from NVS: loadFromNVS(configManager)
  * 3. Toggle macro mode: toggleMacroMode()
  * 4. Execute on input: if (isMacroModeActive()) executeMacro(input)
+ * 5. Subscribe to ConfigManager to pick up macro edits: configManager.subscribe(&macroManager)
  */
-class MacroManager {
+class MacroManager : public ConfigListenerInterface {
 public:
     /**
-     * @brief Construct MacroManager with BLE keyboard dependency
-     * @param ble Pointer to BleKeyboard instance for HID output
+     * @brief Construct MacroManager with HID output dependencies
+     * @param hidOutput HID output stage that sends the key chords
+     * @param macroVm Runs bytecode programs (may be null: chords only)
      */
-    explicit MacroManager(BleKeyboard* ble);
+    MacroManager(HidOutputTask* hidOutput, MacroVm* macroVm);
 
     /**
-     * @brief Toggle macro mode ON/OFF
+     * @brief Toggle macro mode ON/OFF (turning it off stops a running program)
      */
     void toggleMacroMode();
 
@@ -50,18 +59,21 @@ public:
     /**
      * @brief Execute a macro for the given input
      * @param input Macro input source (WHEEL_BUTTON, BUTTON_1, etc.)
-     * @return true if macro was executed, false if skipped (empty macro or BLE disconnected)
+     * @return true if macro was queued, false if skipped (empty macro, BLE disconnected or output/VM queue full)
      */
     bool executeMacro(MacroInput input);
 
     /**
-     * @brief Load all macro definitions from NVS
-     * @param config ConfigManager instance for NVS access
+     * @brief Load all macro definitions from NVS and keep config as the program source
+     *
+     * Programs are not copied: ConfigManager holds the only copy and
+     * executeMacro() reads the one it runs.
+     * @param config ConfigManager instance for NVS access (must outlive this manager)
      */
     void loadFromNVS(ConfigManager& config);
 
     /**
-     * @brief Save a macro definition to NVS and update local storage
+     * @brief Update local storage and hand a macro definition to ConfigManager (written back later)
      * @param config ConfigManager instance for NVS access
      * @param input Macro input slot to save to
      * @param macro MacroDefinition to save
@@ -69,8 +81,32 @@ public:
      */
     Error saveMacro(ConfigManager& config, MacroInput input, MacroDefinition macro);
 
+    /**
+     * @brief Validate a macro program and hand it to ConfigManager (written back later)
+     * @param config ConfigManager instance for NVS access
+     * @param input Macro input slot; its program takes precedence over the packed chord
+     * @param program Bytecode blob (empty removes the program)
+     * @return Error::OK on success, Error::INVALID_PARAM if the program fails MacroVm::validate
+     */
+    Error saveProgram(ConfigManager& config, MacroInput input, const MacroProgram& program);
+
+    /**
+     * @brief Read an uploaded program from the serial console and save it
+     *
+     * Called after MACRO_UPLOAD_COMMAND; reads slot u8 | length u16 LE | blob.
+     * @return Error::OK on success, Error::INVALID_PARAM on a short or invalid upload
+     */
+    Error receiveProgram(Stream& in, ConfigManager& config);
+
+    /**
+     * @brief Refresh local macro table when macros change in ConfigManager
+     */
+    void onConfigChanged(ConfigChange change, const ConfigSnapshot& snapshot) override;
+
 private:
-    BleKeyboard* bleKeyboard;              // BLE HID interface (injected)
+    HidOutputTask* hidOutput;              // HID output stage (injected)
+    MacroVm* macroVm;                      // Bytecode program runner (injected, may be null)
     bool macroModeActive;                  // Macro mode state (toggle)
     MacroDefinition macros[static_cast<uint8_t>(MacroInput::COUNT)];  // Macro definitions array (static allocation)
+    ConfigManager* programStore;           // Owner of the bytecode programs (set by loadFromNVS)
 };
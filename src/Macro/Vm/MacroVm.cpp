@@ -0,0 +1,352 @@
+#include "MacroVm.h"
+#include <string.h>
+#include "BLE/BleKeyboardService.h"
+#include "BLE/HidOutputTask.h"
+#include "Config/hid_config.h"
+#include "Config/log_config.h"
+#include "Enum/MacroOpcodeEnum.h"
+
+static const char* TAG = "MacroVm";
+
+// Usage and modifier bits a single library keycode maps to (false if it has none)
+static bool keyToReport(uint8_t key, KeyReport& out) {
+    return BleKeyboardService::composeKeyReport(out, 0, &key, 1);
+}
+
+static void addKey(KeyReport& report, uint8_t usage) {
+    if (usage == 0) {
+        return;
+    }
+    for (uint8_t i = 0; i < BleKeyboardService::MAX_REPORT_KEYS; i++) {
+        if (report.keys[i] == usage) {
+            return;
+        }
+    }
+    for (uint8_t i = 0; i < BleKeyboardService::MAX_REPORT_KEYS; i++) {
+        if (report.keys[i] == 0) {
+            report.keys[i] = usage;
+            return;
+        }
+    }
+    LOG_ERROR(TAG, "Six keys already held, 0x%02X ignored", usage);
+}
+
+static void removeKey(KeyReport& report, uint8_t usage) {
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < BleKeyboardService::MAX_REPORT_KEYS; i++) {
+        if (report.keys[i] != 0 && report.keys[i] != usage) {
+            report.keys[kept++] = report.keys[i];
+        }
+    }
+    while (kept < BleKeyboardService::MAX_REPORT_KEYS) {
+        report.keys[kept++] = 0;
+    }
+}
+
+MacroVm::MacroVm(HidOutputTask* hidOutput)
+    : hidOutput(hidOutput), stats{}, current{}, held{} {}
+
+bool MacroVm::start(uint32_t stackSize, UBaseType_t priority) {
+    if (!hidOutput) {
+        LOG_ERROR(TAG, "Cannot start: HidOutputTask is null");
+        return false;
+    }
+
+    if (!requests) {
+        requests = xQueueCreate(MACRO_VM_REQUEST_QUEUE_DEPTH, sizeof(MacroProgram));
+    }
+    if (!requests) {
+        LOG_ERROR(TAG, "Failed to create request queue");
+        return false;
+    }
+
+    if (xTaskCreate(taskEntry, "MacroVm", stackSize, this, priority, &taskHandle) != pdPASS) {
+        LOG_ERROR(TAG, "Failed to create task");
+        return false;
+    }
+
+    LOG_INFO(TAG, "Started");
+    return true;
+}
+
+bool MacroVm::run(const MacroProgram& program) {
+    if (!requests || program.isEmpty() || xQueueSend(requests, &program, 0) != pdTRUE) {
+        taskENTER_CRITICAL(&statsMux);
+        stats.rejected++;
+        taskEXIT_CRITICAL(&statsMux);
+        return false;
+    }
+    return true;
+}
+
+void MacroVm::stop() {
+    if (requests) {
+        xQueueReset(requests);
+    }
+    abortRequested = true;
+    if (taskHandle) {
+        xTaskNotifyGive(taskHandle);  // Cut a DELAY short
+    }
+}
+
+MacroVmStats MacroVm::getStats() const {
+    taskENTER_CRITICAL(&statsMux);
+    MacroVmStats snapshot = stats;
+    taskEXIT_CRITICAL(&statsMux);
+    return snapshot;
+}
+
+bool MacroVm::validate(const MacroProgram& program) {
+    if (program.length < 1 || program.length > MACRO_PROGRAM_MAX_BYTES ||
+        program.code[0] != MACRO_PROGRAM_VERSION) {
+        return false;
+    }
+
+    uint16_t loopEnds[MACRO_VM_MAX_LOOP_DEPTH];
+    uint8_t depth = 0;
+    uint16_t pc = 1;
+
+    while (pc < program.length) {
+        while (depth > 0 && pc == loopEnds[depth - 1]) {
+            depth--;
+        }
+        uint16_t limit = depth > 0 ? loopEnds[depth - 1] : program.length;
+
+        uint8_t opcode = program.code[pc];
+        if (opcode > MacroOpcode_MAX) {
+            LOG_ERROR(TAG, "Unknown opcode 0x%02X at %u", opcode, pc);
+            return false;
+        }
+
+        MacroOpcode op = static_cast<MacroOpcode>(opcode);
+        uint16_t next = pc + 1 + macroOperandLength(op);
+        if (next > limit) {
+            LOG_ERROR(TAG, "%s at %u runs past its block", macroOpcodeToString(op), pc);
+            return false;
+        }
+
+        if (op == MacroOpcode::END) {
+            return true;
+        }
+        if (op == MacroOpcode::TYPE) {
+            next += program.code[pc + 1];
+            if (next > limit) {
+                LOG_ERROR(TAG, "TYPE text at %u runs past its block", pc);
+                return false;
+            }
+        }
+        if (op == MacroOpcode::REPEAT) {
+            uint16_t bodyEnd = next + program.code[pc + 2];
+            if (bodyEnd > limit || depth == MACRO_VM_MAX_LOOP_DEPTH) {
+                LOG_ERROR(TAG, "REPEAT at %u: body out of bounds or nested too deep", pc);
+                return false;
+            }
+            loopEnds[depth++] = bodyEnd;
+        }
+        pc = next;
+    }
+    return true;
+}
+
+void MacroVm::taskEntry(void* param) {
+    static_cast<MacroVm*>(param)->taskLoop();
+}
+
+void MacroVm::taskLoop() {
+    while (true) {
+        if (xQueueReceive(requests, &current, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        abortRequested = false;
+        running = true;
+        ulTaskNotifyTake(pdTRUE, 0);  // Drop a stale stop() notification
+        taskENTER_CRITICAL(&statsMux);
+        stats.started++;
+        taskEXIT_CRITICAL(&statsMux);
+
+        bool completed = execute();
+        releaseHeld();
+        running = false;
+
+        taskENTER_CRITICAL(&statsMux);
+        if (completed) {
+            stats.completed++;
+        } else {
+            stats.aborted++;
+        }
+        taskEXIT_CRITICAL(&statsMux);
+
+        LOG_DEBUG(TAG, "Program %s (%u bytes)", completed ? "completed" : "aborted", current.length);
+    }
+}
+
+bool MacroVm::execute() {
+    Loop loops[MACRO_VM_MAX_LOOP_DEPTH];
+    uint8_t depth = 0;
+    uint16_t pc = 1;  // Skip the version byte
+    held = KeyReport{};
+
+    while (true) {
+        // Close finished REPEAT bodies; jump back while iterations remain
+        while (depth > 0 && pc == loops[depth - 1].bodyEnd) {
+            Loop& loop = loops[depth - 1];
+            if (--loop.remaining > 0) {
+                pc = loop.bodyStart;
+                break;
+            }
+            depth--;
+        }
+
+        if (pc >= current.length) {
+            return true;
+        }
+        if (abortRequested || !hidOutput->isConnected()) {
+            return false;
+        }
+        bool halt = false;
+        if (!step(pc, loops, depth, halt)) {
+            return false;
+        }
+        if (halt) {
+            return true;  // END stops the program, even inside a REPEAT body
+        }
+    }
+}
+
+bool MacroVm::step(uint16_t& pc, Loop* loops, uint8_t& depth, bool& halt) {
+    MacroOpcode op = static_cast<MacroOpcode>(current.code[pc]);
+    const uint8_t* operand = &current.code[pc + 1];
+    pc += 1 + macroOperandLength(op);
+
+    switch (op) {
+        case MacroOpcode::END:
+            halt = true;
+            return true;
+
+        case MacroOpcode::KEY_DOWN: {
+            KeyReport key;
+            if (!keyToReport(operand[0], key)) {
+                return true;  // Unmappable key is skipped (composeKeyReport logged it)
+            }
+            held.modifiers |= key.modifiers;
+            addKey(held, key.keys[0]);
+            return sendHeld();
+        }
+
+        case MacroOpcode::KEY_UP: {
+            KeyReport key;
+            if (!keyToReport(operand[0], key)) {
+                return true;
+            }
+            held.modifiers &= ~key.modifiers;
+            removeKey(held, key.keys[0]);
+            return sendHeld();
+        }
+
+        case MacroOpcode::MODIFIERS:
+            held.modifiers = operand[0];
+            return sendHeld();
+
+        case MacroOpcode::CONSUMER:
+            return waitForHeadroom() && hidOutput->enqueueConsumerKey(operand);
+
+        case MacroOpcode::WHEEL:
+            return waitForHeadroom() &&
+                   hidOutput->enqueueWheel(static_cast<int8_t>(operand[0]), static_cast<int8_t>(operand[1]));
+
+        case MacroOpcode::DELAY:
+            return waitForDrain() && sleepMs(operand[0] | (operand[1] << 8));
+
+        case MacroOpcode::REPEAT: {
+            uint8_t count = operand[0];
+            uint8_t bodyLength = operand[1];
+            if (count == 0 || bodyLength == 0) {
+                pc += bodyLength;
+                return true;
+            }
+            loops[depth++] = Loop{ pc, static_cast<uint16_t>(pc + bodyLength), count };
+            return true;
+        }
+
+        case MacroOpcode::TYPE: {
+            uint8_t length = operand[0];
+            const uint8_t* text = &current.code[pc];
+            pc += length;
+            for (uint8_t i = 0; i < length; i++) {
+                if (!typeCharacter(text[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+    return false;  // validate() rejects unknown opcodes
+}
+
+bool MacroVm::sendHeld() {
+    return waitForHeadroom() && hidOutput->enqueueKeyState(held);
+}
+
+// Press the character on top of whatever the program holds, then go back to the held report
+bool MacroVm::typeCharacter(uint8_t character) {
+    KeyReport key;
+    if (!keyToReport(character, key)) {
+        return true;
+    }
+
+    KeyReport pressed = held;
+    pressed.modifiers |= key.modifiers;
+    addKey(pressed, key.keys[0]);
+
+    return waitForHeadroom() && hidOutput->enqueueKeyState(pressed) &&
+           waitForHeadroom() && hidOutput->enqueueKeyState(held);
+}
+
+bool MacroVm::waitForHeadroom() {
+    while (hidOutput->getDepth() > HID_OUTPUT_QUEUE_CAPACITY - MACRO_VM_HID_HEADROOM) {
+        if (abortRequested || !hidOutput->isConnected()) {
+            return false;
+        }
+        vTaskDelay(pdMS_TO_TICKS(MACRO_VM_BACKPRESSURE_WAIT_MS));
+    }
+    return !abortRequested;
+}
+
+// Delays are measured from when the reports before them leave, not from when they were queued
+bool MacroVm::waitForDrain() {
+    while (hidOutput->getDepth() > 0) {
+        if (abortRequested || !hidOutput->isConnected()) {
+            return false;
+        }
+        vTaskDelay(pdMS_TO_TICKS(MACRO_VM_BACKPRESSURE_WAIT_MS));
+    }
+    return !abortRequested;
+}
+
+bool MacroVm::sleepMs(uint32_t ms) {
+    TickType_t start = xTaskGetTickCount();
+    TickType_t duration = pdMS_TO_TICKS(ms);
+
+    while (!abortRequested) {
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        if (elapsed >= duration) {
+            return true;
+        }
+        ulTaskNotifyTake(pdTRUE, duration - elapsed);  // stop() wakes this early
+    }
+    return false;
+}
+
+void MacroVm::releaseHeld() {
+    bool holding = held.modifiers != 0;
+    for (uint8_t i = 0; i < BleKeyboardService::MAX_REPORT_KEYS; i++) {
+        holding = holding || held.keys[i] != 0;
+    }
+    if (!holding) {
+        return;
+    }
+
+    held = KeyReport{};
+    hidOutput->enqueueKeyState(held);  // Best effort: a dropped link releases everything anyway
+}
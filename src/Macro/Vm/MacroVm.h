@@ -0,0 +1,103 @@
+#pragma once
+
+/**
+ * @file MacroVm.h
+ * @brief Task that runs macro bytecode programs
+ */
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "BleKeyboard.h"
+#include "Config/macro_config.h"
+#include "Type/MacroProgram.h"
+
+class HidOutputTask;
+
+/**
+ * @brief Counters for macro execution
+ */
+struct MacroVmStats {
+    uint32_t started;    ///< Programs that began running
+    uint32_t completed;  ///< Programs that ran to the end
+    uint32_t aborted;    ///< Programs stopped early (stop(), link lost, HID queue refused a report)
+    uint32_t rejected;   ///< run() calls refused: request queue full or invalid program
+};
+
+/**
+ * @class MacroVm
+ * @brief Runs MacroProgram bytecode on its own task
+ *
+ * run() copies the program into a small request queue and returns, so
+ * EncoderEventTask and ButtonEventTask never wait for a macro. The VM
+ * keeps the held keyboard report (KEY_DOWN/KEY_UP/MODIFIERS) and turns
+ * each instruction into HidOutputTask intents, leaving
+ * MACRO_VM_HID_HEADROOM slots free so live input is not starved by a
+ * long TYPE. DELAY waits until queued reports have gone out, then sleeps
+ * on the task notification so stop() can cut it short. Any keys still
+ * held when a program ends or aborts are released.
+ *
+ * Programs must pass validate() before they are stored; the VM relies on
+ * operands and REPEAT bodies being in bounds.
+ */
+class MacroVm {
+public:
+    explicit MacroVm(HidOutputTask* hidOutput);
+
+    /**
+     * @brief Create the request queue and start the VM task
+     * @return true if task started successfully
+     */
+    bool start(uint32_t stackSize = MACRO_VM_TASK_STACK, UBaseType_t priority = MACRO_VM_TASK_PRIORITY);
+
+    /**
+     * @brief Queue a program to run after any program already running
+     * @return false if the program is empty or the request queue is full
+     */
+    bool run(const MacroProgram& program);
+
+    /**
+     * @brief Abort the running program and drop queued ones
+     */
+    void stop();
+
+    bool isRunning() const { return running; }
+    MacroVmStats getStats() const;
+
+    /**
+     * @brief Check a blob: version, known opcodes, operands and REPEAT bodies in bounds
+     * @return true if the VM can run it
+     */
+    static bool validate(const MacroProgram& program);
+
+private:
+    HidOutputTask* hidOutput;
+    QueueHandle_t requests = nullptr;
+    TaskHandle_t taskHandle = nullptr;
+    volatile bool running = false;
+    volatile bool abortRequested = false;
+    MacroVmStats stats;
+    mutable portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+    MacroProgram current;  ///< Program being executed (owned by the VM task)
+    KeyReport held;        ///< Keyboard report the program is holding
+
+    struct Loop {
+        uint16_t bodyStart;
+        uint16_t bodyEnd;
+        uint8_t remaining;
+    };
+
+    static void taskEntry(void* param);
+    void taskLoop();
+    bool execute();
+    bool step(uint16_t& pc, Loop* loops, uint8_t& depth, bool& halt);
+
+    bool sendHeld();
+    bool typeCharacter(uint8_t character);
+    bool waitForHeadroom();
+    bool waitForDrain();
+    bool sleepMs(uint32_t ms);
+    void releaseHeld();
+};
@@ -2,6 +2,8 @@
 #include "BleKeyboard.h"
 #include "Display/Model/DisplayRequest.h"
 #include "Config/log_config.h"
+#include "state/AppState.h"
+#include "BLE/BleAdvertisingScheduler.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
 
@@ -17,8 +19,12 @@ void DisconnectAction::execute(const MenuItem* context) {
         LOG_INFO("DisconnectAction", "Disconnecting BLE");
         bleKeyboard->disconnect();
 
-        // Stop advertising to prevent new connections
-        bleKeyboard->stopAdvertising();
+        // Stop advertising to prevent new connections (and keep the scheduler from restarting it)
+        if (appState.advertisingScheduler != nullptr) {
+            appState.advertisingScheduler->stop();
+        } else {
+            bleKeyboard->stopAdvertising();
+        }
         LOG_INFO("DisconnectAction", "Advertising stopped");
 
         req.data.status.value = "Disconnected";
@@ -14,7 +14,7 @@ void DisplayPowerAction::execute(const MenuItem* context) {
     // Context unused - power toggle is stateless
 
     // Get current power state from HardwareState (single source of truth)
-    bool currentPower = hardwareState.displayPower;
+    bool currentPower = hardwareState.read().displayPower;
     bool newPower = !currentPower;
 
     LOG_INFO(TAG, "Toggling display: %s -> %s",
@@ -34,6 +34,6 @@ void DisplayPowerAction::execute(const MenuItem* context) {
 const char* DisplayPowerAction::getConfirmationMessage() {
     // Return message indicating the NEW state (after toggle)
     // Read from HardwareState (single source of truth)
-    bool currentPower = hardwareState.displayPower;
+    bool currentPower = hardwareState.read().displayPower;
     return currentPower ? "Display On" : "Display Off";
 }
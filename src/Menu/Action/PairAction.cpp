@@ -4,10 +4,11 @@
 #include "Config/log_config.h"
 #include "state/HardwareState.h"
 #include "state/AppState.h"
+#include "Event/Bus/EventBus.h"
+#include "BLE/BleAdvertisingScheduler.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
 
-extern HardwareState hardwareState;
 extern AppState appState;
 
 PairAction::PairAction(BleKeyboard* ble, QueueHandle_t displayQueue)
@@ -30,8 +31,10 @@ void PairAction::execute(const MenuItem* context) {
 
     // Update global hardware state for pairing
     // This allows onDisconnect callback to detect auto-reconnect conflicts (reason 531)
-    hardwareState.bleState.isPairingMode = true;
-    hardwareState.bleState.isConnected = false;
+    hardwareState.update([](HardwareState& state) {
+        state.bleState.isPairingMode = true;
+        state.bleState.isConnected = false;
+    });
     LOG_INFO("PairAction", "Pairing mode flag set");
 
     // Start BT flash timer for pairing animation
@@ -41,7 +44,12 @@ void PairAction::execute(const MenuItem* context) {
     }
 
     // Start advertising for pairing (NOT begin() - that's for initialization)
-    bleKeyboard->startAdvertising();
+    // Scheduler drops to a slow interval if nobody pairs within BLE_ADV_PAIRING_FAST_MS
+    if (appState.advertisingScheduler != nullptr) {
+        appState.advertisingScheduler->startPairing();
+    } else {
+        bleKeyboard->startAdvertising();
+    }
     LOG_INFO("PairAction", "BLE advertising started");
 
     // Send display feedback - use SHOW_STATUS for clarity
@@ -55,10 +63,9 @@ void PairAction::execute(const MenuItem* context) {
     }
 
     // Update status screen to show pairing state (BT icon will flash)
-    DisplayRequest normalModeReq;
-    normalModeReq.type = DisplayRequestType::DRAW_NORMAL_MODE;
-    normalModeReq.data.normalMode.hwState = hardwareState;
-    xQueueSend(displayRequestQueue, &normalModeReq, pdMS_TO_TICKS(10));
+    if (appState.eventBus != nullptr) {
+        appState.eventBus->publishStateChanged(StateChange::BLE, EventSource::MENU);
+    }
 }
 
 const char* PairAction::getConfirmationMessage() {
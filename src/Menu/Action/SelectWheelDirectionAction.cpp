@@ -1,13 +1,10 @@
 #include "SelectWheelDirectionAction.h"
 #include "Config/ConfigManager.h"
 #include "Config/log_config.h"
-#include "Display/Model/DisplayRequest.h"
-#include "state/HardwareState.h"
+#include "Event/Bus/EventBus.h"
 
-extern HardwareState hardwareState;
-
-SelectWheelDirectionAction::SelectWheelDirectionAction(WheelDirection direction, ConfigManager* config, QueueHandle_t displayQueue)
-    : targetDirection(direction), configManager(config), displayRequestQueue(displayQueue) {
+SelectWheelDirectionAction::SelectWheelDirectionAction(WheelDirection direction, ConfigManager* config, EventBus* bus, HardwareStateStore* hwState)
+    : targetDirection(direction), configManager(config), eventBus(bus), hardwareState(hwState) {
 }
 
 void SelectWheelDirectionAction::execute(const MenuItem* context) {
@@ -21,15 +18,13 @@ void SelectWheelDirectionAction::execute(const MenuItem* context) {
 
     LOG_INFO("SelectWheelDir", "Wheel direction saved: %s", wheelDirectionToString(targetDirection));
 
-    // Update global hardware state immediately (AC 4)
-    hardwareState.encoderWheelState.direction = targetDirection;
+    // Update hardware state immediately (AC 4)
+    WheelDirection direction = targetDirection;
+    hardwareState->update([direction](HardwareState& state) { state.encoderWheelState.direction = direction; });
 
     // Trigger display refresh to show new direction indicator
-    if (displayRequestQueue != nullptr) {
-        DisplayRequest normalModeReq;
-        normalModeReq.type = DisplayRequestType::DRAW_NORMAL_MODE;
-        normalModeReq.data.normalMode.hwState = hardwareState;
-        xQueueSend(displayRequestQueue, &normalModeReq, pdMS_TO_TICKS(10));
+    if (eventBus != nullptr) {
+        eventBus->publishStateChanged(StateChange::WHEEL_DIRECTION, EventSource::MENU);
     }
 }
 
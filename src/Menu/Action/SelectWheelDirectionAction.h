@@ -2,11 +2,11 @@
 
 #include "MenuAction.h"
 #include "Enum/WheelDirection.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/queue.h"
+#include "state/HardwareState.h"
 
-// Forward declaration
+// Forward declarations
 class ConfigManager;
+class EventBus;
 
 /**
  * @brief Menu action to select wheel direction (Normal/Reversed)
@@ -23,14 +23,15 @@ public:
      *
      * @param direction The target WheelDirection (NORMAL or REVERSED)
      * @param config ConfigManager instance for NVS persistence
-     * @param displayQueue Queue for display refresh
+     * @param bus EventBus to announce the state change on (display refresh subscribes)
+     * @param hwState HardwareState instance for updating display state
      */
-    explicit SelectWheelDirectionAction(WheelDirection direction, ConfigManager* config, QueueHandle_t displayQueue);
+    explicit SelectWheelDirectionAction(WheelDirection direction, ConfigManager* config, EventBus* bus, HardwareStateStore* hwState);
 
     /**
      * @brief Execute the wheel direction change
      *
-     * Saves the direction to NVS, updates appState.hardwareState.encoderWheelState.direction,
+     * Saves the direction to NVS, updates hardwareState.encoderWheelState.direction,
      * and triggers display refresh immediately (AC 4).
      *
      * @param context The MenuItem that was selected (unused)
@@ -47,5 +48,6 @@ public:
 private:
     WheelDirection targetDirection;
     ConfigManager* configManager;
-    QueueHandle_t displayRequestQueue;
+    EventBus* eventBus;
+    HardwareStateStore* hardwareState;  // Injected dependency for display state updates
 };
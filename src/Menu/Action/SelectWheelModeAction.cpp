@@ -5,7 +5,7 @@
 #include "Config/log_config.h"
 #include "state/HardwareState.h"
 
-SelectWheelModeAction::SelectWheelModeAction(WheelMode mode, ConfigManager* config, EncoderModeManager* modeMgr, HardwareState* hwState)
+SelectWheelModeAction::SelectWheelModeAction(WheelMode mode, ConfigManager* config, EncoderModeManager* modeMgr, HardwareStateStore* hwState)
     : targetMode(mode), configManager(config), modeManager(modeMgr), hardwareState(hwState) {
 }
 
@@ -24,7 +24,8 @@ void SelectWheelModeAction::execute(const MenuItem* context) {
 
     // Update hardware state through injected dependency
     // This ensures the status bar shows the updated mode without waiting for encoder rotation
-    hardwareState->encoderWheelState.mode = targetMode;
+    WheelMode mode = targetMode;
+    hardwareState->update([mode](HardwareState& state) { state.encoderWheelState.mode = mode; });
 
     // Log the mode change
     LOG_INFO("SelectWheelMode", "Wheel mode selected: %s", wheelModeToString(targetMode));
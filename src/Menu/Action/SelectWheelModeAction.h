@@ -2,11 +2,11 @@
 
 #include "MenuAction.h"
 #include "Enum/WheelModeEnum.h"
+#include "state/HardwareState.h"
 
 // Forward declarations
 class ConfigManager;
 class EncoderModeManager;
-struct HardwareState;
 
 /**
  * @brief Menu action to select and activate a wheel mode
@@ -29,7 +29,7 @@ public:
      * @param modeMgr EncoderModeManager instance for runtime mode switching
      * @param hwState HardwareState instance for updating display state
      */
-    explicit SelectWheelModeAction(WheelMode mode, ConfigManager* config, EncoderModeManager* modeMgr, HardwareState* hwState);
+    explicit SelectWheelModeAction(WheelMode mode, ConfigManager* config, EncoderModeManager* modeMgr, HardwareStateStore* hwState);
 
     /**
      * @brief Execute the wheel mode change
@@ -55,5 +55,5 @@ private:
     WheelMode targetMode;
     ConfigManager* configManager;
     EncoderModeManager* modeManager;
-    HardwareState* hardwareState;  // Injected dependency for display state updates
+    HardwareStateStore* hardwareState;  // Injected dependency for display state updates
 };
@@ -0,0 +1,22 @@
+#include "SelectZoomStrategyAction.h"
+#include "Config/ConfigManager.h"
+#include "Config/log_config.h"
+
+SelectZoomStrategyAction::SelectZoomStrategyAction(ZoomStrategy strategy, ConfigManager* config)
+    : targetStrategy(strategy), configManager(config) {
+}
+
+void SelectZoomStrategyAction::execute(const MenuItem* context) {
+    // Context unused - strategy is fixed at construction time
+    Error saveResult = configManager->saveZoomStrategy(targetStrategy);
+    if (saveResult != Error::OK) {
+        LOG_ERROR("SelectZoomStrategy", "Failed to persist zoom strategy");
+        return;
+    }
+
+    LOG_INFO("SelectZoomStrategy", "Zoom strategy saved: %s", zoomStrategyToString(targetStrategy));
+}
+
+const char* SelectZoomStrategyAction::getConfirmationMessage() {
+    return "Zoom style saved";
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "MenuAction.h"
+#include "Enum/ZoomStrategyEnum.h"
+
+// Forward declarations
+class ConfigManager;
+
+/**
+ * @brief Menu action to select how zoom mode talks to the host
+ *
+ * Persists the ZoomStrategy via ConfigManager; EncoderModeHandlerZoom
+ * picks it up through its config listener.
+ *
+ * Follows the Command Pattern for menu actions.
+ */
+class SelectZoomStrategyAction : public MenuAction {
+public:
+    /**
+     * @brief Construct a SelectZoomStrategyAction
+     *
+     * @param strategy The target ZoomStrategy
+     * @param config ConfigManager instance for NVS persistence
+     */
+    SelectZoomStrategyAction(ZoomStrategy strategy, ConfigManager* config);
+
+    /**
+     * @brief Save the zoom strategy to NVS
+     *
+     * @param context The MenuItem that was selected (unused)
+     */
+    void execute(const MenuItem* context) override;
+
+    /**
+     * @brief Get confirmation message for the strategy change
+     *
+     * @return Confirmation message: "Zoom style saved"
+     */
+    const char* getConfirmationMessage() override;
+
+private:
+    ZoomStrategy targetStrategy;
+    ConfigManager* configManager;
+};
@@ -3,11 +3,10 @@
 #include "Config/button_config.h"
 #include "Config/log_config.h"
 #include "Menu/Model/MenuItem.h"
-#include "Event/Handler/ButtonEventHandler.h"
 #include "BLE/BleKeyboardService.h"
 
-SetButtonBehaviorAction::SetButtonBehaviorAction(ButtonActionId actionId, ConfigManager* config, ButtonEventHandler* buttonHandler, BleKeyboardService* bleService)
-    : action(actionId), configManager(config), buttonEventHandler(buttonHandler), bleKeyboardService(bleService) {
+SetButtonBehaviorAction::SetButtonBehaviorAction(ButtonActionId actionId, ConfigManager* config, BleKeyboardService* bleService)
+    : action(actionId), configManager(config), bleKeyboardService(bleService) {
 }
 
 void SetButtonBehaviorAction::execute(const MenuItem* context) {
@@ -27,12 +26,6 @@ void SetButtonBehaviorAction::execute(const MenuItem* context) {
         return;
     }
 
-    // Invalidate ButtonEventHandler cache to force reload on next button press
-    if (buttonEventHandler) {
-        buttonEventHandler->invalidateCache();
-        LOG_DEBUG("SetButtonBehavior", "Invalidated button action cache");
-    }
-    
     const char* actionName = bleKeyboardService ? bleKeyboardService->getActionDisplayName(action) : "Unknown";
     LOG_INFO("SetButtonBehavior", "%s set to: %s", BUTTONS[buttonIndex].label, actionName);
 }
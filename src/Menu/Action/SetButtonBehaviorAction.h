@@ -5,7 +5,6 @@
 
 // Forward declarations
 class ConfigManager;
-class ButtonEventHandler;
 class BleKeyboardService;
 
 using ButtonActionId = uint8_t;
@@ -21,7 +20,7 @@ using ButtonActionId = uint8_t;
  * Encapsulates button action assignment:
  * 1. Extract button index by matching menu context label to BUTTONS[].label
  * 2. Persist the button action to NVS via ConfigManager
- * 3. Invalidate ButtonEventHandler cache to force reload on next button press
+ * 3. ConfigManager updates its RAM snapshot, so the next button press uses it
  *
  * Follows the Command Pattern with context-awareness for menu actions.
  */
@@ -32,10 +31,9 @@ public:
      *
      * @param actionId The ButtonActionId to assign
      * @param config ConfigManager instance for NVS persistence
-     * @param buttonHandler ButtonEventHandler instance to invalidate cache (optional)
      * @param bleService BLE keyboard service for action display/confirmation strings
      */
-    explicit SetButtonBehaviorAction(ButtonActionId actionId, ConfigManager* config, ButtonEventHandler* buttonHandler, BleKeyboardService* bleService);
+    explicit SetButtonBehaviorAction(ButtonActionId actionId, ConfigManager* config, BleKeyboardService* bleService);
 
     /**
      * @brief Execute the button action assignment
@@ -63,7 +61,6 @@ public:
 private:
     ButtonActionId action;
     ConfigManager* configManager;
-    ButtonEventHandler* buttonEventHandler;  // Optional: for cache invalidation
     BleKeyboardService* bleKeyboardService;
 
     /**
@@ -27,9 +27,11 @@ void ShowStatusAction::execute(const MenuItem* context) {
     // Clear display before showing status
     displayInterface->clear();
     
+    // One consistent snapshot for the whole screen
+    ConfigSnapshot config = configManager->getSnapshot();
+
     // Show wheel mode
-    WheelMode currentMode = configManager->loadWheelMode();
-    displayInterface->showStatus("Wheel Mode", wheelModeToString(currentMode));
+    displayInterface->showStatus("Wheel Mode", wheelModeToString(config.wheelMode));
     
     // Show BLE connection status
     const char* bleStatus = (bleKeyboardService && bleKeyboardService->isConnected()) ? "Connected" : "Disconnected";
@@ -37,7 +39,7 @@ void ShowStatusAction::execute(const MenuItem* context) {
 
     // Show button assignments
     for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
-        ButtonActionId actionId = configManager->loadButtonAction(i);
+        ButtonActionId actionId = config.buttonActions[i];
         const char* actionName = bleKeyboardService ? bleKeyboardService->getActionDisplayName(actionId) : "Unknown";
         displayInterface->showStatus(BUTTONS[i].label, actionName);
     }
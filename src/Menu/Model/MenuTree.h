@@ -3,21 +3,24 @@
 #include "MenuItem.h"
 #include "Enum/WheelModeEnum.h"
 #include "Enum/WheelDirection.h"
+#include "Enum/ZoomStrategyEnum.h"
 #include "Menu/Action/SelectWheelModeAction.h"
 #include "Menu/Action/SelectWheelDirectionAction.h"
+#include "Menu/Action/SelectZoomStrategyAction.h"
 #include "Menu/Action/SetButtonBehaviorAction.h"
 #include "Menu/Action/PairAction.h"
 #include "Menu/Action/DisconnectAction.h"
 #include "Menu/Action/DisplayPowerAction.h"
 #include "Config/button_config.h"
+#include "Config/hid_config.h"
 #include "BLE/BleKeyboardService.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
+#include "state/HardwareState.h"
 
 // Forward declarations
-class ButtonEventHandler;
 class MenuController;
-struct HardwareState;
+class EventBus;
 
 /**
  * @brief Static menu tree structure
@@ -41,6 +44,8 @@ struct HardwareState;
  *   - Wheel Direction (branch)
  *     - Normal (leaf - placeholder, no action)
  *     - Reversed (leaf - placeholder, no action)
+ *   - Zoom Style (branch)
+ *     - Ctrl +/-, Ctrl+Wheel, AC Zoom (leaf - SelectZoomStrategyAction)
  * - Button Config (branch)
  *   - Top Left (branch)
  *     - None, Mute, Play, Pause, Next, Previous (leaf - SetButtonBehaviorAction)
@@ -64,6 +69,7 @@ extern MenuItem mainMenu[];
 extern MenuItem wheelBehaviorSubmenu[];
 extern MenuItem wheelModeSubmenu[];
 extern MenuItem wheelDirectionSubmenu[];
+extern MenuItem zoomStrategySubmenu[];
 extern MenuItem buttonConfigSubmenu[];
 extern MenuItem bluetoothSubmenu[];
 extern MenuItem buttonBehaviorItems[];
@@ -87,13 +93,27 @@ inline MenuItem wheelDirectionSubmenu[] = {
 
 inline constexpr uint8_t WHEEL_DIRECTION_COUNT = 2;
 
+// Zoom Style submenu items (leaf nodes with actions set at runtime)
+// Labels derived from ZoomStrategy enum to ensure alignment
+// AC Zoom is only offered when the HID descriptor carries its usages
+inline MenuItem zoomStrategySubmenu[] = {
+    { zoomStrategyToDisplayString(ZoomStrategy::CTRL_KEYS),   nullptr, nullptr, 0, nullptr, nullptr },
+    { zoomStrategyToDisplayString(ZoomStrategy::CTRL_WHEEL),  nullptr, nullptr, 0, nullptr, nullptr },
+#if HID_AC_ZOOM_AVAILABLE
+    { zoomStrategyToDisplayString(ZoomStrategy::AC_ZOOM),     nullptr, nullptr, 0, nullptr, nullptr }
+#endif
+};
+
+inline constexpr uint8_t ZOOM_STRATEGY_COUNT = HID_AC_ZOOM_AVAILABLE ? 3 : 2;
+
 // Wheel Behavior submenu (branch nodes - parent menu)
 inline MenuItem wheelBehaviorSubmenu[] = {
     { "Wheel Mode",      nullptr, wheelModeSubmenu,      WHEEL_MODE_COUNT,      nullptr, nullptr },
-    { "Wheel Direction", nullptr, wheelDirectionSubmenu, WHEEL_DIRECTION_COUNT, nullptr, nullptr }
+    { "Wheel Direction", nullptr, wheelDirectionSubmenu, WHEEL_DIRECTION_COUNT, nullptr, nullptr },
+    { "Zoom Style",      nullptr, zoomStrategySubmenu,   ZOOM_STRATEGY_COUNT,   nullptr, nullptr }
 };
 
-inline constexpr uint8_t WHEEL_BEHAVIOR_COUNT = 2;
+inline constexpr uint8_t WHEEL_BEHAVIOR_COUNT = 3;
 
 // Shared button behavior items - dynamically generated from button action mapping
 // Labels populated at runtime from BUTTON_ACTION_DEFINITIONS in initButtonBehaviorMenuItems()
@@ -182,7 +202,7 @@ inline void initMenuTree() {
         mainMenu[i].parent = &root;
     }
 
-    // Set parent for wheel behavior submenu items (Wheel Mode, Wheel Direction)
+    // Set parent for wheel behavior submenu items (Wheel Mode, Wheel Direction, Zoom Style)
     for (uint8_t i = 0; i < WHEEL_BEHAVIOR_COUNT; i++) {
         wheelBehaviorSubmenu[i].parent = &mainMenu[Index::WHEEL_BEHAVIOR];
     }
@@ -197,6 +217,11 @@ inline void initMenuTree() {
         wheelDirectionSubmenu[i].parent = &wheelBehaviorSubmenu[1];  // Parent is "Wheel Direction" item
     }
 
+    // Set parent for zoom style submenu items (Ctrl +/-, Ctrl+Wheel, AC Zoom)
+    for (uint8_t i = 0; i < ZOOM_STRATEGY_COUNT; i++) {
+        zoomStrategySubmenu[i].parent = &wheelBehaviorSubmenu[2];  // Parent is "Zoom Style" item
+    }
+
     // Set parent and labels for button config submenu items
     // Labels come from BUTTONS[].label (single source of truth)
     // userData stores button index to decouple SetButtonBehaviorAction logic from label strings
@@ -242,6 +267,17 @@ inline void setWheelDirectionAction(uint8_t index, MenuAction* action) {
     }
 }
 
+/**
+ * @brief Set action for a zoom style menu item
+ * @param index Zoom strategy index (0=Ctrl +/-, 1=Ctrl+Wheel, 2=AC Zoom)
+ * @param action Pointer to MenuAction instance (must outlive menu)
+ */
+inline void setZoomStrategyAction(uint8_t index, MenuAction* action) {
+    if (index < ZOOM_STRATEGY_COUNT) {
+        zoomStrategySubmenu[index].action = action;
+    }
+}
+
 
 
 /**
@@ -297,14 +333,15 @@ inline constexpr uint8_t getMainMenuCount() {
  *
  * Creates SelectWheelModeAction instances for Scroll, Volume, and Zoom modes.
  * Creates SelectWheelDirectionAction instances for Normal and Reversed directions.
- * Must be called after DI objects (ConfigManager, EncoderModeManager, displayRequestQueue, HardwareState) are created.
+ * Creates SelectZoomStrategyAction instances for each zoom style.
+ * Must be called after DI objects (ConfigManager, EncoderModeManager, EventBus, HardwareState) are created.
  *
  * @param config ConfigManager instance for NVS persistence
  * @param modeMgr EncoderModeManager instance for runtime mode switching
- * @param displayQueue Queue for display refresh on direction change
+ * @param bus EventBus for the state change (display refresh) on direction change
  * @param hwState HardwareState instance for display state updates (DIP)
  */
-inline void initWheelBehaviorActions(ConfigManager* config, EncoderModeManager* modeMgr, QueueHandle_t displayQueue, HardwareState* hwState) {
+inline void initWheelBehaviorActions(ConfigManager* config, EncoderModeManager* modeMgr, EventBus* bus, HardwareStateStore* hwState) {
     // Create static action instances (must outlive menu)
     // HardwareState injected via constructor (Dependency Inversion Principle)
     static SelectWheelModeAction scrollAction(WheelMode::SCROLL, config, modeMgr, hwState);
@@ -318,13 +355,24 @@ inline void initWheelBehaviorActions(ConfigManager* config, EncoderModeManager*
     setWheelModeAction(static_cast<uint8_t>(WheelMode::ZOOM), &zoomAction);
 
     // Create static wheel direction action instances
-    static SelectWheelDirectionAction normalAction(WheelDirection::NORMAL, config, displayQueue);
-    static SelectWheelDirectionAction reversedAction(WheelDirection::REVERSED, config, displayQueue);
+    static SelectWheelDirectionAction normalAction(WheelDirection::NORMAL, config, bus, hwState);
+    static SelectWheelDirectionAction reversedAction(WheelDirection::REVERSED, config, bus, hwState);
 
     // Assign actions to wheel direction submenu items
     // Use WheelDirection enum values to ensure alignment with menu labels
     setWheelDirectionAction(static_cast<uint8_t>(WheelDirection::NORMAL), &normalAction);
     setWheelDirectionAction(static_cast<uint8_t>(WheelDirection::REVERSED), &reversedAction);
+
+    // Create static zoom strategy action instances
+    static SelectZoomStrategyAction ctrlKeysAction(ZoomStrategy::CTRL_KEYS, config);
+    static SelectZoomStrategyAction ctrlWheelAction(ZoomStrategy::CTRL_WHEEL, config);
+
+    setZoomStrategyAction(static_cast<uint8_t>(ZoomStrategy::CTRL_KEYS), &ctrlKeysAction);
+    setZoomStrategyAction(static_cast<uint8_t>(ZoomStrategy::CTRL_WHEEL), &ctrlWheelAction);
+#if HID_AC_ZOOM_AVAILABLE
+    static SelectZoomStrategyAction acZoomAction(ZoomStrategy::AC_ZOOM, config);
+    setZoomStrategyAction(static_cast<uint8_t>(ZoomStrategy::AC_ZOOM), &acZoomAction);
+#endif
 }
 
 /**
@@ -374,13 +422,12 @@ inline void initDisplayActions(DisplayInterface* display, MenuController* menuCt
  * The button index is determined dynamically at runtime by analyzing the menu navigation context
  * (which button submenu the user navigated through).
  *
- * Must be called after DI objects (ConfigManager, ButtonEventHandler, BleKeyboardService) are created.
+ * Must be called after DI objects (ConfigManager, BleKeyboardService) are created.
  *
  * @param config ConfigManager instance for NVS persistence
- * @param buttonHandler ButtonEventHandler instance for cache invalidation
  * @param bleService BLE keyboard service to get action IDs
  */
-inline void initButtonBehaviorActions(ConfigManager* config, ButtonEventHandler* buttonHandler, BleKeyboardService* bleService) {
+inline void initButtonBehaviorActions(ConfigManager* config, BleKeyboardService* bleService) {
     // Static storage buffer for action instances (must outlive menu)
     // Using aligned byte array + placement new to avoid hardcoded count
     // This enables true "single source of truth" - adding actions to service auto-scales
@@ -396,7 +443,6 @@ inline void initButtonBehaviorActions(ConfigManager* config, ButtonEventHandler*
             new (&actionStorage[i * sizeof(SetButtonBehaviorAction)]) SetButtonBehaviorAction(
                 actionId,
                 config,
-                buttonHandler,
                 bleService
             );
         }
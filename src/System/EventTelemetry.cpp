@@ -0,0 +1,42 @@
+#include "EventTelemetry.h"
+#include "Event/Bus/EventBus.h"
+#include "Config/log_config.h"
+
+EventTelemetry::EventTelemetry(EventBus* bus)
+    : eventBus(bus), sourceCounts{}, lastEventMs{} {
+}
+
+void EventTelemetry::attach() {
+    if (!eventBus) {
+        LOG_ERROR(TAG, "Cannot attach: eventBus is null");
+        return;
+    }
+
+    for (uint8_t i = 0; i < EVENT_TOPIC_COUNT; i++) {
+        eventBus->subscribe(static_cast<EventTopic>(i), EventListener::bind<EventTelemetry, &EventTelemetry::onEvent>(this));
+    }
+}
+
+bool EventTelemetry::onEvent(const EventEnvelope& event) {
+    // Word-sized stores only; counters are diagnostic and tolerate a lost increment
+    uint8_t source = static_cast<uint8_t>(event.source);
+    if (source < EVENT_SOURCE_COUNT) {
+        sourceCounts[source] = sourceCounts[source] + 1;
+    }
+    lastEventMs[static_cast<uint8_t>(event.topic)] = event.timestampMs;
+    return true;
+}
+
+void EventTelemetry::log() const {
+    for (uint8_t i = 0; i < EVENT_SOURCE_COUNT; i++) {
+        LOG_INFO(TAG, "source %-12s events=%u", eventSourceToString(static_cast<EventSource>(i)), static_cast<unsigned>(sourceCounts[i]));
+    }
+    for (uint8_t i = 0; i < EVENT_TOPIC_COUNT; i++) {
+        LOG_INFO(TAG, "topic %-13s last=%ums", eventTopicToString(static_cast<EventTopic>(i)),
+                 static_cast<unsigned>(lastEventMs[i]));
+    }
+
+    if (eventBus) {
+        eventBus->logStats();
+    }
+}
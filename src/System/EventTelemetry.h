@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include "Enum/EventTopicEnum.h"
+#include "Type/EventEnvelope.h"
+
+class EventBus;
+
+/**
+ * @brief Passive EventBus subscriber that collects event counters
+ *
+ * Listens on every topic, counts events per source and remembers when each
+ * topic last fired. log() prints these together with the bus's own
+ * per-topic depth/drop statistics.
+ */
+class EventTelemetry {
+public:
+    explicit EventTelemetry(EventBus* bus);
+
+    /**
+     * @brief Subscribe to every topic (call once during setup)
+     */
+    void attach();
+
+    /**
+     * @brief Log per-source counters and EventBus statistics
+     */
+    void log() const;
+
+private:
+
+    EventBus* eventBus;
+    volatile uint32_t sourceCounts[EVENT_SOURCE_COUNT];
+    volatile uint32_t lastEventMs[EVENT_TOPIC_COUNT];
+
+    bool onEvent(const EventEnvelope& event);
+
+    static constexpr const char* TAG = "EventTelemetry";
+};
@@ -0,0 +1,127 @@
+#include "InputRecorder.h"
+#include "Arduino.h"
+#include "esp_timer.h"
+#include "Event/Bus/EventBus.h"
+#include "Config/log_config.h"
+
+InputRecorder::InputRecorder(EventBus* bus)
+    : eventBus(bus), records{}, count(0), dropped(0), startUs(0), recording(false), replaying(false) {
+}
+
+void InputRecorder::attach() {
+    if (!eventBus) {
+        LOG_ERROR(TAG, "Cannot attach: eventBus is null");
+        return;
+    }
+
+    EventListener listener = EventListener::bind<InputRecorder, &InputRecorder::onInputEvent>(this);
+    eventBus->subscribe(EventTopic::ENCODER_INPUT, listener);
+    eventBus->subscribe(EventTopic::BUTTON_INPUT, listener);
+}
+
+void InputRecorder::startRecording() {
+    if (replaying) {
+        LOG_ERROR(TAG, "Cannot record during replay");
+        return;
+    }
+
+    count = 0;
+    dropped = 0;
+    startUs = static_cast<uint64_t>(esp_timer_get_time());
+    recording = true;
+    LOG_INFO(TAG, "Recording started");
+}
+
+void InputRecorder::stopRecording() {
+    recording = false;
+    LOG_INFO(TAG, "Recording stopped: %u events (%u dropped, ring full)",
+             count, static_cast<unsigned>(dropped));
+}
+
+bool InputRecorder::onInputEvent(const EventEnvelope& event) {
+    if (!recording || event.source == EventSource::REPLAY) {
+        return true;
+    }
+
+    if (count >= INPUT_RECORD_CAPACITY) {
+        dropped++;
+        return true;  // Bus delivery itself succeeded; the loss is reported on stop
+    }
+
+    uint64_t at = event.originUs != 0 ? event.originUs : static_cast<uint64_t>(esp_timer_get_time());
+
+    InputRecord& rec = records[count];
+    rec.offsetUs = at > startUs ? static_cast<uint32_t>(at - startUs) : 0;
+    rec.topic = static_cast<uint8_t>(event.topic);
+    if (event.topic == EventTopic::ENCODER_INPUT) {
+        int32_t delta = event.payload.encoder.delta;
+        rec.type = static_cast<uint8_t>(event.payload.encoder.type);
+        rec.value = static_cast<int16_t>(delta > INT16_MAX ? INT16_MAX : delta < INT16_MIN ? INT16_MIN : delta);
+    } else {
+        rec.type = static_cast<uint8_t>(event.payload.button.type);
+        rec.value = event.payload.button.buttonIndex;
+    }
+    count++;
+    return true;
+}
+
+void InputRecorder::dump(Print& out) const {
+    if (recording) {
+        LOG_ERROR(TAG, "Stop recording before dumping");
+        return;
+    }
+
+    DumpHeader header = { { 'I', 'N', 'R', 'C' }, DUMP_VERSION, sizeof(InputRecord), count };
+    out.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const uint8_t*>(records), count * sizeof(InputRecord));
+    out.flush();
+}
+
+bool InputRecorder::startReplay() {
+    if (recording || replaying || count == 0 || !eventBus) {
+        LOG_ERROR(TAG, "Nothing to replay (or busy)");
+        return false;
+    }
+
+    replaying = true;
+    if (xTaskCreate(replayTaskEntry, "InputReplay", INPUT_REPLAY_TASK_STACK, this, 1, nullptr) != pdPASS) {
+        replaying = false;
+        LOG_ERROR(TAG, "Failed to create replay task");
+        return false;
+    }
+    return true;
+}
+
+void InputRecorder::replayTaskEntry(void* param) {
+    static_cast<InputRecorder*>(param)->replay();
+    vTaskDelete(nullptr);
+}
+
+void InputRecorder::replay() {
+    LOG_INFO(TAG, "Replaying %u events", count);
+
+    uint64_t baseUs = static_cast<uint64_t>(esp_timer_get_time());
+
+    for (uint16_t i = 0; i < count; i++) {
+        const InputRecord& rec = records[i];
+
+        // Sleep until the recorded offset; sub-tick remainders are absorbed by the next event
+        int64_t waitUs = static_cast<int64_t>(baseUs + rec.offsetUs) - esp_timer_get_time();
+        if (waitUs >= 1000) {
+            vTaskDelay(pdMS_TO_TICKS(waitUs / 1000));
+        }
+
+        uint64_t now = static_cast<uint64_t>(esp_timer_get_time());
+        if (rec.topic == static_cast<uint8_t>(EventTopic::ENCODER_INPUT)) {
+            EncoderInputEvent evt{ static_cast<EventEnum::EncoderInputEventTypes>(rec.type), rec.value, now };
+            eventBus->publish(evt, EventSource::REPLAY);
+        } else {
+            ButtonEvent evt{ static_cast<EventEnum::ButtonEventTypes>(rec.type), static_cast<uint8_t>(rec.value),
+                             static_cast<uint32_t>(now / 1000) };
+            eventBus->publish(evt, EventSource::REPLAY);
+        }
+    }
+
+    LOG_INFO(TAG, "Replay finished");
+    replaying = false;
+}
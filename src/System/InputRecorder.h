@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "Config/input_record_config.h"
+#include "Type/EventEnvelope.h"
+
+class EventBus;
+class Print;
+
+/**
+ * @brief One recorded input (binary dump record, little endian)
+ */
+struct __attribute__((packed)) InputRecord {
+    uint32_t offsetUs;  ///< Time since recording started
+    uint8_t topic;      ///< EventTopic::ENCODER_INPUT or EventTopic::BUTTON_INPUT
+    uint8_t type;       ///< EncoderInputEventTypes / ButtonEventTypes
+    int16_t value;      ///< Rotation delta (encoder) or button index (button)
+};
+
+static_assert(sizeof(InputRecord) == 8, "InputRecord is a wire format");
+
+/**
+ * @brief Records real input sessions from the EventBus and replays them
+ *
+ * While recording, every ENCODER_INPUT and BUTTON_INPUT event is appended
+ * to a RAM ring with its time offset. Replay re-publishes the recording on
+ * the bus with the original spacing (source REPLAY, timestamps rebased to
+ * now), so it drives the real handlers, menu and mode handlers exactly as
+ * the live session did. Replayed events are never recorded.
+ *
+ * Dump format (see tools/input_record.py):
+ *   "INRC" | version u8 | recordSize u8 | count u16 | records...
+ */
+class InputRecorder {
+public:
+    static constexpr uint8_t DUMP_VERSION = 1;
+
+    explicit InputRecorder(EventBus* bus);
+
+    /**
+     * @brief Subscribe to the input topics (call once during setup)
+     */
+    void attach();
+
+    void startRecording();
+    void stopRecording();
+    bool isRecording() const { return recording; }
+
+    /**
+     * @brief Write the recording in binary (recording must be stopped)
+     */
+    void dump(Print& out) const;
+
+    /**
+     * @brief Replay the recording on a background task
+     * @return false if recording, already replaying or nothing recorded
+     */
+    bool startReplay();
+
+private:
+    EventBus* eventBus;
+    InputRecord records[INPUT_RECORD_CAPACITY];
+    uint16_t count;
+    uint32_t dropped;
+    uint64_t startUs;
+    volatile bool recording;
+    volatile bool replaying;
+
+    struct __attribute__((packed)) DumpHeader {
+        char magic[4];
+        uint8_t version;
+        uint8_t recordSize;
+        uint16_t count;
+    };
+
+    bool onInputEvent(const EventEnvelope& event);
+
+    static void replayTaskEntry(void* param);
+    void replay();
+
+    static constexpr const char* TAG = "InputRecorder";
+};
@@ -0,0 +1,94 @@
+#include "LatencyTrace.h"
+#include "Arduino.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+#if LATENCY_TRACE_ENABLED
+
+namespace LatencyTrace {
+
+namespace {
+    LatencyTraceRecord ring[LATENCY_TRACE_CAPACITY];
+    uint16_t head = 0;   // Next slot to write
+    uint16_t count = 0;
+    uint16_t sequence = 0;
+    uint32_t overwritten = 0;
+    bool paused = false;
+    portMUX_TYPE traceMux = portMUX_INITIALIZER_UNLOCKED;
+
+    thread_local uint64_t activeOriginUs = 0;
+
+    struct __attribute__((packed)) DumpHeader {
+        char magic[4];
+        uint8_t version;
+        uint8_t recordSize;
+        uint16_t count;
+        uint32_t overwritten;
+    };
+}
+
+void record(TraceStage stage, uint64_t originUs) {
+    if (originUs == 0) {
+        return;
+    }
+
+    uint64_t now = static_cast<uint64_t>(esp_timer_get_time());
+    uint64_t elapsed = now > originUs ? now - originUs : 0;
+
+    LatencyTraceRecord rec;
+    rec.stampUs = now;
+    rec.latencyUs = elapsed > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(elapsed);
+    rec.stage = static_cast<uint8_t>(stage);
+    rec.reserved = 0;
+
+    taskENTER_CRITICAL(&traceMux);
+    rec.sequence = sequence++;
+    if (paused) {
+        overwritten++;
+    } else {
+        ring[head] = rec;
+        head = (head + 1) % LATENCY_TRACE_CAPACITY;
+        if (count < LATENCY_TRACE_CAPACITY) {
+            count++;
+        } else {
+            overwritten++;
+        }
+    }
+    taskEXIT_CRITICAL(&traceMux);
+}
+
+void setActiveOrigin(uint64_t originUs) {
+    activeOriginUs = originUs;
+}
+
+uint64_t getActiveOrigin() {
+    return activeOriginUs;
+}
+
+void dump(Print& out) {
+    taskENTER_CRITICAL(&traceMux);
+    paused = true;
+    uint16_t n = count;
+    uint16_t start = (head + LATENCY_TRACE_CAPACITY - count) % LATENCY_TRACE_CAPACITY;
+    DumpHeader header = { { 'L', 'T', 'R', 'C' }, DUMP_VERSION, sizeof(LatencyTraceRecord), n, overwritten };
+    taskEXIT_CRITICAL(&traceMux);
+
+    // Ring is frozen, so it can be streamed without holding the lock
+    out.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+    for (uint16_t i = 0; i < n; i++) {
+        const LatencyTraceRecord& rec = ring[(start + i) % LATENCY_TRACE_CAPACITY];
+        out.write(reinterpret_cast<const uint8_t*>(&rec), sizeof(rec));
+    }
+    out.flush();
+
+    taskENTER_CRITICAL(&traceMux);
+    head = 0;
+    count = 0;
+    overwritten -= header.overwritten;  // Keep stamps lost during the dump for the next one
+    paused = false;
+    taskEXIT_CRITICAL(&traceMux);
+}
+
+} // namespace LatencyTrace
+
+#endif // LATENCY_TRACE_ENABLED
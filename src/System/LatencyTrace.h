@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdint.h>
+#include "Config/trace_config.h"
+#include "Enum/TraceStageEnum.h"
+
+class Print;
+
+/**
+ * @brief One stamp in the latency trace ring (binary dump record, little endian)
+ */
+struct __attribute__((packed)) LatencyTraceRecord {
+    uint64_t stampUs;    ///< esp_timer time the stage was reached
+    uint32_t latencyUs;  ///< stampUs minus the event's origin (ISR edge / gesture), saturated
+    uint8_t stage;       ///< TraceStage
+    uint8_t reserved;
+    uint16_t sequence;   ///< Wrapping record counter, exposes gaps from overwrites
+};
+
+static_assert(sizeof(LatencyTraceRecord) == 16, "LatencyTraceRecord is a wire format");
+
+/**
+ * @brief Fixed RAM ring of input-to-output latency stamps
+ *
+ * Each input event carries its origin time (encoder ISR edge or gesture
+ * recognition, esp_timer microseconds) through the pipeline. Every stage
+ * records the time elapsed since that origin. The handler task sets the
+ * active origin with TRACE_BEGIN so stages deeper in the call chain
+ * (HID report, display submit, nested publishes) can stamp without having
+ * the event at hand; the active origin is thread-local.
+ *
+ * Dump format (see tools/latency_trace.py):
+ *   "LTRC" | version u8 | recordSize u8 | count u16 | overwritten u32 | records...
+ *
+ * Only use through the TRACE_* macros so that builds without
+ * LATENCY_TRACE_ENABLED carry no cost.
+ */
+namespace LatencyTrace {
+    constexpr uint8_t DUMP_VERSION = 1;
+
+    /**
+     * @brief Append a record for a stage (no-op when originUs is 0)
+     */
+    void record(TraceStage stage, uint64_t originUs);
+
+    void setActiveOrigin(uint64_t originUs);
+    uint64_t getActiveOrigin();
+
+    /**
+     * @brief Write the ring (oldest first) in binary and clear it
+     *
+     * Recording is paused while the dump is written; stamps taken meanwhile
+     * are counted as overwritten.
+     */
+    void dump(Print& out);
+}
+
+#if LATENCY_TRACE_ENABLED
+#define TRACE_BEGIN(originUs)               LatencyTrace::setActiveOrigin(originUs)
+#define TRACE_STAMP(stage)                  LatencyTrace::record((stage), LatencyTrace::getActiveOrigin())
+#define TRACE_STAMP_ORIGIN(stage, originUs) LatencyTrace::record((stage), (originUs))
+#define TRACE_ACTIVE_ORIGIN()               LatencyTrace::getActiveOrigin()
+#else
+#define TRACE_BEGIN(originUs)               ((void)0)
+#define TRACE_STAMP(stage)                  ((void)0)
+#define TRACE_STAMP_ORIGIN(stage, originUs) ((void)0)
+#define TRACE_ACTIVE_ORIGIN()               (0ULL)
+#endif
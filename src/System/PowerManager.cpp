@@ -31,9 +31,32 @@ void PowerManager::resetActivity() {
         clearWarning();
     }
 
+    if (previousState != PowerState::ACTIVE) {
+        notifyState(PowerState::ACTIVE);
+    }
+
     LOG_DEBUG("PowerManager", "Activity reset");
 }
 
+bool PowerManager::onUserActivity(const EventEnvelope& event) {
+    resetActivity();
+    return true;
+}
+
+void PowerManager::setStateListener(StateListener listener) {
+    stateListener = listener;
+}
+
+void PowerManager::setSleepHook(SleepHook hook) {
+    sleepHook = hook;
+}
+
+void PowerManager::notifyState(PowerState state) {
+    if (stateListener) {
+        stateListener(state);
+    }
+}
+
 PowerState PowerManager::getState() const {
     // Critical section for thread-safe read
     taskENTER_CRITICAL(&stateMux);
@@ -55,6 +78,10 @@ void PowerManager::enterDeepSleep() {
 
     LOG_INFO("PowerManager", "Entering deep sleep mode");
 
+    if (sleepHook) {
+        sleepHook();
+    }
+
     // Turn off display
     display.setPower(false);
     LOG_INFO("PowerManager", "Display powered off");
@@ -120,6 +147,8 @@ void PowerManager::updateActivityState() {
         newState = PowerState::SLEEP;
     } else if (elapsed >= POWER_WARNING_THRESHOLD_MS) {
         newState = PowerState::WARNING;
+    } else if (elapsed >= POWER_IDLE_THRESHOLD_MS) {
+        newState = PowerState::IDLE;
     } else {
         newState = PowerState::ACTIVE;
     }
@@ -138,10 +167,18 @@ void PowerManager::updateActivityState() {
 
     taskEXIT_CRITICAL(&stateMux);
 
+    if (newState != previousState) {
+        if (newState == PowerState::IDLE) {
+            LOG_DEBUG("PowerManager", "State transition: %s → IDLE", powerStateToString(previousState));
+        }
+        notifyState(newState);
+    }
+
     // Execute transitions outside critical section based on atomic decision
     if (needShowWarning) {
         if (isTransitionToWarning) {
-            LOG_INFO("PowerManager", "State transition: ACTIVE → WARNING (elapsed: %lu ms)", elapsed);
+            LOG_INFO("PowerManager", "State transition: %s → WARNING (elapsed: %lu ms)",
+                     powerStateToString(previousState), elapsed);
         }
         showWarning();  // Will retry on every check cycle until successful
     } else if (needClearWarning) {
@@ -150,8 +187,8 @@ void PowerManager::updateActivityState() {
             clearWarning();  // Clear warning before entering sleep
             enterDeepSleep();  // Enter deep sleep - device will reboot on wake
             // Code never reaches here
-        } else if (newState == PowerState::ACTIVE) {
-            LOG_DEBUG("PowerManager", "State transition: WARNING → ACTIVE");
+        } else {
+            LOG_DEBUG("PowerManager", "State transition: WARNING → %s", powerStateToString(newState));
         }
         clearWarning();  // Will retry on every check cycle until successful
     }
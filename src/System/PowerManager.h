@@ -7,12 +7,17 @@
 #include "freertos/queue.h"
 #include "Enum/PowerStateEnum.h"
 #include "BleKeyboard.h"
+#include "Type/EventEnvelope.h"
+#include "Delegate.h"
 
 // Forward declarations
 class DisplayInterface;
 
 class PowerManager {
 public:
+    using StateListener = Delegate<void(PowerState)>;
+    using SleepHook = Delegate<void()>;
+
     /**
      * @brief Construct PowerManager with required dependencies
      * @param keyboard BLE keyboard for cleanup before sleep
@@ -26,11 +31,16 @@ public:
     PowerManager& operator=(const PowerManager&) = delete;
 
     /**
-     * @brief Reset activity timer (called by input handlers)
+     * @brief Reset activity timer (called on every input event)
      * Thread-safe: Can be called from multiple tasks
      */
     void resetActivity();
 
+    /**
+     * @brief EventBus listener: any input event counts as user activity
+     */
+    bool onUserActivity(const EventEnvelope& event);
+
     /**
      * @brief Get current power state
      * Thread-safe: Can be called from any task
@@ -38,6 +48,23 @@ public:
      */
     PowerState getState() const;
 
+    /**
+     * @brief Register a callback for power state transitions
+     *
+     * Called outside the state lock from whichever task caused the
+     * transition (PowerMgr task, or the input task on wake to ACTIVE).
+     * Must not block.
+     */
+    void setStateListener(StateListener listener);
+
+    /**
+     * @brief Register work that must finish before deep sleep (e.g. pending NVS writes)
+     *
+     * Called from enterDeepSleep() on the PowerMgr task, after the last
+     * chance to abort and before the display and BLE are shut down.
+     */
+    void setSleepHook(SleepHook hook);
+
     /**
      * @brief Start the power manager task
      * Creates FreeRTOS task that monitors inactivity
@@ -59,6 +86,8 @@ private:
     QueueHandle_t displayQueue;  // Display request queue for warning messages
     BleKeyboard& bleKeyboard;  // BLE keyboard for cleanup before sleep
     DisplayInterface& display;  // Display interface for cleanup before sleep
+    StateListener stateListener;  // Optional, notified on every transition
+    SleepHook sleepHook;  // Optional, run once before sleeping
 
     static constexpr const char* SLEEP_WARNING_MESSAGE = "Sleep in 1 min";
 
@@ -67,4 +96,5 @@ private:
     void updateActivityState();
     void showWarning();
     void clearWarning();
+    void notifyState(PowerState state);
 };
@@ -6,8 +6,12 @@
 #include "Config/device_config.h"
 #include "Config/encoder_config.h"
 #include "Config/log_config.h"
+#include "Config/event_bus_config.h"
 #include "Config/FactoryReset.h"
 #include "Config/ConfigManager.h"
+#include "Config/acceleration_config.h"
+#include "Config/macro_config.h"
+#include "Config/nvs_config.h"
 #include "Display/DisplayFactory.h"
 #include "Helper/EncoderModeHelper.h"
 #include "Enum/WheelModeEnum.h"
@@ -15,8 +19,10 @@
 #include "Type/ButtonEvent.h"
 #include "Type/AppEvent.h"
 #include "Enum/EventEnum.h"
+#include "Event/Bus/EventBus.h"
 #include "Event/Dispatcher/EncoderEventDispatcher.h"
 #include "Event/Handler/EncoderEventHandler.h"
+#include "Event/Queue/EncoderEventQueue.h"
 #include "Event/Dispatcher/AppEventDispatcher.h"
 #include "Event/Handler/AppEventHandler.h"
 #include "Event/Dispatcher/ButtonEventDispatcher.h"
@@ -26,6 +32,7 @@
 #include "EncoderMode/Handler/EncoderModeHandlerZoom.h"
 #include "EncoderMode/Selector/EncoderModeSelector.h"
 #include "EncoderMode/Manager/EncoderModeManager.h"
+#include "EncoderMode/Acceleration/AccelerationEngine.h"
 #include "Menu/Controller/MenuController.h"
 #include "Menu/Model/MenuTree.h"
 #include "Menu/Action/ShowStatusAction.h"
@@ -40,19 +47,47 @@
 #include "state/HardwareState.h"
 #include "BLE/BleCallbackHandler.h"
 #include "BLE/BleKeyboardService.h"
+#include "BLE/HidOutputTask.h"
+#include "BLE/BleLinkManager.h"
+#include "BLE/BleAdvertisingScheduler.h"
 #include "System/PowerManager.h"
+#include "System/EventTelemetry.h"
+#include "System/LatencyTrace.h"
+#include "System/InputRecorder.h"
 #include "Macro/Manager/MacroManager.h"
+#include "Macro/Vm/MacroVm.h"
 
 BleKeyboard bleKeyboard(BLUETOOTH_DEVICE_NAME, BLUETOOTH_DEVICE_MANUFACTURER, BLUETOOTH_DEVICE_BATTERY_LEVEL_DEFAULT);
-BleKeyboardService bleKeyboardService(&bleKeyboard);
+HidOutputTask hidOutputTask(&bleKeyboard);  // Sole caller of BleKeyboard report methods
+BleKeyboardService bleKeyboardService(&bleKeyboard, &hidOutputTask);
+BleLinkManager bleLinkManager(&hidOutputTask);
+BleAdvertisingScheduler advertisingScheduler(&bleKeyboard);
 EncoderDriver* encoderDriver;
 AppState appState;
-HardwareState hardwareState;  // Global hardware state instance
+HardwareStateStore hardwareState;  // Global hardware state instance
+
+// Event bus shared by dispatchers and subscribers
+EventBus eventBus;
+EventTelemetry eventTelemetry(&eventBus);
+
+#if INPUT_RECORD_ENABLED
+InputRecorder inputRecorder(&eventBus);
+#endif
 
 // Configuration management
 Preferences preferences;
 ConfigManager configManager(&preferences, &bleKeyboardService);
 
+// Macro execution: packed chords go straight to HidOutputTask, programs run on MacroVm
+MacroVm macroVm(&hidOutputTask);
+MacroManager macroManager(&hidOutputTask, &macroVm);
+
+// Per-mode acceleration curves; global so the serial console can upload new ones
+AccelerationEngine accelerationEngine;
+
+// Sole renderer; global so loop() can report its request counters
+DisplayTask displayTask(&DisplayFactory::getDisplay());
+
 /**
  * @brief Check if device is waking from deep sleep
  * @return true if waking from GPIO wake source (deep sleep), false otherwise
@@ -71,6 +106,63 @@ bool isWakingFromDeepSleep() {
     return wakingFromSleep;
 }
 
+/**
+ * @brief Handle a single-byte diagnostic command from the serial console
+ * @param command Byte read from Serial
+ *
+ * Binary dumps are decoded on the host with tools/latency_trace.py and
+ * tools/input_record.py; macro programs are uploaded with tools/macro_asm.py,
+ * acceleration curves with tools/accel_curve.py.
+ */
+void handleSerialCommand(int command) {
+#if MACRO_UPLOAD_ENABLED
+    if (command == MACRO_UPLOAD_COMMAND) {
+        macroManager.receiveProgram(Serial, configManager);
+        return;
+    }
+#endif
+#if ACCEL_CURVE_UPLOAD_ENABLED
+    if (command == ACCEL_CURVE_UPLOAD_COMMAND) {
+        accelerationEngine.receiveCurve(Serial, configManager);
+        return;
+    }
+#endif
+#if CONFIG_FLUSH_ENABLED
+    if (command == CONFIG_FLUSH_COMMAND) {
+        configManager.flush();
+        return;
+    }
+#endif
+
+#if LATENCY_TRACE_ENABLED
+    if (command == LATENCY_TRACE_DUMP_COMMAND) {
+        LatencyTrace::dump(Serial);
+        return;
+    }
+#endif
+
+#if INPUT_RECORD_ENABLED
+    if (command == INPUT_RECORD_TOGGLE_COMMAND) {
+        if (inputRecorder.isRecording()) {
+            inputRecorder.stopRecording();
+        } else {
+            inputRecorder.startRecording();
+        }
+        return;
+    }
+    if (command == INPUT_RECORD_DUMP_COMMAND) {
+        inputRecorder.dump(Serial);
+        return;
+    }
+    if (command == INPUT_RECORD_REPLAY_COMMAND) {
+        inputRecorder.startReplay();
+        return;
+    }
+#endif
+
+    (void)command;
+}
+
 void setup()
 {
     Serial.begin(460800);
@@ -84,62 +176,115 @@ void setup()
         FactoryReset::execute(configManager, DisplayFactory::getDisplay());
     }
 
+    // Single NVS pass: everything after this reads the RAM snapshot
+    configManager.begin();
+
     bleKeyboard.begin();
 
+    // Replace the library's default advertising: directed to the last peer after a wake, then fast, then slow
+    appState.advertisingScheduler = &advertisingScheduler;
+    advertisingScheduler.begin(wakingFromSleep);
+
     // Register BLE connection state callbacks for user feedback
     bleKeyboard.setOnConnect([]() {
         BleCallbackHandler::handleConnect(appState.displayRequestQueue);
+        bleLinkManager.onConnect();
+        advertisingScheduler.onConnect();
     });
 
     bleKeyboard.setOnDisconnect([](int reason) {
         BleCallbackHandler::handleDisconnect(reason, appState.displayRequestQueue, &bleKeyboard);
+        bleLinkManager.onDisconnect();
+        advertisingScheduler.onDisconnect();
     });
 
-    appState.encoderInputEventQueue = xQueueCreate(10, sizeof(EncoderInputEvent));
-    appState.buttonEventQueue = xQueueCreate(10, sizeof(ButtonEvent));
-    appState.appEventQueue = xQueueCreate(10, sizeof(AppEvent));
-    appState.menuEventQueue = xQueueCreate(10, sizeof(MenuEvent));
+    // HID output runs off the input path so a congested link never stalls handlers
+    hidOutputTask.start();
+
+    // Event bus: the encoder queue coalesces rotation, other handlers own plain subscriber queues
+    appState.eventBus = &eventBus;
+
+    static EncoderEventQueue encoderEventQueue;
+    encoderEventQueue.init();
+    appState.encoderInputEventQueue = &encoderEventQueue;
+    eventBus.subscribe(EventTopic::ENCODER_INPUT, EventListener::bind<EncoderEventQueue, &EncoderEventQueue::onBusEvent>(&encoderEventQueue));
+
+    QueueHandle_t buttonEventQueue = EventBus::createQueue(EVENT_BUS_QUEUE_DEPTH);
+    QueueHandle_t appEventQueue = EventBus::createQueue(EVENT_BUS_QUEUE_DEPTH);
+    QueueHandle_t menuEventQueue = EventBus::createQueue(EVENT_BUS_QUEUE_DEPTH);
+    eventBus.subscribeQueue(EventTopic::BUTTON_INPUT, buttonEventQueue);
+    eventBus.subscribeQueue(EventTopic::APP, appEventQueue);
+    eventBus.subscribeQueue(EventTopic::MENU, menuEventQueue);
 
     // Initialize display pipeline first (needed for displayRequestQueue)
-    static DisplayTask displayTask(&DisplayFactory::getDisplay());
     displayTask.init(10);
     appState.displayRequestQueue = displayTask.getQueue();
+    displayTask.setHardwareState(&hardwareState);
     displayTask.start(2048, 1);
 
+    // Status screen redraws whenever anyone announces a HardwareState change
+    eventBus.subscribe(EventTopic::STATE_CHANGED, EventListener::bind<DisplayTask, &DisplayTask::onStateChanged>(&displayTask));
+
     // Initialize hardware state with loaded config
     WheelMode savedWheelMode = configManager.loadWheelMode();
-    hardwareState.encoderWheelState.mode = savedWheelMode;
-    hardwareState.encoderWheelState.direction = configManager.getWheelDirection();
+    HardwareState initialState{};
+    initialState.encoderWheelState.mode = savedWheelMode;
+    initialState.encoderWheelState.direction = configManager.getWheelDirection();
     // TODO: Implement battery monitoring via ADC + voltage divider on GPIO pin
     // Current placeholder value (100%) should be replaced with periodic ADC reads
     // and voltage-to-percentage conversion. Consider adding low-battery warning threshold.
-    hardwareState.batteryPercent = 100;
-    hardwareState.bleState.isConnected = false;  // Updated by BLE callbacks
-    hardwareState.bleState.isPairingMode = false;
-    hardwareState.displayPower = true;  // Display always starts ON after boot (session-only toggle)
-    hardwareState.macroModeActive = false;  // Macro mode starts inactive (toggled by long-press on macro button)
+    initialState.batteryPercent = 100;
+    initialState.bleState.isConnected = false;  // Updated by BLE callbacks
+    initialState.bleState.isPairingMode = false;
+    initialState.displayPower = true;  // Display always starts ON after boot (session-only toggle)
+    initialState.macroModeActive = false;  // Macro mode starts inactive (toggled by long-press on macro button)
+    hardwareState.write(initialState);
 
     // Initialize display power state (always ON at boot for visual feedback)
-    DisplayFactory::getDisplay().setPower(hardwareState.displayPower);
-    LOG_INFO("Main", "Display power initialized: %s", hardwareState.displayPower ? "ON" : "OFF");
+    DisplayFactory::getDisplay().setPower(initialState.displayPower);
+    LOG_INFO("Main", "Display power initialized: %s", initialState.displayPower ? "ON" : "OFF");
 
     // Initialize PowerManager with dependencies (now that all deps are ready)
     static PowerManager powerManager(bleKeyboard, DisplayFactory::getDisplay(), appState.displayRequestQueue);
 
+    // Any input counts as user activity
+    EventListener activityListener = EventListener::bind<PowerManager, &PowerManager::onUserActivity>(&powerManager);
+    eventBus.subscribe(EventTopic::ENCODER_INPUT, activityListener);
+    eventBus.subscribe(EventTopic::BUTTON_INPUT, activityListener);
+
+    // Connection parameters follow activity: fast while in use, relaxed once IDLE
+    powerManager.setStateListener(PowerManager::StateListener::bind<BleLinkManager, &BleLinkManager::onPowerStateChanged>(&bleLinkManager));
+
+    // Settings are written back lazily; make sure nothing pending is lost to sleep
+    powerManager.setSleepHook([]() { configManager.flush(); });
+
+    eventTelemetry.attach();
+#if INPUT_RECORD_ENABLED
+    inputRecorder.attach();
+#endif
+
     // Initialize MacroManager for macro mode execution
-    static MacroManager macroManager(&bleKeyboard);
+    macroVm.start();
     macroManager.loadFromNVS(configManager);
-
-    static AppEventDispatcher appDispatcher(appState.appEventQueue);
-    static EncoderModeHandlerScroll encoderModeHandlerScroll(&appDispatcher, &bleKeyboard);
-    static EncoderModeHandlerVolume encoderModeHandlerVolume(&appDispatcher, &bleKeyboard);
-    static EncoderModeHandlerZoom encoderModeHandlerZoom(&appDispatcher, &bleKeyboard);
+    configManager.subscribe(&macroManager);
+
+    static AppEventDispatcher appDispatcher(&eventBus);
+    static EncoderModeHandlerScroll encoderModeHandlerScroll(&appDispatcher, &hidOutputTask);
+    static EncoderModeHandlerVolume encoderModeHandlerVolume(&appDispatcher, &hidOutputTask);
+    static EncoderModeHandlerZoom encoderModeHandlerZoom(&appDispatcher, &hidOutputTask);
+    encoderModeHandlerZoom.onConfigChanged(ConfigChange::ALL, configManager.getSnapshot());
+    configManager.subscribe(&encoderModeHandlerZoom);
     static EncoderModeSelector encoderModeSelector(&appDispatcher);
 
-    static EncoderEventHandler encoderEventHandler(appState.encoderInputEventQueue, &powerManager, &hardwareState, &macroManager);
+    // Per-mode acceleration curves (defaults unless overridden in NVS), re-applied when saved
+    accelerationEngine.onConfigChanged(ConfigChange::ALL, configManager.getSnapshot());
+    configManager.subscribe(&accelerationEngine);
+
+    static EncoderEventHandler encoderEventHandler(appState.encoderInputEventQueue, &hardwareState, &macroManager);
+    encoderEventHandler.setAccelerationEngine(&accelerationEngine);
     encoderEventHandler.start();
 
-    static EncoderModeManager encoderModeManager(&encoderEventHandler, &encoderModeSelector, appState.displayRequestQueue, &hardwareState);
+    static EncoderModeManager encoderModeManager(&encoderEventHandler, &encoderModeSelector, &eventBus, &hardwareState);
     encoderModeManager.registerHandler(EventEnum::EncoderModeEventTypes::ENCODER_MODE_SCROLL, &encoderModeHandlerScroll);
     encoderModeManager.registerHandler(EventEnum::EncoderModeEventTypes::ENCODER_MODE_VOLUME, &encoderModeHandlerVolume);
     encoderModeManager.registerHandler(EventEnum::EncoderModeEventTypes::ENCODER_MODE_ZOOM, &encoderModeHandlerZoom);
@@ -149,8 +294,8 @@ void setup()
     encoderModeManager.setMode(initialMode);
 
     // Initialize button event system
-    static ButtonEventDispatcher buttonEventDispatcher(appState.buttonEventQueue);
-    static ButtonEventHandler buttonEventHandler(appState.buttonEventQueue, &configManager, &bleKeyboardService, &powerManager, &hardwareState, &macroManager);
+    static ButtonEventDispatcher buttonEventDispatcher(&eventBus);
+    static ButtonEventHandler buttonEventHandler(buttonEventQueue, &configManager, &bleKeyboardService, &eventBus, &hardwareState, &macroManager);
     buttonEventHandler.start();
 
     // Create BT flash timer for pairing animation (500ms period = 1Hz blink rate)
@@ -171,22 +316,19 @@ void setup()
 
     // Wait briefly for welcome message, then show normal mode status
     vTaskDelay(pdMS_TO_TICKS(1000));  // 1 second delay
-    DisplayRequest normalModeRequest;
-    normalModeRequest.type = DisplayRequestType::DRAW_NORMAL_MODE;
-    normalModeRequest.data.normalMode.hwState = hardwareState;
-    xQueueSend(appState.displayRequestQueue, &normalModeRequest, portMAX_DELAY);
+    eventBus.publishStateChanged(StateChange::REFRESH, EventSource::SYSTEM);
 
     // Initialize menu event pipeline
-    MenuEventDispatcher::init(appState.menuEventQueue);
-    static MenuEventHandler menuEventHandler(appState.menuEventQueue, appState.displayRequestQueue, &hardwareState);
+    MenuEventDispatcher::init(&eventBus);
+    static MenuEventHandler menuEventHandler(menuEventQueue, appState.displayRequestQueue);
     menuEventHandler.start(2048, 1);
 
     // Initialize menu system
     static MenuController menuController(&DisplayFactory::getDisplay());
     MenuTree::initButtonBehaviorMenuItems(&bleKeyboardService);
     MenuTree::initMenuTree();
-    MenuTree::initWheelBehaviorActions(&configManager, &encoderModeManager, appState.displayRequestQueue, &hardwareState);
-    MenuTree::initButtonBehaviorActions(&configManager, &buttonEventHandler, &bleKeyboardService);
+    MenuTree::initWheelBehaviorActions(&configManager, &encoderModeManager, &eventBus, &hardwareState);
+    MenuTree::initButtonBehaviorActions(&configManager, &bleKeyboardService);
     MenuTree::initBluetoothActions(&bleKeyboard, appState.displayRequestQueue);
     MenuTree::initDisplayActions(&DisplayFactory::getDisplay(), &menuController);
 
@@ -198,26 +340,22 @@ void setup()
     
     encoderEventHandler.setMenuController(&menuController);
 
-    static AppEventHandler appEventHandler(appState.appEventQueue, &encoderModeManager);
+    static AppEventHandler appEventHandler(appEventQueue, &encoderModeManager);
     appEventHandler.start();
 
-    // Initialize ButtonDriver with callbacks for short/long press events
+    // Initialize ButtonDriver with gesture callbacks
     ButtonDriver* buttonDriver = ButtonDriver::getInstance();
 
-    // Set up callbacks for each button to dispatch events
+    // Set up callbacks for each button to dispatch events (timer service task: publish only, never block)
     for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
-        buttonDriver->setOnShortPress(i, [i]() {
-            buttonEventDispatcher.onButtonShortPress(i);
-        });
-
-        buttonDriver->setOnLongPress(i, [i]() {
-            buttonEventDispatcher.onButtonLongPress(i);
+        buttonDriver->setOnGesture(i, [i](const GestureEvent& gesture) {
+            buttonEventDispatcher.onButtonGesture(i, gesture);
         });
     }
 
     buttonDriver->begin();
 
-    static EncoderEventDispatcher encoderEventDispatcher(appState.encoderInputEventQueue, &configManager);
+    static EncoderEventDispatcher encoderEventDispatcher(&eventBus, &configManager);
     encoderDriver = EncoderDriver::getInstance(
         ENCODER_PIN_A,
         ENCODER_PIN_B,
@@ -225,8 +363,8 @@ void setup()
         ENCODER_PIN_VCC,
         ENCODER_STEPS
     );
-    encoderDriver->setOnValueChange([](int32_t newValue) {
-        encoderEventDispatcher.onEncoderValueChange(newValue);
+    encoderDriver->setOnRotate([](int32_t delta, uint64_t timestampUs) {
+        encoderEventDispatcher.onEncoderRotate(delta, timestampUs);
     });
 
     encoderDriver->setOnShortClick([]() {
@@ -250,8 +388,31 @@ void loop()
     // - ButtonEventHandler task processes button events
     // - AppEventHandler task processes app events
     // - DisplayTask renders to OLED
+    // - HidOutputTask sends queued HID reports over BLE
+    // - MacroVm runs macro programs
     // - MenuEventHandler task processes menu events
     //
-    // loop() intentionally empty - event-driven architecture uses tasks only
-    vTaskDelay(portMAX_DELAY);  // Yield to scheduler indefinitely
+    // loop() serves diagnostics, the BLE link/advertising polls and config write-back - event-driven architecture uses tasks
+    static uint32_t lastTelemetryMs = 0;
+
+    while (Serial.available() > 0) {
+        handleSerialCommand(Serial.read());
+    }
+
+    bleLinkManager.poll();
+    advertisingScheduler.poll();
+    configManager.poll();
+
+    if (millis() - lastTelemetryMs >= EVENT_BUS_STATS_INTERVAL_MS) {
+        lastTelemetryMs = millis();
+        eventTelemetry.log();
+        hidOutputTask.logStats();
+        bleLinkManager.logStats();
+        advertisingScheduler.logStats();
+        configManager.logStats();
+        displayTask.logStats();
+        DisplayFactory::getDisplay().logStats();
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(100));
 }
@@ -0,0 +1,129 @@
+#pragma once
+
+/**
+ * @brief Arduino core surface used by the firmware sources, for the native build
+ *
+ * Time comes from HostClock; Serial writes to stdout and reads from a
+ * buffer tests can fill with Serial.feed().
+ */
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "HostClock.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "freertos/timers.h"
+
+#define PROGMEM
+
+inline unsigned long millis() {
+    return static_cast<unsigned long>(HostClock::nowUs / 1000);
+}
+
+inline unsigned long micros() {
+    return static_cast<unsigned long>(HostClock::nowUs);
+}
+
+inline void delay(uint32_t ms) {
+    HostClock::advanceMs(ms);
+}
+
+class Print {
+public:
+    virtual ~Print() = default;
+
+    virtual size_t write(uint8_t byte) {
+        return fputc(byte, stdout) == EOF ? 0 : 1;
+    }
+
+    virtual size_t write(const uint8_t* data, size_t length) {
+        size_t written = 0;
+        while (written < length && write(data[written])) {
+            written++;
+        }
+        return written;
+    }
+
+    size_t print(const char* text) { return write(reinterpret_cast<const uint8_t*>(text), strlen(text)); }
+    size_t print(int value) { return printf("%d", value); }
+    size_t println(const char* text = "") { return print(text) + print("\n"); }
+    size_t println(int value) { return print(value) + print("\n"); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        char buffer[256];
+        va_list args;
+        va_start(args, format);
+        int length = vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+        if (length < 0) {
+            return 0;
+        }
+        return write(reinterpret_cast<const uint8_t*>(buffer),
+                     static_cast<size_t>(length) < sizeof(buffer) ? length : sizeof(buffer) - 1);
+    }
+
+    virtual void flush() { fflush(stdout); }
+};
+
+class Stream : public Print {
+public:
+    /**
+     * @brief Queue bytes for read()/readBytes() (test input)
+     */
+    void feed(const void* data, size_t length) {
+        input.append(static_cast<const char*>(data), length);
+    }
+
+    int available() { return static_cast<int>(input.size() - readPos); }
+
+    int read() {
+        return readPos < input.size() ? static_cast<uint8_t>(input[readPos++]) : -1;
+    }
+
+    size_t readBytes(uint8_t* out, size_t length) {
+        size_t n = 0;
+        while (n < length && readPos < input.size()) {
+            out[n++] = static_cast<uint8_t>(input[readPos++]);
+        }
+        return n;
+    }
+
+    size_t readBytes(char* out, size_t length) {
+        return readBytes(reinterpret_cast<uint8_t*>(out), length);
+    }
+
+    void setTimeout(unsigned long) {}
+
+private:
+    std::string input;
+    size_t readPos = 0;
+};
+
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long) {}
+
+    size_t write(uint8_t byte) override {
+        return echo ? Stream::write(byte) : 1;
+    }
+    using Stream::write;
+
+    /**
+     * @brief Drop console output (benchmarks silence the handlers' per-event prints)
+     */
+    void setEcho(bool enabled) { echo = enabled; }
+
+private:
+    bool echo = true;
+};
+
+inline HardwareSerial Serial;
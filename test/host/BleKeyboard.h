@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
+#include "HostClock.h"
+
+/**
+ * @brief Recording fake of the BleKeyboard library for the native build
+ *
+ * Same report API the firmware calls, but every notification is appended
+ * to reports() with the HostClock time instead of going over BLE. Tests
+ * assert on the sequence; the pipeline benchmark prints it as the output
+ * trace. Key constants match the library.
+ */
+
+typedef uint8_t MediaKeyReport[2];
+
+typedef struct {
+    uint8_t modifiers;
+    uint8_t reserved;
+    uint8_t keys[6];
+} KeyReport;
+
+const uint8_t KEY_LEFT_CTRL = 0x80;
+const uint8_t KEY_LEFT_SHIFT = 0x81;
+const uint8_t KEY_LEFT_ALT = 0x82;
+const uint8_t KEY_LEFT_GUI = 0x83;
+const uint8_t KEY_RIGHT_CTRL = 0x84;
+const uint8_t KEY_RIGHT_SHIFT = 0x85;
+const uint8_t KEY_RIGHT_ALT = 0x86;
+const uint8_t KEY_RIGHT_GUI = 0x87;
+const uint8_t KEY_NUM_PLUS = 0xDF;
+const uint8_t KEY_NUM_MINUS = 0xDE;
+
+const MediaKeyReport KEY_MEDIA_NEXT_TRACK = {1, 0};
+const MediaKeyReport KEY_MEDIA_PREVIOUS_TRACK = {2, 0};
+const MediaKeyReport KEY_MEDIA_STOP = {4, 0};
+const MediaKeyReport KEY_MEDIA_PLAY_PAUSE = {8, 0};
+const MediaKeyReport KEY_MEDIA_MUTE = {16, 0};
+const MediaKeyReport KEY_MEDIA_VOLUME_UP = {32, 0};
+const MediaKeyReport KEY_MEDIA_VOLUME_DOWN = {64, 0};
+
+/**
+ * @brief One HID notification as the host would receive it
+ */
+struct RecordedReport {
+    enum class Kind : uint8_t { KEYBOARD, CONSUMER, MOUSE };
+
+    Kind kind;
+    uint64_t atUs;
+    uint8_t modifiers;   ///< KEYBOARD
+    uint8_t keys[6];     ///< KEYBOARD
+    uint8_t media[2];    ///< CONSUMER (all zero = release)
+    int8_t wheel;        ///< MOUSE
+    int8_t hWheel;       ///< MOUSE
+};
+
+class BleKeyboard {
+public:
+    BleKeyboard(const char* = "", const char* = "", uint8_t = 100) {}
+
+    void begin() {}
+    void end() {}
+    bool isConnected() { return connected; }
+    void disconnect() { connected = false; }
+    void clearBonds() {}
+    void startAdvertising() {}
+    void stopAdvertising() {}
+
+    void sendReport(KeyReport* report) {
+        RecordedReport r = make(RecordedReport::Kind::KEYBOARD);
+        r.modifiers = report->modifiers;
+        memcpy(r.keys, report->keys, sizeof(r.keys));
+        log.push_back(r);
+    }
+
+    void sendReport(MediaKeyReport* report) {
+        RecordedReport r = make(RecordedReport::Kind::CONSUMER);
+        memcpy(r.media, *report, sizeof(r.media));
+        log.push_back(r);
+    }
+
+    /**
+     * @brief Consumer key press and release: two notifications, as in the library
+     */
+    size_t write(const MediaKeyReport key) {
+        if (!connected) {
+            return 0;
+        }
+        MediaKeyReport press = { key[0], key[1] };
+        MediaKeyReport release = { 0, 0 };
+        sendReport(&press);
+        sendReport(&release);
+        return 1;
+    }
+
+    void mouseMove(signed char, signed char, signed char wheel = 0, signed char hWheel = 0) {
+        RecordedReport r = make(RecordedReport::Kind::MOUSE);
+        r.wheel = wheel;
+        r.hWheel = hWheel;
+        log.push_back(r);
+    }
+
+    void setOnConnect(std::function<void()> callback) { onConnect = callback; }
+    void setOnDisconnect(std::function<void(int)> callback) { onDisconnect = callback; }
+
+    // Test controls
+    void setConnected(bool value) { connected = value; }
+    const std::vector<RecordedReport>& reports() const { return log; }
+    void clearReports() { log.clear(); }
+
+private:
+    bool connected = true;
+    std::vector<RecordedReport> log;
+    std::function<void()> onConnect;
+    std::function<void(int)> onDisconnect;
+
+    static RecordedReport make(RecordedReport::Kind kind) {
+        RecordedReport r = {};
+        r.kind = kind;
+        r.atUs = HostClock::nowUs;
+        return r;
+    }
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Virtual time for the native build
+ *
+ * Nothing sleeps on the host: vTaskDelay() and friends advance this clock,
+ * so paced code (report intervals, debounce windows) runs at full speed and
+ * gives the same result on every run. millis(), micros(),
+ * esp_timer_get_time() and xTaskGetTickCount() all read it.
+ */
+namespace HostClock {
+
+inline uint64_t nowUs = 0;
+
+inline void reset() { nowUs = 0; }
+inline void advanceUs(uint64_t us) { nowUs += us; }
+inline void advanceMs(uint32_t ms) { nowUs += static_cast<uint64_t>(ms) * 1000; }
+
+/**
+ * @brief Move the clock forward to an absolute time (never backwards)
+ */
+inline void advanceTo(uint64_t us) {
+    if (us > nowUs) {
+        nowUs = us;
+    }
+}
+
+}  // namespace HostClock
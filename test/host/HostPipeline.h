@@ -0,0 +1,190 @@
+#pragma once
+
+#include <cstdint>
+#include "BleKeyboard.h"
+#include "HostClock.h"
+#include <Preferences.h>
+#include "BLE/BleKeyboardService.h"
+#include "BLE/HidOutputTask.h"
+#include "Config/ConfigManager.h"
+#include "EncoderMode/Acceleration/AccelerationEngine.h"
+#include "EncoderMode/Handler/EncoderModeHandlerScroll.h"
+#include "EncoderMode/Handler/EncoderModeHandlerVolume.h"
+#include "EncoderMode/Handler/EncoderModeHandlerZoom.h"
+#include "EncoderMode/Manager/EncoderModeManager.h"
+#include "EncoderMode/Selector/EncoderModeSelector.h"
+#include "Event/Bus/EventBus.h"
+#include "Event/Dispatcher/AppEventDispatcher.h"
+#include "Event/Dispatcher/MenuEventDispatcher.h"
+#include "Event/Handler/ButtonEventHandler.h"
+#include "Event/Handler/EncoderEventHandler.h"
+#include "Event/Queue/EncoderEventQueue.h"
+#include "Helper/EncoderModeHelper.h"
+#include "Macro/Manager/MacroManager.h"
+#include "Macro/Vm/MacroVm.h"
+#include "Menu/Controller/MenuController.h"
+#include "Menu/Model/MenuTree.h"
+#include "System/InputRecorder.h"
+#include "state/HardwareState.h"
+
+/**
+ * @brief The input-to-HID half of setup(), wired for the native build
+ *
+ * Same objects and subscriptions as main.cpp, but no task is started:
+ * deliver() publishes an input on the bus and runs the handler that would
+ * have woken up, and sendNext() plays one iteration of the HID output
+ * task. Everything happens on HostClock time, so a replay is deterministic
+ * and the BleKeyboard fake records exactly what the host would receive.
+ *
+ * MenuTree keeps its actions in function statics, so create one pipeline
+ * per test program.
+ */
+class HostPipeline {
+public:
+    BleKeyboard keyboard;
+    HidOutputTask hid{&keyboard};
+    BleKeyboardService service{&keyboard, &hid};
+    HardwareStateStore hardwareState;
+    EventBus bus;
+    EncoderEventQueue encoderQueue;
+    QueueHandle_t buttonQueue = nullptr;
+    Preferences preferences;
+    ConfigManager config{&preferences, &service};
+    MacroVm macroVm{&hid};
+    MacroManager macroManager{&hid, &macroVm};
+    AppEventDispatcher appDispatcher{&bus};
+    EncoderModeHandlerScroll scroll{&appDispatcher, &hid};
+    EncoderModeHandlerVolume volume{&appDispatcher, &hid};
+    EncoderModeHandlerZoom zoom{&appDispatcher, &hid};
+    EncoderModeSelector selector{&appDispatcher};
+    AccelerationEngine acceleration;
+    EncoderEventHandler encoderHandler{&encoderQueue, &hardwareState, &macroManager};
+    EncoderModeManager modeManager{&encoderHandler, &selector, &bus, &hardwareState};
+    ButtonEventHandler* buttonHandler = nullptr;
+    MenuController menu{nullptr};
+
+    HostPipeline() {
+        config.begin();
+
+        encoderQueue.init();
+        bus.subscribe(EventTopic::ENCODER_INPUT,
+                      EventListener::bind<EncoderEventQueue, &EncoderEventQueue::onBusEvent>(&encoderQueue));
+        buttonQueue = EventBus::createQueue(EVENT_BUS_QUEUE_DEPTH);
+        bus.subscribeQueue(EventTopic::BUTTON_INPUT, buttonQueue);
+
+        HardwareState initial{};
+        initial.encoderWheelState.mode = config.loadWheelMode();
+        initial.encoderWheelState.direction = config.getWheelDirection();
+        initial.displayPower = true;
+        hardwareState.write(initial);
+
+        macroManager.loadFromNVS(config);
+        config.subscribe(&macroManager);
+        zoom.onConfigChanged(ConfigChange::ALL, config.getSnapshot());
+        config.subscribe(&zoom);
+
+        for (uint8_t i = 0; i <= WheelMode_MAX; i++) {
+            WheelMode mode = static_cast<WheelMode>(i);
+            AccelerationCurve curve;
+            config.loadAccelerationCurve(mode, curve);
+            acceleration.setCurve(mode, curve);
+        }
+        encoderHandler.setAccelerationEngine(&acceleration);
+
+        modeManager.registerHandler(EventEnum::EncoderModeEventTypes::ENCODER_MODE_SCROLL, &scroll);
+        modeManager.registerHandler(EventEnum::EncoderModeEventTypes::ENCODER_MODE_VOLUME, &volume);
+        modeManager.registerHandler(EventEnum::EncoderModeEventTypes::ENCODER_MODE_ZOOM, &zoom);
+        modeManager.setMode(EncoderModeHelper::fromWheelMode(initial.encoderWheelState.mode));
+
+        static ButtonEventHandler buttons(buttonQueue, &config, &service, &bus, &hardwareState, &macroManager);
+        buttonHandler = &buttons;
+
+        MenuEventDispatcher::init(&bus);
+        MenuTree::initButtonBehaviorMenuItems(&service);
+        MenuTree::initMenuTree();
+        MenuTree::initWheelBehaviorActions(&config, &modeManager, &bus, &hardwareState);
+        MenuTree::initButtonBehaviorActions(&config, &service);
+        encoderHandler.setMenuController(&menu);
+    }
+
+    /**
+     * @brief Publish one recorded input now and let its handler consume it
+     */
+    void deliver(const InputRecord& rec) {
+        uint64_t now = HostClock::nowUs;
+        if (rec.topic == static_cast<uint8_t>(EventTopic::ENCODER_INPUT)) {
+            EncoderInputEvent evt{ static_cast<EventEnum::EncoderInputEventTypes>(rec.type), rec.value, now };
+            bus.publish(evt, EventSource::REPLAY);
+            EncoderInputEvent queued;
+            while (encoderQueue.receive(queued, 0)) {
+                encoderHandler.handleEvent(queued);
+            }
+        } else {
+            ButtonEvent evt{ static_cast<EventEnum::ButtonEventTypes>(rec.type), static_cast<uint8_t>(rec.value),
+                             static_cast<uint32_t>(now / 1000) };
+            bus.publish(evt, EventSource::REPLAY);
+            EventEnvelope envelope;
+            while (xQueueReceive(buttonQueue, &envelope, 0) == pdTRUE) {
+                buttonHandler->handleEvent(envelope);
+            }
+        }
+    }
+
+    /**
+     * @brief Replay a recording with its original spacing, sending reports in between
+     *
+     * While reports are pending, the output task's pacing advances the clock
+     * and inputs that fall due meanwhile are delivered first, so intents
+     * coalesce as they would behind a congested link.
+     */
+    void replay(const InputRecord* records, uint16_t count) {
+        uint64_t baseUs = HostClock::nowUs;
+        uint16_t next = 0;
+
+        while (next < count || hid.getDepth() > 0) {
+            if (hid.getDepth() == 0) {
+                HostClock::advanceTo(baseUs + records[next].offsetUs);
+            }
+            while (next < count && baseUs + records[next].offsetUs <= HostClock::nowUs) {
+                deliver(records[next]);
+                next++;
+            }
+            if (hid.getDepth() > 0) {
+                hid.sendNext();
+            }
+        }
+    }
+
+    /**
+     * @brief Send everything still queued for the host
+     */
+    void drain() {
+        while (hid.sendNext()) {
+        }
+    }
+};
+
+/**
+ * @brief Shorthands for building recordings in tests
+ */
+namespace Input {
+inline InputRecord rotate(uint32_t atMs, int16_t delta) {
+    return { atMs * 1000, static_cast<uint8_t>(EventTopic::ENCODER_INPUT),
+             static_cast<uint8_t>(EventEnum::EncoderInputEventTypes::ROTATE), delta };
+}
+
+inline InputRecord click(uint32_t atMs) {
+    return { atMs * 1000, static_cast<uint8_t>(EventTopic::ENCODER_INPUT),
+             static_cast<uint8_t>(EventEnum::EncoderInputEventTypes::SHORT_CLICK), 0 };
+}
+
+inline InputRecord longClick(uint32_t atMs) {
+    return { atMs * 1000, static_cast<uint8_t>(EventTopic::ENCODER_INPUT),
+             static_cast<uint8_t>(EventEnum::EncoderInputEventTypes::LONG_CLICK), 0 };
+}
+
+inline InputRecord button(uint32_t atMs, uint8_t index, EventEnum::ButtonEventTypes type) {
+    return { atMs * 1000, static_cast<uint8_t>(EventTopic::BUTTON_INPUT), static_cast<uint8_t>(type),
+             static_cast<int16_t>(index) };
+}
+}  // namespace Input
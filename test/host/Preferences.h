@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief In-memory NVS namespace for the native build
+ *
+ * Every Preferences instance opened on the same namespace shares its
+ * contents for the life of the process (HostNvs::erase() resets them),
+ * so a test can write through one ConfigManager and boot another.
+ */
+namespace HostNvs {
+
+using Namespace = std::map<std::string, std::vector<uint8_t>>;
+
+inline std::map<std::string, Namespace> storage;
+inline uint32_t writes = 0;  ///< put* calls that reached "flash"
+
+inline void erase() {
+    storage.clear();
+    writes = 0;
+}
+
+}  // namespace HostNvs
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false) {
+        space = &HostNvs::storage[name];
+        this->readOnly = readOnly;
+        return true;
+    }
+
+    void end() { space = nullptr; }
+
+    bool clear() {
+        if (!writable()) {
+            return false;
+        }
+        space->clear();
+        return true;
+    }
+
+    bool remove(const char* key) { return writable() && space->erase(key) > 0; }
+    bool isKey(const char* key) { return space && space->count(key) > 0; }
+
+    size_t putUChar(const char* key, uint8_t value) { return put(key, &value, sizeof(value)); }
+    size_t putUShort(const char* key, uint16_t value) { return put(key, &value, sizeof(value)); }
+    size_t putUInt(const char* key, uint32_t value) { return put(key, &value, sizeof(value)); }
+    size_t putBytes(const char* key, const void* data, size_t length) { return put(key, data, length); }
+
+    uint8_t getUChar(const char* key, uint8_t fallback = 0) { return get(key, fallback); }
+    uint16_t getUShort(const char* key, uint16_t fallback = 0) { return get(key, fallback); }
+    uint32_t getUInt(const char* key, uint32_t fallback = 0) { return get(key, fallback); }
+
+    size_t getBytesLength(const char* key) {
+        const std::vector<uint8_t>* value = find(key);
+        return value ? value->size() : 0;
+    }
+
+    size_t getBytes(const char* key, void* out, size_t capacity) {
+        const std::vector<uint8_t>* value = find(key);
+        if (!value || value->size() > capacity) {
+            return 0;
+        }
+        memcpy(out, value->data(), value->size());
+        return value->size();
+    }
+
+private:
+    HostNvs::Namespace* space = nullptr;
+    bool readOnly = false;
+
+    bool writable() const { return space && !readOnly; }
+
+    const std::vector<uint8_t>* find(const char* key) const {
+        if (!space) {
+            return nullptr;
+        }
+        auto it = space->find(key);
+        return it == space->end() ? nullptr : &it->second;
+    }
+
+    size_t put(const char* key, const void* data, size_t length) {
+        if (!writable()) {
+            return 0;
+        }
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        (*space)[key].assign(bytes, bytes + length);
+        HostNvs::writes++;
+        return length;
+    }
+
+    template <typename T>
+    T get(const char* key, T fallback) {
+        const std::vector<uint8_t>* value = find(key);
+        if (!value || value->size() != sizeof(T)) {
+            return fallback;
+        }
+        T out;
+        memcpy(&out, value->data(), sizeof(T));
+        return out;
+    }
+};
@@ -0,0 +1,8 @@
+#pragma once
+
+/**
+ * @brief ESP-IDF placement attributes, empty on the host
+ */
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
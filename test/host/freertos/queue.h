@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstring>
+#include <deque>
+#include <vector>
+#include "FreeRTOS.h"
+
+/**
+ * @brief FIFO of fixed-size items; full sends and empty receives fail at once
+ */
+struct QueueDefinition {
+    size_t itemSize;
+    size_t capacity;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+typedef QueueDefinition* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    return new QueueDefinition{ itemSize, length, {} };
+}
+
+inline void vQueueDelete(QueueHandle_t queue) {
+    delete queue;
+}
+
+namespace HostQueue {
+inline BaseType_t push(QueueHandle_t queue, const void* item, bool front) {
+    if (!queue || queue->items.size() >= queue->capacity) {
+        return pdFAIL;
+    }
+    std::vector<uint8_t> bytes(queue->itemSize);
+    if (queue->itemSize > 0 && item) {
+        memcpy(bytes.data(), item, queue->itemSize);
+    }
+    if (front) {
+        queue->items.push_front(std::move(bytes));
+    } else {
+        queue->items.push_back(std::move(bytes));
+    }
+    return pdPASS;
+}
+}  // namespace HostQueue
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t) {
+    return HostQueue::push(queue, item, false);
+}
+
+inline BaseType_t xQueueSendToBack(QueueHandle_t queue, const void* item, TickType_t) {
+    return HostQueue::push(queue, item, false);
+}
+
+inline BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, TickType_t) {
+    return HostQueue::push(queue, item, true);
+}
+
+inline BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t*) {
+    return HostQueue::push(queue, item, false);
+}
+
+inline BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item) {
+    if (queue) {
+        queue->items.clear();
+    }
+    return HostQueue::push(queue, item, false);
+}
+
+inline BaseType_t xQueuePeek(QueueHandle_t queue, void* out, TickType_t) {
+    if (!queue || queue->items.empty()) {
+        return pdFALSE;
+    }
+    if (queue->itemSize > 0 && out) {
+        memcpy(out, queue->items.front().data(), queue->itemSize);
+    }
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void* out, TickType_t timeout) {
+    if (xQueuePeek(queue, out, timeout) != pdTRUE) {
+        return pdFALSE;
+    }
+    queue->items.pop_front();
+    return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    return queue ? static_cast<UBaseType_t>(queue->items.size()) : 0;
+}
+
+inline UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue) {
+    return queue ? static_cast<UBaseType_t>(queue->capacity - queue->items.size()) : 0;
+}
+
+inline BaseType_t xQueueReset(QueueHandle_t queue) {
+    if (queue) {
+        queue->items.clear();
+    }
+    return pdPASS;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "queue.h"
+
+/**
+ * @brief Semaphores are zero-size queues, as in FreeRTOS
+ *
+ * Taking a semaphore that is not available fails at once, so a task that
+ * would deadlock on the target gets pdFALSE here instead of hanging.
+ */
+typedef QueueHandle_t SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return xQueueCreate(1, 0);
+}
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+    SemaphoreHandle_t mutex = xQueueCreate(1, 0);
+    xQueueSend(mutex, nullptr, 0);
+    return mutex;
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t timeout) {
+    return xQueueReceive(semaphore, nullptr, timeout);
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return xQueueSend(semaphore, nullptr, 0);
+}
+
+inline BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t*) {
+    return xSemaphoreGive(semaphore);
+}
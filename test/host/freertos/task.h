@@ -0,0 +1,102 @@
+#pragma once
+
+#include "FreeRTOS.h"
+#include "HostClock.h"
+
+struct tskTaskControlBlock {
+    uint32_t notifyValue;
+};
+
+typedef tskTaskControlBlock* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+typedef enum { eNoAction, eSetBits, eIncrement, eSetValueWithOverwrite, eSetValueWithoutOverwrite } eNotifyAction;
+
+namespace HostTasks {
+inline tskTaskControlBlock current = {0};
+}
+
+/**
+ * @brief Accepts the task without running it (see FreeRTOS.h)
+ */
+inline BaseType_t xTaskCreate(TaskFunction_t, const char*, uint32_t, void*, UBaseType_t, TaskHandle_t* handle) {
+    if (handle) {
+        *handle = new tskTaskControlBlock{0};
+    }
+    return pdPASS;
+}
+
+inline void vTaskDelete(TaskHandle_t) {}
+
+inline TickType_t xTaskGetTickCount() {
+    return static_cast<TickType_t>(HostClock::nowUs / 1000);
+}
+
+inline TickType_t xTaskGetTickCountFromISR() {
+    return xTaskGetTickCount();
+}
+
+inline void vTaskDelay(TickType_t ticks) {
+    HostClock::advanceMs(ticks);
+}
+
+inline void vTaskDelayUntil(TickType_t* previous, TickType_t increment) {
+    *previous += increment;
+    HostClock::advanceTo(static_cast<uint64_t>(*previous) * 1000);
+}
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return &HostTasks::current;
+}
+
+inline UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) {
+    return 0;
+}
+
+inline BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    if (task) {
+        task->notifyValue++;
+    }
+    return pdPASS;
+}
+
+inline void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t*) {
+    xTaskNotifyGive(task);
+}
+
+inline BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action) {
+    if (!task) {
+        return pdFAIL;
+    }
+    switch (action) {
+        case eSetBits: task->notifyValue |= value; break;
+        case eIncrement: task->notifyValue++; break;
+        case eSetValueWithOverwrite:
+        case eSetValueWithoutOverwrite: task->notifyValue = value; break;
+        case eNoAction: break;
+    }
+    return pdPASS;
+}
+
+inline BaseType_t xTaskNotifyFromISR(TaskHandle_t task, uint32_t value, eNotifyAction action, BaseType_t*) {
+    return xTaskNotify(task, value, action);
+}
+
+/**
+ * @brief Takes the calling "task"'s pending notifications; never waits
+ */
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t) {
+    uint32_t value = HostTasks::current.notifyValue;
+    if (value > 0) {
+        HostTasks::current.notifyValue = clearOnExit ? 0 : value - 1;
+    }
+    return value;
+}
+
+inline BaseType_t xTaskNotifyWait(uint32_t, uint32_t clearOnExit, uint32_t* value, TickType_t) {
+    if (value) {
+        *value = HostTasks::current.notifyValue;
+    }
+    HostTasks::current.notifyValue &= ~clearOnExit;
+    return pdPASS;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+/**
+ * @brief Software timers that only record their state; nothing fires them
+ */
+struct tmrTimerControl {
+    TickType_t period;
+    UBaseType_t autoReload;
+    void* id;
+    void (*callback)(tmrTimerControl*);
+    bool active;
+};
+
+typedef tmrTimerControl* TimerHandle_t;
+typedef void (*TimerCallbackFunction_t)(TimerHandle_t);
+
+inline TimerHandle_t xTimerCreate(const char*, TickType_t period, UBaseType_t autoReload, void* id,
+                                  TimerCallbackFunction_t callback) {
+    return new tmrTimerControl{ period, autoReload, id, callback, false };
+}
+
+inline BaseType_t xTimerStart(TimerHandle_t timer, TickType_t) {
+    timer->active = true;
+    return pdPASS;
+}
+
+inline BaseType_t xTimerStop(TimerHandle_t timer, TickType_t) {
+    timer->active = false;
+    return pdPASS;
+}
+
+inline BaseType_t xTimerReset(TimerHandle_t timer, TickType_t) {
+    timer->active = true;
+    return pdPASS;
+}
+
+inline BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t period, TickType_t) {
+    timer->period = period;
+    timer->active = true;
+    return pdPASS;
+}
+
+inline BaseType_t xTimerResetFromISR(TimerHandle_t timer, BaseType_t*) {
+    return xTimerReset(timer, 0);
+}
+
+inline BaseType_t xTimerStopFromISR(TimerHandle_t timer, BaseType_t*) {
+    return xTimerStop(timer, 0);
+}
+
+inline BaseType_t xTimerChangePeriodFromISR(TimerHandle_t timer, TickType_t period, BaseType_t*) {
+    return xTimerChangePeriod(timer, period, 0);
+}
+
+inline void* pvTimerGetTimerID(TimerHandle_t timer) {
+    return timer->id;
+}
+
+inline BaseType_t xTimerIsTimerActive(TimerHandle_t timer) {
+    return timer->active ? pdTRUE : pdFALSE;
+}
@@ -0,0 +1,227 @@
+#include <unity.h>
+#include <initializer_list>
+#include "Arduino.h"
+#include "Config/acceleration_config.h"
+#include "Config/ConfigManager.h"
+#include "EncoderMode/Acceleration/AccelerationEngine.h"
+#include "Type/ConfigSnapshot.h"
+
+static AccelerationEngine engine;
+
+static AccelerationCurve table(std::initializer_list<AccelerationCurvePoint> points) {
+    AccelerationCurve curve = AccelerationCurve::none();
+    curve.type = AccelerationCurveType::TABLE;
+    for (const AccelerationCurvePoint& p : points) {
+        curve.points[curve.pointCount++] = p;
+    }
+    return curve;
+}
+
+/**
+ * @brief Turn steadily: count single detents intervalUs apart, return the summed output
+ */
+static int32_t spin(WheelMode mode, int count, uint64_t intervalUs, uint64_t& nowUs, int32_t detent = 1) {
+    int32_t total = 0;
+    for (int i = 0; i < count; i++) {
+        nowUs += intervalUs;
+        total += engine.apply(mode, detent, nowUs);
+    }
+    return total;
+}
+
+void setUp() {
+    engine = AccelerationEngine();
+}
+
+void tearDown() {}
+
+void test_none_passes_through() {
+    uint64_t now = 1000000;
+    TEST_ASSERT_EQUAL(50, spin(WheelMode::ZOOM, 50, 1000, now));
+    TEST_ASSERT_EQUAL(-3, engine.apply(WheelMode::ZOOM, -3, now + 1000));
+}
+
+void test_slow_turns_stay_exact() {
+    engine.setCurve(WheelMode::SCROLL, ACCEL_DEFAULT_SCROLL);
+    uint64_t now = 1000000;
+
+    // 5 det/s is under the 6 det/s threshold: gain stays exactly 1.0
+    TEST_ASSERT_EQUAL(20, spin(WheelMode::SCROLL, 20, 200000, now));
+    TEST_ASSERT_EQUAL(10, spin(WheelMode::SCROLL, 10, 140000, now));
+}
+
+void test_fast_spin_accelerates_and_caps() {
+    engine.setCurve(WheelMode::SCROLL, ACCEL_DEFAULT_SCROLL);
+    uint64_t now = 1000000;
+
+    int32_t out = spin(WheelMode::SCROLL, 20, 5000, now);  // 200 det/s
+    TEST_ASSERT_GREATER_THAN(20, out);
+
+    // Never more than the configured max gain per detent
+    TEST_ASSERT_LESS_OR_EQUAL(20 * 24, out);
+}
+
+void test_unknown_timestamp_passes_through() {
+    engine.setCurve(WheelMode::SCROLL, ACCEL_DEFAULT_SCROLL);
+    uint64_t now = 1000000;
+    spin(WheelMode::SCROLL, 10, 5000, now);
+
+    TEST_ASSERT_EQUAL(4, engine.apply(WheelMode::SCROLL, 4, 0));
+}
+
+void test_pause_restarts_at_unity() {
+    engine.setCurve(WheelMode::SCROLL, ACCEL_DEFAULT_SCROLL);
+    uint64_t now = 1000000;
+    spin(WheelMode::SCROLL, 20, 5000, now);
+
+    now += ACCEL_IDLE_RESET_US + 1;
+    TEST_ASSERT_EQUAL(1, engine.apply(WheelMode::SCROLL, 1, now));
+}
+
+void test_reversal_restarts_at_unity() {
+    engine.setCurve(WheelMode::SCROLL, ACCEL_DEFAULT_SCROLL);
+    uint64_t now = 1000000;
+    spin(WheelMode::SCROLL, 20, 5000, now);
+
+    now += 5000;
+    TEST_ASSERT_EQUAL(-1, engine.apply(WheelMode::SCROLL, -1, now));
+}
+
+void test_fraction_is_carried() {
+    // Flat 1.5x above 0 det/s: two detents must produce exactly three units
+    engine.setCurve(WheelMode::VOLUME, table({ {0, 384}, {1000, 384} }));
+    uint64_t now = 1000000;
+    TEST_ASSERT_EQUAL(1, engine.apply(WheelMode::VOLUME, 1, now));  // First detent has no velocity yet
+
+    int32_t total = spin(WheelMode::VOLUME, 10, 20000, now);
+    TEST_ASSERT_EQUAL(15, total);
+}
+
+void test_modes_keep_separate_state() {
+    engine.setCurve(WheelMode::SCROLL, ACCEL_DEFAULT_SCROLL);
+    engine.setCurve(WheelMode::VOLUME, ACCEL_DEFAULT_VOLUME);
+    uint64_t now = 1000000;
+    spin(WheelMode::SCROLL, 20, 5000, now);
+
+    // Volume has no history yet
+    TEST_ASSERT_EQUAL(1, engine.apply(WheelMode::VOLUME, 1, now + 5000));
+}
+
+void test_output_is_clamped_to_one_report() {
+    engine.setCurve(WheelMode::SCROLL, table({ {0, 60000}, {1, 60000} }));
+    uint64_t now = 1000000;
+    engine.apply(WheelMode::SCROLL, 1, now);
+
+    TEST_ASSERT_EQUAL(ACCEL_MAX_OUTPUT_DELTA, engine.apply(WheelMode::SCROLL, 10, now + 1000));
+}
+
+void test_gain_linear() {
+    AccelerationCurve curve = AccelerationCurve::linear(10, 8, 3 * 256);
+    TEST_ASSERT_EQUAL_UINT32(256, AccelerationEngine::gainForVelocity(curve, 5));
+    TEST_ASSERT_EQUAL_UINT32(256, AccelerationEngine::gainForVelocity(curve, 10));
+    TEST_ASSERT_EQUAL_UINT32(256 + 80, AccelerationEngine::gainForVelocity(curve, 20));
+    TEST_ASSERT_EQUAL_UINT32(3 * 256, AccelerationEngine::gainForVelocity(curve, 1000));
+}
+
+void test_gain_power() {
+    AccelerationCurve curve = AccelerationCurve::power(6, 20, 2, 24 * 256);
+    TEST_ASSERT_EQUAL_UINT32(256, AccelerationEngine::gainForVelocity(curve, 6));
+    TEST_ASSERT_EQUAL_UINT32(512, AccelerationEngine::gainForVelocity(curve, 26));   // x = 1: 1 + 1
+    TEST_ASSERT_EQUAL_UINT32(1280, AccelerationEngine::gainForVelocity(curve, 46));  // x = 2: 1 + 4
+    TEST_ASSERT_EQUAL_UINT32(24 * 256, AccelerationEngine::gainForVelocity(curve, 5000));
+}
+
+void test_gain_table_interpolates() {
+    AccelerationCurve curve = table({ {10, 256}, {20, 512}, {40, 1024} });
+    TEST_ASSERT_EQUAL_UINT32(256, AccelerationEngine::gainForVelocity(curve, 0));
+    TEST_ASSERT_EQUAL_UINT32(384, AccelerationEngine::gainForVelocity(curve, 15));
+    TEST_ASSERT_EQUAL_UINT32(768, AccelerationEngine::gainForVelocity(curve, 30));
+    TEST_ASSERT_EQUAL_UINT32(1024, AccelerationEngine::gainForVelocity(curve, 100));
+}
+
+void test_invalid_curve_falls_back_to_none() {
+    TEST_ASSERT_FALSE(AccelerationEngine::isValid(AccelerationCurve::power(6, 0, 2, 512)));
+    TEST_ASSERT_FALSE(AccelerationEngine::isValid(AccelerationCurve::power(6, 20, 5, 512)));
+    TEST_ASSERT_FALSE(AccelerationEngine::isValid(AccelerationCurve::linear(6, 20, 100)));
+    TEST_ASSERT_FALSE(AccelerationEngine::isValid(table({ {20, 256}, {10, 512} })));
+
+    engine.setCurve(WheelMode::SCROLL, AccelerationCurve::power(6, 0, 2, 512));
+    TEST_ASSERT_EQUAL(static_cast<int>(AccelerationCurveType::NONE),
+                      static_cast<int>(engine.getCurve(WheelMode::SCROLL).type));
+}
+
+void test_config_change_applies_on_next_event() {
+    ConfigSnapshot snapshot{};
+    for (uint8_t i = 0; i <= WheelMode_MAX; i++) {
+        snapshot.accelerationCurves[i] = AccelerationCurve::none();
+    }
+    snapshot.accelerationCurves[static_cast<uint8_t>(WheelMode::SCROLL)] = ACCEL_DEFAULT_SCROLL;
+
+    // Other changes leave the curves alone
+    engine.onConfigChanged(ConfigChange::WHEEL_MODE, snapshot);
+    uint64_t now = 1000000;
+    TEST_ASSERT_EQUAL(20, spin(WheelMode::SCROLL, 20, 5000, now));
+
+    // Queued on the writer's task, in use from the next event on
+    engine.onConfigChanged(ConfigChange::ACCELERATION, snapshot);
+    TEST_ASSERT_EQUAL(static_cast<int>(AccelerationCurveType::NONE),
+                      static_cast<int>(engine.getCurve(WheelMode::SCROLL).type));
+    TEST_ASSERT_GREATER_THAN(20, spin(WheelMode::SCROLL, 20, 5000, now));
+    TEST_ASSERT_EQUAL(static_cast<int>(AccelerationCurveType::POWER),
+                      static_cast<int>(engine.getCurve(WheelMode::SCROLL).type));
+}
+
+void test_uploaded_curve_is_saved_and_applied() {
+    HostNvs::erase();
+    Preferences preferences;
+    ConfigManager config(&preferences, nullptr);
+    config.begin();
+    engine.onConfigChanged(ConfigChange::ALL, config.getSnapshot());
+    config.subscribe(&engine);
+
+    AccelerationCurve curve = AccelerationCurve::linear(5, 64, 4 * ACCEL_GAIN_ONE_Q8);
+    uint8_t mode = static_cast<uint8_t>(WheelMode::ZOOM);
+    Stream console;
+    console.feed(&mode, 1);
+    console.feed(&curve, sizeof(curve));
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::OK), static_cast<int>(engine.receiveCurve(console, config)));
+
+    AccelerationCurve stored;
+    config.loadAccelerationCurve(WheelMode::ZOOM, stored);
+    TEST_ASSERT_EQUAL_MEMORY(&curve, &stored, sizeof(curve));
+    TEST_ASSERT_FALSE(config.isDirty());  // Flushed before reporting success
+
+    uint64_t now = 1000000;
+    TEST_ASSERT_GREATER_THAN(20, spin(WheelMode::ZOOM, 20, 5000, now));
+
+    // Invalid or truncated uploads change nothing
+    AccelerationCurve invalid = AccelerationCurve::power(6, 0, 2, 512);
+    console.feed(&mode, 1);
+    console.feed(&invalid, sizeof(invalid));
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::INVALID_PARAM), static_cast<int>(engine.receiveCurve(console, config)));
+    console.feed(&mode, 1);
+    console.feed(&curve, sizeof(curve) - 1);
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::INVALID_PARAM), static_cast<int>(engine.receiveCurve(console, config)));
+    config.loadAccelerationCurve(WheelMode::ZOOM, stored);
+    TEST_ASSERT_EQUAL_MEMORY(&curve, &stored, sizeof(curve));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_none_passes_through);
+    RUN_TEST(test_slow_turns_stay_exact);
+    RUN_TEST(test_fast_spin_accelerates_and_caps);
+    RUN_TEST(test_unknown_timestamp_passes_through);
+    RUN_TEST(test_pause_restarts_at_unity);
+    RUN_TEST(test_reversal_restarts_at_unity);
+    RUN_TEST(test_fraction_is_carried);
+    RUN_TEST(test_modes_keep_separate_state);
+    RUN_TEST(test_output_is_clamped_to_one_report);
+    RUN_TEST(test_gain_linear);
+    RUN_TEST(test_gain_power);
+    RUN_TEST(test_gain_table_interpolates);
+    RUN_TEST(test_invalid_curve_falls_back_to_none);
+    RUN_TEST(test_config_change_applies_on_next_event);
+    RUN_TEST(test_uploaded_curve_is_saved_and_applied);
+    return UNITY_END();
+}
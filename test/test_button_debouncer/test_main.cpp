@@ -0,0 +1,163 @@
+#include <unity.h>
+#include "ButtonDebouncer.h"
+#include "GestureInput.h"
+
+using Event = ButtonDebounceEvent::Type;
+
+static constexpr uint32_t DEBOUNCE_MS = 50;
+static constexpr uint32_t HOLD_MS = 1000;
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_clean_press_and_release() {
+    ButtonDebouncer debouncer(DEBOUNCE_MS, HOLD_MS);
+    debouncer.reset(false, 0);
+    ButtonDebounceEvent out;
+
+    TEST_ASSERT_EQUAL_UINT32(DEBOUNCE_MS, debouncer.onEdge(100));
+    TEST_ASSERT_EQUAL_UINT32(HOLD_MS - DEBOUNCE_MS, debouncer.onSettle(true, 150, out));
+    TEST_ASSERT_EQUAL(static_cast<int>(Event::PRESS), static_cast<int>(out.type));
+    TEST_ASSERT_EQUAL_UINT32(100, out.timestampMs);
+    TEST_ASSERT_TRUE(debouncer.isDown());
+
+    debouncer.onEdge(400);
+    TEST_ASSERT_EQUAL_UINT32(0, debouncer.onSettle(false, 450, out));
+    TEST_ASSERT_EQUAL(static_cast<int>(Event::RELEASE), static_cast<int>(out.type));
+    TEST_ASSERT_EQUAL_UINT32(400, out.timestampMs);
+    TEST_ASSERT_EQUAL_UINT32(300, out.durationMs);
+    TEST_ASSERT_FALSE(debouncer.isDown());
+}
+
+void test_bounce_extends_the_window() {
+    ButtonDebouncer debouncer(DEBOUNCE_MS, HOLD_MS);
+    debouncer.reset(false, 0);
+    ButtonDebounceEvent out;
+
+    debouncer.onEdge(100);
+    debouncer.onEdge(110);
+    debouncer.onEdge(130);
+
+    // Deadline from the first edge fires early: wait for the rest of the quiet time
+    TEST_ASSERT_EQUAL_UINT32(30, debouncer.onSettle(true, 150, out));
+    TEST_ASSERT_EQUAL(static_cast<int>(Event::NONE), static_cast<int>(out.type));
+
+    debouncer.onSettle(true, 180, out);
+    TEST_ASSERT_EQUAL(static_cast<int>(Event::PRESS), static_cast<int>(out.type));
+    TEST_ASSERT_EQUAL_UINT32(100, out.timestampMs);  // Press time is the first edge
+}
+
+void test_glitch_settles_back_without_event() {
+    ButtonDebouncer debouncer(DEBOUNCE_MS, HOLD_MS);
+    debouncer.reset(false, 0);
+    ButtonDebounceEvent out;
+
+    debouncer.onEdge(100);
+    debouncer.onEdge(105);
+    TEST_ASSERT_EQUAL_UINT32(0, debouncer.onSettle(false, 155, out));
+    TEST_ASSERT_EQUAL(static_cast<int>(Event::NONE), static_cast<int>(out.type));
+    TEST_ASSERT_EQUAL(static_cast<int>(ButtonDebouncer::State::IDLE), static_cast<int>(debouncer.getState()));
+}
+
+void test_glitch_while_pressed_keeps_hold_deadline() {
+    ButtonDebouncer debouncer(DEBOUNCE_MS, HOLD_MS);
+    debouncer.reset(false, 0);
+    ButtonDebounceEvent out;
+
+    debouncer.onEdge(0);
+    debouncer.onSettle(true, 50, out);
+
+    debouncer.onEdge(300);
+    TEST_ASSERT_EQUAL_UINT32(HOLD_MS - 350, debouncer.onSettle(true, 350, out));
+    TEST_ASSERT_EQUAL(static_cast<int>(Event::NONE), static_cast<int>(out.type));
+    TEST_ASSERT_TRUE(debouncer.isDown());
+}
+
+void test_held_after_hold_time() {
+    ButtonDebouncer debouncer(DEBOUNCE_MS, HOLD_MS);
+    debouncer.reset(false, 0);
+    ButtonDebounceEvent out;
+
+    debouncer.onEdge(0);
+    debouncer.onSettle(true, 50, out);
+
+    TEST_ASSERT_EQUAL_UINT32(HOLD_MS - 900, debouncer.onSettle(true, 900, out));
+    TEST_ASSERT_EQUAL(static_cast<int>(Event::NONE), static_cast<int>(out.type));
+
+    TEST_ASSERT_EQUAL_UINT32(0, debouncer.onSettle(true, HOLD_MS, out));
+    TEST_ASSERT_EQUAL(static_cast<int>(Event::HELD), static_cast<int>(out.type));
+    TEST_ASSERT_EQUAL_UINT32(HOLD_MS, out.timestampMs);
+
+    debouncer.onEdge(1500);
+    debouncer.onSettle(false, 1550, out);
+    TEST_ASSERT_EQUAL(static_cast<int>(Event::RELEASE), static_cast<int>(out.type));
+    TEST_ASSERT_EQUAL_UINT32(1500, out.durationMs);
+}
+
+void test_zero_hold_schedules_nothing() {
+    ButtonDebouncer debouncer(DEBOUNCE_MS, 0);
+    debouncer.reset(false, 0);
+    ButtonDebounceEvent out;
+
+    debouncer.onEdge(0);
+    TEST_ASSERT_EQUAL_UINT32(0, debouncer.onSettle(true, 50, out));
+    TEST_ASSERT_EQUAL(static_cast<int>(Event::PRESS), static_cast<int>(out.type));
+
+    TEST_ASSERT_EQUAL_UINT32(0, debouncer.onSettle(true, 5000, out));
+    TEST_ASSERT_EQUAL(static_cast<int>(Event::NONE), static_cast<int>(out.type));
+    TEST_ASSERT_EQUAL(static_cast<int>(ButtonDebouncer::State::PRESSED), static_cast<int>(debouncer.getState()));
+}
+
+void test_reset_pressed_at_boot() {
+    ButtonDebouncer debouncer(DEBOUNCE_MS, HOLD_MS);
+    debouncer.reset(true, 0);
+    ButtonDebounceEvent out;
+
+    TEST_ASSERT_TRUE(debouncer.isDown());
+    debouncer.onEdge(200);
+    debouncer.onSettle(false, 250, out);
+    TEST_ASSERT_EQUAL(static_cast<int>(Event::RELEASE), static_cast<int>(out.type));
+}
+
+void test_gesture_input_click_only_sleeps_while_held() {
+    GestureInput input(DEBOUNCE_MS, GestureConfig{0, 0, 1, 0, 0});
+    input.reset(false, 0);
+    GestureEvent events[GestureInput::MAX_EVENTS_PER_UPDATE];
+    uint8_t count;
+
+    input.onEdge(0);
+    TEST_ASSERT_EQUAL_UINT32(0, input.update(true, 50, events, count));
+    TEST_ASSERT_EQUAL(1, count);
+    TEST_ASSERT_EQUAL(static_cast<int>(GestureEvent::Type::CLICK), static_cast<int>(events[0].type));
+}
+
+void test_gesture_input_long_press_deadline_comes_from_engine() {
+    GestureInput input(DEBOUNCE_MS, GestureConfig{800, 0, 1, 0, 0});
+    input.reset(false, 0);
+    GestureEvent events[GestureInput::MAX_EVENTS_PER_UPDATE];
+    uint8_t count;
+
+    input.onEdge(0);
+    // One wakeup, at the engine's long-press deadline (press edge + 800 ms)
+    TEST_ASSERT_EQUAL_UINT32(750, input.update(true, 50, events, count));
+    TEST_ASSERT_EQUAL(0, count);
+
+    TEST_ASSERT_EQUAL_UINT32(0, input.update(true, 800, events, count));
+    TEST_ASSERT_EQUAL(1, count);
+    TEST_ASSERT_EQUAL(static_cast<int>(GestureEvent::Type::LONG_PRESS), static_cast<int>(events[0].type));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_clean_press_and_release);
+    RUN_TEST(test_bounce_extends_the_window);
+    RUN_TEST(test_glitch_settles_back_without_event);
+    RUN_TEST(test_glitch_while_pressed_keeps_hold_deadline);
+    RUN_TEST(test_held_after_hold_time);
+    RUN_TEST(test_zero_hold_schedules_nothing);
+    RUN_TEST(test_reset_pressed_at_boot);
+    RUN_TEST(test_gesture_input_click_only_sleeps_while_held);
+    RUN_TEST(test_gesture_input_long_press_deadline_comes_from_engine);
+    return UNITY_END();
+}
@@ -0,0 +1,179 @@
+#include <unity.h>
+#include <string.h>
+#include <vector>
+#include "Config/ConfigRecord.h"
+#include "Config/ConfigManager.h"
+
+static constexpr uint8_t MACROS = ConfigRecord::MACRO_COUNT;
+
+static uint8_t record[ConfigRecord::MAX_BYTES];
+static MacroProgram programs[MACROS];
+
+static ConfigSnapshot sampleSnapshot() {
+    ConfigSnapshot config{};
+    config.wheelMode = WheelMode::ZOOM;
+    config.wheelDirection = WheelDirection::REVERSED;
+    config.zoomStrategy = ZoomStrategy::AC_ZOOM;
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        config.buttonActions[i] = static_cast<uint8_t>(i + 1);
+    }
+    for (uint8_t i = 0; i < MACROS; i++) {
+        config.macros[i] = static_cast<uint16_t>(0x0100 | (0x04 + i));
+    }
+    config.accelerationCurves[0] = AccelerationCurve::linear(10, 8, 3 * ACCEL_GAIN_ONE_Q8);
+    config.accelerationCurves[1] = AccelerationCurve::power(6, 20, 2, 24 * ACCEL_GAIN_ONE_Q8);
+    return config;
+}
+
+static ConfigSnapshot blankSnapshot() {
+    ConfigSnapshot config{};
+    for (uint8_t i = 0; i <= WheelMode_MAX; i++) {
+        config.accelerationCurves[i] = AccelerationCurve::none();
+    }
+    return config;
+}
+
+static void fillProgram(MacroProgram& program, uint16_t length, uint8_t seed) {
+    program.length = length;
+    for (uint16_t i = 0; i < length; i++) {
+        program.code[i] = static_cast<uint8_t>(seed + i);
+    }
+}
+
+static void assertSnapshotsEqual(const ConfigSnapshot& expected, const ConfigSnapshot& actual) {
+    TEST_ASSERT_EQUAL(static_cast<int>(expected.wheelMode), static_cast<int>(actual.wheelMode));
+    TEST_ASSERT_EQUAL(static_cast<int>(expected.wheelDirection), static_cast<int>(actual.wheelDirection));
+    TEST_ASSERT_EQUAL(static_cast<int>(expected.zoomStrategy), static_cast<int>(actual.zoomStrategy));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.buttonActions, actual.buttonActions, BUTTON_COUNT);
+    TEST_ASSERT_EQUAL_MEMORY(expected.macros, actual.macros, sizeof(expected.macros));
+    TEST_ASSERT_EQUAL_MEMORY(expected.accelerationCurves, actual.accelerationCurves,
+                             sizeof(expected.accelerationCurves));
+}
+
+/**
+ * @brief Store a valid record whose schema is one ahead of this firmware
+ */
+static std::vector<uint8_t> storeNewerRecord() {
+    size_t length = ConfigRecord::write(sampleSnapshot(), programs, record, sizeof(record));
+    uint16_t newer = ConfigRecord::SCHEMA_VERSION + 1;
+    record[4] = static_cast<uint8_t>(newer);
+    record[5] = static_cast<uint8_t>(newer >> 8);  // Header is outside the CRC
+
+    std::vector<uint8_t> blob(record, record + length);
+    HostNvs::storage[NVS_NAMESPACE][KEY_CONFIG_RECORD] = blob;
+    return blob;
+}
+
+void setUp() {
+    memset(programs, 0, sizeof(programs));
+    HostNvs::erase();
+}
+
+void tearDown() {}
+
+void test_crc32_check_value() {
+    const char* check = "123456789";
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, ConfigRecord::crc32(reinterpret_cast<const uint8_t*>(check), 9));
+    TEST_ASSERT_EQUAL_HEX32(0x00000000, ConfigRecord::crc32(nullptr, 0));
+}
+
+void test_round_trip_restores_every_field() {
+    ConfigSnapshot written = sampleSnapshot();
+    fillProgram(programs[0], 5, 0x10);
+    fillProgram(programs[MACROS - 1], MACRO_PROGRAM_MAX_BYTES, 0x80);
+
+    size_t length = ConfigRecord::write(written, programs, record, sizeof(record));
+    TEST_ASSERT_GREATER_THAN(ConfigRecord::HEADER_BYTES, length);
+
+    ConfigSnapshot read = blankSnapshot();
+    MacroProgram readPrograms[MACROS] = {};
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::OK),
+                      static_cast<int>(ConfigRecord::read(record, length, read, readPrograms)));
+
+    assertSnapshotsEqual(written, read);
+    for (uint8_t i = 0; i < MACROS; i++) {
+        TEST_ASSERT_EQUAL_UINT16(programs[i].length, readPrograms[i].length);
+        TEST_ASSERT_EQUAL_MEMORY(programs[i].code, readPrograms[i].code, programs[i].length);
+    }
+}
+
+void test_corrupt_records_are_rejected() {
+    ConfigSnapshot written = sampleSnapshot();
+    fillProgram(programs[0], 5, 0x10);
+    size_t length = ConfigRecord::write(written, programs, record, sizeof(record));
+
+    const ConfigSnapshot untouched = blankSnapshot();
+    ConfigSnapshot read = untouched;
+
+    uint8_t corrupt[sizeof(record)];
+    memcpy(corrupt, record, length);
+    corrupt[0] ^= 0xFF;  // Magic
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::INVALID_PARAM),
+                      static_cast<int>(ConfigRecord::read(corrupt, length, read, programs)));
+
+    memcpy(corrupt, record, length);
+    corrupt[length - 1] ^= 0x01;  // Payload byte: CRC mismatch
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::INVALID_PARAM),
+                      static_cast<int>(ConfigRecord::read(corrupt, length, read, programs)));
+
+    // Truncated: header claims more payload than was read
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::INVALID_PARAM),
+                      static_cast<int>(ConfigRecord::read(record, length - 1, read, programs)));
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::INVALID_PARAM),
+                      static_cast<int>(ConfigRecord::read(record, ConfigRecord::HEADER_BYTES - 1, read, programs)));
+
+    assertSnapshotsEqual(untouched, read);
+}
+
+void test_newer_schema_is_reported() {
+    storeNewerRecord();
+    ConfigSnapshot read = blankSnapshot();
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::INVALID_STATE),
+                      static_cast<int>(ConfigRecord::read(record, sizeof(record), read, programs)));
+}
+
+void test_worst_case_size_fits_max_bytes() {
+    ConfigSnapshot written = sampleSnapshot();
+    for (uint8_t i = 0; i < MACROS; i++) {
+        fillProgram(programs[i], MACRO_PROGRAM_MAX_BYTES, i);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(ConfigRecord::MAX_BYTES,
+                             ConfigRecord::write(written, programs, record, ConfigRecord::MAX_BYTES));
+    TEST_ASSERT_EQUAL_UINT32(0, ConfigRecord::write(written, programs, record, ConfigRecord::MAX_BYTES - 1));
+}
+
+void test_manager_keeps_newer_record_read_only() {
+    std::vector<uint8_t> stored = storeNewerRecord();
+
+    Preferences preferences;
+    ConfigManager config(&preferences, nullptr);
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::NVS_READ_FAIL), static_cast<int>(config.begin()));
+    TEST_ASSERT_TRUE(config.isReadOnly());
+    TEST_ASSERT_EQUAL(static_cast<int>(WheelMode::SCROLL), static_cast<int>(config.loadWheelMode()));
+
+    // Applies until reboot, but is never written over the newer record
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::OK), static_cast<int>(config.saveWheelMode(WheelMode::VOLUME)));
+    TEST_ASSERT_EQUAL(static_cast<int>(WheelMode::VOLUME), static_cast<int>(config.loadWheelMode()));
+    TEST_ASSERT_FALSE(config.isDirty());
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::OK), static_cast<int>(config.flush()));
+    TEST_ASSERT_EQUAL_UINT32(0, HostNvs::writes);
+    TEST_ASSERT_TRUE(stored == HostNvs::storage[NVS_NAMESPACE][KEY_CONFIG_RECORD]);
+
+    // Erasing the record lifts read-only mode
+    TEST_ASSERT_EQUAL(static_cast<int>(Error::OK), static_cast<int>(config.clearAll()));
+    TEST_ASSERT_FALSE(config.isReadOnly());
+    config.saveWheelMode(WheelMode::VOLUME);
+    TEST_ASSERT_TRUE(config.isDirty());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_crc32_check_value);
+    RUN_TEST(test_round_trip_restores_every_field);
+    RUN_TEST(test_corrupt_records_are_rejected);
+    RUN_TEST(test_newer_schema_is_reported);
+    RUN_TEST(test_worst_case_size_fits_max_bytes);
+    RUN_TEST(test_manager_keeps_newer_record_read_only);
+    return UNITY_END();
+}
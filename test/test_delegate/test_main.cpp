@@ -0,0 +1,150 @@
+/**
+ * @brief Delegate behaviour and a Delegate vs std::function microbenchmark
+ *
+ * The benchmark calls both through a non-inlined dispatcher so the compiler
+ * cannot see the target, and counts heap allocations made while binding a
+ * capture the size of a driver callback ([this, index]). Flash size on the
+ * device is compared with `pio run -e use_nimble -t size`.
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include "Delegate.h"
+
+static constexpr int BENCH_CALLS = 20000000;
+
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+    allocations++;
+    void* p = malloc(size);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+struct Counter {
+    int32_t total = 0;
+
+    void add(int32_t delta, uint64_t timestampUs) {
+        total += delta + static_cast<int32_t>(timestampUs & 1);
+    }
+};
+
+using RotateDelegate = Delegate<void(int32_t, uint64_t)>;
+using RotateFunction = std::function<void(int32_t, uint64_t)>;
+
+template <typename Callback>
+__attribute__((noinline)) static void dispatch(const Callback& callback, int calls) {
+    for (int i = 0; i < calls; i++) {
+        callback(1, static_cast<uint64_t>(i));
+    }
+}
+
+template <typename Callback>
+static double nsPerCall(const Callback& callback) {
+    dispatch(callback, BENCH_CALLS / 10);  // Warm up
+    auto start = std::chrono::steady_clock::now();
+    dispatch(callback, BENCH_CALLS);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / BENCH_CALLS;
+}
+
+static int32_t freeTotal = 0;
+
+static void freeAdd(int32_t delta, uint64_t) {
+    freeTotal += delta;
+}
+
+void setUp() {
+    allocations = 0;
+}
+
+void tearDown() {}
+
+void test_empty_delegate_is_false() {
+    RotateDelegate empty;
+    RotateDelegate null(nullptr);
+    TEST_ASSERT_FALSE(static_cast<bool>(empty));
+    TEST_ASSERT_FALSE(static_cast<bool>(null));
+}
+
+void test_free_function_and_capture() {
+    freeTotal = 0;
+    RotateDelegate plain(&freeAdd);
+    plain(3, 0);
+    TEST_ASSERT_EQUAL(3, freeTotal);
+
+    int32_t sum = 0;
+    int32_t* target = &sum;
+    int index = 2;
+    RotateDelegate captured([target, index](int32_t delta, uint64_t) { *target += delta * index; });
+    captured(5, 0);
+    TEST_ASSERT_EQUAL(10, sum);
+}
+
+void test_bound_member_and_copy() {
+    Counter counter;
+    RotateDelegate bound = RotateDelegate::bind<Counter, &Counter::add>(&counter);
+    RotateDelegate copy = bound;
+    bound(4, 0);
+    copy(4, 1);
+    TEST_ASSERT_EQUAL(9, counter.total);
+    TEST_ASSERT_EQUAL(0, static_cast<int>(allocations));
+}
+
+void test_benchmark_call_overhead() {
+    Counter counter;
+    Counter* self = &counter;
+    int index = 1;
+    auto lambda = [self, index](int32_t delta, uint64_t timestampUs) { self->add(delta * index, timestampUs); };
+
+    allocations = 0;
+    RotateDelegate delegate(lambda);
+    size_t delegateAllocations = allocations;
+
+    allocations = 0;
+    RotateFunction function(lambda);
+    size_t functionAllocations = allocations;
+
+    RotateDelegate member = RotateDelegate::bind<Counter, &Counter::add>(&counter);
+    RotateFunction memberFunction = std::bind(&Counter::add, &counter, std::placeholders::_1, std::placeholders::_2);
+
+    double delegateNs = nsPerCall(delegate);
+    double functionNs = nsPerCall(function);
+    double memberNs = nsPerCall(member);
+    double memberFunctionNs = nsPerCall(memberFunction);
+
+    printf("\n%d calls each\n", BENCH_CALLS);
+    printf("  %-34s %6.2f ns/call, %2u bytes, %u allocations\n", "Delegate (lambda [this, index])",
+           delegateNs, static_cast<unsigned>(sizeof(RotateDelegate)), static_cast<unsigned>(delegateAllocations));
+    printf("  %-34s %6.2f ns/call, %2u bytes, %u allocations\n", "std::function (same lambda)",
+           functionNs, static_cast<unsigned>(sizeof(RotateFunction)), static_cast<unsigned>(functionAllocations));
+    printf("  %-34s %6.2f ns/call\n", "Delegate::bind (member)", memberNs);
+    printf("  %-34s %6.2f ns/call\n", "std::function (std::bind member)", memberFunctionNs);
+
+    TEST_ASSERT_EQUAL(0, static_cast<int>(delegateAllocations));
+    TEST_ASSERT_TRUE(counter.total != 0);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_delegate_is_false);
+    RUN_TEST(test_free_function_and_capture);
+    RUN_TEST(test_bound_member_and_copy);
+    RUN_TEST(test_benchmark_call_overhead);
+    return UNITY_END();
+}
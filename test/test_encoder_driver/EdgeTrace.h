@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief A/B edge trace in logic-analyzer export form: time, level of A, level of B
+ *
+ * Reference session for the encoder replay test, one entry per edge the
+ * GPIO interrupt would see (the first entry is the idle level):
+ *   1. 8 detents up at 10 det/s with contact chatter on A (change, back, change)
+ *   2. a flick of 60 detents up at 1000 det/s (edges 250 us apart)
+ *   3. 20 detents down at 200 det/s, chatter on A again
+ * Net movement is EDGE_TRACE_DETENTS with ENCODER_STEPS = 4.
+ */
+struct EdgeSample {
+    uint32_t timeUs;
+    uint8_t a;
+    uint8_t b;
+};
+
+constexpr int32_t EDGE_TRACE_DETENTS = 8 + 60 - 20;
+constexpr uint32_t EDGE_TRACE_FLICK_START_US = 1001000;  ///< First edge of the flick
+constexpr uint32_t EDGE_TRACE_FLICK_END_US = 1061000;
+
+static const EdgeSample EDGE_TRACE[] = {
+    {0, 0, 0},
+    {26000, 0, 1}, {51000, 1, 1}, {51015, 0, 1}, {51040, 1, 1}, {76000, 1, 0}, {101000, 0, 0},
+    {101015, 1, 0}, {101040, 0, 0}, {126000, 0, 1}, {151000, 1, 1}, {151015, 0, 1}, {151040, 1, 1},
+    {176000, 1, 0}, {201000, 0, 0}, {201015, 1, 0}, {201040, 0, 0}, {226000, 0, 1}, {251000, 1, 1},
+    {251015, 0, 1}, {251040, 1, 1}, {276000, 1, 0}, {301000, 0, 0}, {301015, 1, 0}, {301040, 0, 0},
+    {326000, 0, 1}, {351000, 1, 1}, {351015, 0, 1}, {351040, 1, 1}, {376000, 1, 0}, {401000, 0, 0},
+    {401015, 1, 0}, {401040, 0, 0}, {426000, 0, 1}, {451000, 1, 1}, {451015, 0, 1}, {451040, 1, 1},
+    {476000, 1, 0}, {501000, 0, 0}, {501015, 1, 0}, {501040, 0, 0}, {526000, 0, 1}, {551000, 1, 1},
+    {551015, 0, 1}, {551040, 1, 1}, {576000, 1, 0}, {601000, 0, 0}, {601015, 1, 0}, {601040, 0, 0},
+    {626000, 0, 1}, {651000, 1, 1}, {651015, 0, 1}, {651040, 1, 1}, {676000, 1, 0}, {701000, 0, 0},
+    {701015, 1, 0}, {701040, 0, 0}, {726000, 0, 1}, {751000, 1, 1}, {751015, 0, 1}, {751040, 1, 1},
+    {776000, 1, 0}, {801000, 0, 0}, {801015, 1, 0}, {801040, 0, 0}, {1001250, 0, 1}, {1001500, 1, 1},
+    {1001750, 1, 0}, {1002000, 0, 0}, {1002250, 0, 1}, {1002500, 1, 1}, {1002750, 1, 0}, {1003000, 0, 0},
+    {1003250, 0, 1}, {1003500, 1, 1}, {1003750, 1, 0}, {1004000, 0, 0}, {1004250, 0, 1}, {1004500, 1, 1},
+    {1004750, 1, 0}, {1005000, 0, 0}, {1005250, 0, 1}, {1005500, 1, 1}, {1005750, 1, 0}, {1006000, 0, 0},
+    {1006250, 0, 1}, {1006500, 1, 1}, {1006750, 1, 0}, {1007000, 0, 0}, {1007250, 0, 1}, {1007500, 1, 1},
+    {1007750, 1, 0}, {1008000, 0, 0}, {1008250, 0, 1}, {1008500, 1, 1}, {1008750, 1, 0}, {1009000, 0, 0},
+    {1009250, 0, 1}, {1009500, 1, 1}, {1009750, 1, 0}, {1010000, 0, 0}, {1010250, 0, 1}, {1010500, 1, 1},
+    {1010750, 1, 0}, {1011000, 0, 0}, {1011250, 0, 1}, {1011500, 1, 1}, {1011750, 1, 0}, {1012000, 0, 0},
+    {1012250, 0, 1}, {1012500, 1, 1}, {1012750, 1, 0}, {1013000, 0, 0}, {1013250, 0, 1}, {1013500, 1, 1},
+    {1013750, 1, 0}, {1014000, 0, 0}, {1014250, 0, 1}, {1014500, 1, 1}, {1014750, 1, 0}, {1015000, 0, 0},
+    {1015250, 0, 1}, {1015500, 1, 1}, {1015750, 1, 0}, {1016000, 0, 0}, {1016250, 0, 1}, {1016500, 1, 1},
+    {1016750, 1, 0}, {1017000, 0, 0}, {1017250, 0, 1}, {1017500, 1, 1}, {1017750, 1, 0}, {1018000, 0, 0},
+    {1018250, 0, 1}, {1018500, 1, 1}, {1018750, 1, 0}, {1019000, 0, 0}, {1019250, 0, 1}, {1019500, 1, 1},
+    {1019750, 1, 0}, {1020000, 0, 0}, {1020250, 0, 1}, {1020500, 1, 1}, {1020750, 1, 0}, {1021000, 0, 0},
+    {1021250, 0, 1}, {1021500, 1, 1}, {1021750, 1, 0}, {1022000, 0, 0}, {1022250, 0, 1}, {1022500, 1, 1},
+    {1022750, 1, 0}, {1023000, 0, 0}, {1023250, 0, 1}, {1023500, 1, 1}, {1023750, 1, 0}, {1024000, 0, 0},
+    {1024250, 0, 1}, {1024500, 1, 1}, {1024750, 1, 0}, {1025000, 0, 0}, {1025250, 0, 1}, {1025500, 1, 1},
+    {1025750, 1, 0}, {1026000, 0, 0}, {1026250, 0, 1}, {1026500, 1, 1}, {1026750, 1, 0}, {1027000, 0, 0},
+    {1027250, 0, 1}, {1027500, 1, 1}, {1027750, 1, 0}, {1028000, 0, 0}, {1028250, 0, 1}, {1028500, 1, 1},
+    {1028750, 1, 0}, {1029000, 0, 0}, {1029250, 0, 1}, {1029500, 1, 1}, {1029750, 1, 0}, {1030000, 0, 0},
+    {1030250, 0, 1}, {1030500, 1, 1}, {1030750, 1, 0}, {1031000, 0, 0}, {1031250, 0, 1}, {1031500, 1, 1},
+    {1031750, 1, 0}, {1032000, 0, 0}, {1032250, 0, 1}, {1032500, 1, 1}, {1032750, 1, 0}, {1033000, 0, 0},
+    {1033250, 0, 1}, {1033500, 1, 1}, {1033750, 1, 0}, {1034000, 0, 0}, {1034250, 0, 1}, {1034500, 1, 1},
+    {1034750, 1, 0}, {1035000, 0, 0}, {1035250, 0, 1}, {1035500, 1, 1}, {1035750, 1, 0}, {1036000, 0, 0},
+    {1036250, 0, 1}, {1036500, 1, 1}, {1036750, 1, 0}, {1037000, 0, 0}, {1037250, 0, 1}, {1037500, 1, 1},
+    {1037750, 1, 0}, {1038000, 0, 0}, {1038250, 0, 1}, {1038500, 1, 1}, {1038750, 1, 0}, {1039000, 0, 0},
+    {1039250, 0, 1}, {1039500, 1, 1}, {1039750, 1, 0}, {1040000, 0, 0}, {1040250, 0, 1}, {1040500, 1, 1},
+    {1040750, 1, 0}, {1041000, 0, 0}, {1041250, 0, 1}, {1041500, 1, 1}, {1041750, 1, 0}, {1042000, 0, 0},
+    {1042250, 0, 1}, {1042500, 1, 1}, {1042750, 1, 0}, {1043000, 0, 0}, {1043250, 0, 1}, {1043500, 1, 1},
+    {1043750, 1, 0}, {1044000, 0, 0}, {1044250, 0, 1}, {1044500, 1, 1}, {1044750, 1, 0}, {1045000, 0, 0},
+    {1045250, 0, 1}, {1045500, 1, 1}, {1045750, 1, 0}, {1046000, 0, 0}, {1046250, 0, 1}, {1046500, 1, 1},
+    {1046750, 1, 0}, {1047000, 0, 0}, {1047250, 0, 1}, {1047500, 1, 1}, {1047750, 1, 0}, {1048000, 0, 0},
+    {1048250, 0, 1}, {1048500, 1, 1}, {1048750, 1, 0}, {1049000, 0, 0}, {1049250, 0, 1}, {1049500, 1, 1},
+    {1049750, 1, 0}, {1050000, 0, 0}, {1050250, 0, 1}, {1050500, 1, 1}, {1050750, 1, 0}, {1051000, 0, 0},
+    {1051250, 0, 1}, {1051500, 1, 1}, {1051750, 1, 0}, {1052000, 0, 0}, {1052250, 0, 1}, {1052500, 1, 1},
+    {1052750, 1, 0}, {1053000, 0, 0}, {1053250, 0, 1}, {1053500, 1, 1}, {1053750, 1, 0}, {1054000, 0, 0},
+    {1054250, 0, 1}, {1054500, 1, 1}, {1054750, 1, 0}, {1055000, 0, 0}, {1055250, 0, 1}, {1055500, 1, 1},
+    {1055750, 1, 0}, {1056000, 0, 0}, {1056250, 0, 1}, {1056500, 1, 1}, {1056750, 1, 0}, {1057000, 0, 0},
+    {1057250, 0, 1}, {1057500, 1, 1}, {1057750, 1, 0}, {1058000, 0, 0}, {1058250, 0, 1}, {1058500, 1, 1},
+    {1058750, 1, 0}, {1059000, 0, 0}, {1059250, 0, 1}, {1059500, 1, 1}, {1059750, 1, 0}, {1060000, 0, 0},
+    {1060250, 0, 1}, {1060500, 1, 1}, {1060750, 1, 0}, {1061000, 0, 0}, {1362250, 1, 0}, {1362265, 0, 0},
+    {1362290, 1, 0}, {1363500, 1, 1}, {1364750, 0, 1}, {1364765, 1, 1}, {1364790, 0, 1}, {1366000, 0, 0},
+    {1367250, 1, 0}, {1367265, 0, 0}, {1367290, 1, 0}, {1368500, 1, 1}, {1369750, 0, 1}, {1369765, 1, 1},
+    {1369790, 0, 1}, {1371000, 0, 0}, {1372250, 1, 0}, {1372265, 0, 0}, {1372290, 1, 0}, {1373500, 1, 1},
+    {1374750, 0, 1}, {1374765, 1, 1}, {1374790, 0, 1}, {1376000, 0, 0}, {1377250, 1, 0}, {1377265, 0, 0},
+    {1377290, 1, 0}, {1378500, 1, 1}, {1379750, 0, 1}, {1379765, 1, 1}, {1379790, 0, 1}, {1381000, 0, 0},
+    {1382250, 1, 0}, {1382265, 0, 0}, {1382290, 1, 0}, {1383500, 1, 1}, {1384750, 0, 1}, {1384765, 1, 1},
+    {1384790, 0, 1}, {1386000, 0, 0}, {1387250, 1, 0}, {1387265, 0, 0}, {1387290, 1, 0}, {1388500, 1, 1},
+    {1389750, 0, 1}, {1389765, 1, 1}, {1389790, 0, 1}, {1391000, 0, 0}, {1392250, 1, 0}, {1392265, 0, 0},
+    {1392290, 1, 0}, {1393500, 1, 1}, {1394750, 0, 1}, {1394765, 1, 1}, {1394790, 0, 1}, {1396000, 0, 0},
+    {1397250, 1, 0}, {1397265, 0, 0}, {1397290, 1, 0}, {1398500, 1, 1}, {1399750, 0, 1}, {1399765, 1, 1},
+    {1399790, 0, 1}, {1401000, 0, 0}, {1402250, 1, 0}, {1402265, 0, 0}, {1402290, 1, 0}, {1403500, 1, 1},
+    {1404750, 0, 1}, {1404765, 1, 1}, {1404790, 0, 1}, {1406000, 0, 0}, {1407250, 1, 0}, {1407265, 0, 0},
+    {1407290, 1, 0}, {1408500, 1, 1}, {1409750, 0, 1}, {1409765, 1, 1}, {1409790, 0, 1}, {1411000, 0, 0},
+    {1412250, 1, 0}, {1412265, 0, 0}, {1412290, 1, 0}, {1413500, 1, 1}, {1414750, 0, 1}, {1414765, 1, 1},
+    {1414790, 0, 1}, {1416000, 0, 0}, {1417250, 1, 0}, {1417265, 0, 0}, {1417290, 1, 0}, {1418500, 1, 1},
+    {1419750, 0, 1}, {1419765, 1, 1}, {1419790, 0, 1}, {1421000, 0, 0}, {1422250, 1, 0}, {1422265, 0, 0},
+    {1422290, 1, 0}, {1423500, 1, 1}, {1424750, 0, 1}, {1424765, 1, 1}, {1424790, 0, 1}, {1426000, 0, 0},
+    {1427250, 1, 0}, {1427265, 0, 0}, {1427290, 1, 0}, {1428500, 1, 1}, {1429750, 0, 1}, {1429765, 1, 1},
+    {1429790, 0, 1}, {1431000, 0, 0}, {1432250, 1, 0}, {1432265, 0, 0}, {1432290, 1, 0}, {1433500, 1, 1},
+    {1434750, 0, 1}, {1434765, 1, 1}, {1434790, 0, 1}, {1436000, 0, 0}, {1437250, 1, 0}, {1437265, 0, 0},
+    {1437290, 1, 0}, {1438500, 1, 1}, {1439750, 0, 1}, {1439765, 1, 1}, {1439790, 0, 1}, {1441000, 0, 0},
+    {1442250, 1, 0}, {1442265, 0, 0}, {1442290, 1, 0}, {1443500, 1, 1}, {1444750, 0, 1}, {1444765, 1, 1},
+    {1444790, 0, 1}, {1446000, 0, 0}, {1447250, 1, 0}, {1447265, 0, 0}, {1447290, 1, 0}, {1448500, 1, 1},
+    {1449750, 0, 1}, {1449765, 1, 1}, {1449790, 0, 1}, {1451000, 0, 0}, {1452250, 1, 0}, {1452265, 0, 0},
+    {1452290, 1, 0}, {1453500, 1, 1}, {1454750, 0, 1}, {1454765, 1, 1}, {1454790, 0, 1}, {1456000, 0, 0},
+    {1457250, 1, 0}, {1457265, 0, 0}, {1457290, 1, 0}, {1458500, 1, 1}, {1459750, 0, 1}, {1459765, 1, 1},
+    {1459790, 0, 1}, {1461000, 0, 0},
+};
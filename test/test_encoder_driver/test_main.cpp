@@ -0,0 +1,293 @@
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "Config/encoder_config.h"
+#include "EdgeTrace.h"
+#include "EncoderDeltaRing.h"
+#include "QuadratureDecoder.h"
+
+// One detent on a 4-step encoder, pins as {a, b}: B leading counts up, A leading counts down
+static const uint8_t UP[4][2] = { {0, 1}, {1, 1}, {1, 0}, {0, 0} };
+static const uint8_t DOWN[4][2] = { {1, 0}, {1, 1}, {0, 1}, {0, 0} };
+
+static int feed(QuadratureDecoder& decoder, const uint8_t (*edges)[2], int count) {
+    int detents = 0;
+    for (int i = 0; i < count; i++) {
+        detents += decoder.update(edges[i][0], edges[i][1]);
+    }
+    return detents;
+}
+
+// Edge-to-event budget: notify to encoder task running, with nothing else ready at its priority
+static constexpr uint32_t TASK_WAKE_US = 100;
+// A higher-priority task (BLE, display flush) keeping the encoder task off the CPU
+static constexpr uint32_t STALL_US = 50000;
+
+/**
+ * @brief What the consumer saw when a trace was replayed
+ */
+struct ReplayResult {
+    int32_t decodedDetents = 0;   ///< Straight decoder output (ground truth)
+    int32_t consumedDetents = 0;  ///< Sum of deltas the task handed to onRotate
+    uint32_t events = 0;
+    uint32_t overflows = 0;
+    uint32_t maxLatencyUs = 0;    ///< Worst edge-to-event delay
+};
+
+/**
+ * @brief Replay edges through decoder (ISR), ring and consumer (task), as EncoderDriver wires them
+ *
+ * Each pushed detent notifies the task, which runs TASK_WAKE_US later, or
+ * when the stall window [stallFromUs, stallToUs) ends, and drains the
+ * ring; every delta is emitted at that run time.
+ */
+static ReplayResult replay(const EdgeSample* edges, size_t count, uint32_t stallFromUs = 0, uint32_t stallToUs = 0) {
+    ReplayResult result;
+    QuadratureDecoder isrDecoder(ENCODER_STEPS);
+    QuadratureDecoder truthDecoder(ENCODER_STEPS);
+    EncoderDeltaRing<ENCODER_DELTA_RING_CAPACITY> ring;
+    isrDecoder.reset(edges[0].a, edges[0].b);
+    truthDecoder.reset(edges[0].a, edges[0].b);
+
+    bool taskPending = false;
+    uint64_t taskRunUs = 0;
+    auto runTask = [&]() {
+        EncoderDelta out{};
+        while (ring.pop(out)) {
+            result.consumedDetents += out.delta;
+            result.events++;
+            uint32_t latency = static_cast<uint32_t>(taskRunUs - out.timestampUs);
+            if (latency > result.maxLatencyUs) {
+                result.maxLatencyUs = latency;
+            }
+        }
+        taskPending = false;
+    };
+
+    for (size_t i = 1; i < count; i++) {
+        const EdgeSample& edge = edges[i];
+        if (taskPending && taskRunUs <= edge.timeUs) {
+            runTask();
+        }
+
+        result.decodedDetents += truthDecoder.update(edge.a, edge.b);
+        int8_t detents = isrDecoder.update(edge.a, edge.b);
+        if (detents == 0) {
+            continue;
+        }
+        ring.push(detents, edge.timeUs);
+        if (!taskPending) {
+            taskPending = true;
+            taskRunUs = edge.timeUs + TASK_WAKE_US;
+            if (taskRunUs >= stallFromUs && taskRunUs < stallToUs) {
+                taskRunUs = stallToUs;
+            }
+        }
+    }
+    if (taskPending) {
+        runTask();
+    }
+
+    result.overflows = ring.getOverflowCount();
+    return result;
+}
+
+static std::vector<EdgeSample> capture;
+
+/**
+ * @brief Load a CSV capture (time_us,a,b per line; other lines skipped)
+ */
+static bool loadTrace(const char* path, std::vector<EdgeSample>& out) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        return false;
+    }
+    char line[128];
+    while (fgets(line, sizeof(line), file)) {
+        unsigned long timeUs;
+        unsigned a;
+        unsigned b;
+        if (sscanf(line, "%lu,%u,%u", &timeUs, &a, &b) == 3) {
+            out.push_back(EdgeSample{ static_cast<uint32_t>(timeUs), static_cast<uint8_t>(a & 1), static_cast<uint8_t>(b & 1) });
+        }
+    }
+    fclose(file);
+    return out.size() >= 2;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_decoder_counts_full_detents() {
+    QuadratureDecoder decoder(4);
+    decoder.reset(0, 0);
+
+    TEST_ASSERT_EQUAL(0, feed(decoder, UP, 3));
+    TEST_ASSERT_EQUAL(1, feed(decoder, UP + 3, 1));
+    TEST_ASSERT_EQUAL(1, feed(decoder, UP, 4));
+    TEST_ASSERT_EQUAL(-2, feed(decoder, DOWN, 4) + feed(decoder, DOWN, 4));
+}
+
+void test_decoder_bounce_cancels() {
+    QuadratureDecoder decoder(4);
+    decoder.reset(0, 0);
+
+    // Contact bounce on B: back and forth between 00 and 01 never completes a detent
+    for (int i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL(0, decoder.update(0, 1));
+        TEST_ASSERT_EQUAL(0, decoder.update(0, 0));
+    }
+    TEST_ASSERT_EQUAL(1, feed(decoder, UP, 4));
+}
+
+void test_decoder_ignores_invalid_transition() {
+    QuadratureDecoder decoder(4);
+    decoder.reset(0, 0);
+
+    // Both pins changing at once (missed edge) decodes to nothing
+    TEST_ASSERT_EQUAL(0, decoder.update(1, 1));
+    TEST_ASSERT_EQUAL(0, decoder.update(0, 0));
+    TEST_ASSERT_EQUAL(1, feed(decoder, UP, 4));
+}
+
+void test_decoder_half_step_resolution() {
+    QuadratureDecoder decoder(2);
+    decoder.reset(0, 0);
+
+    TEST_ASSERT_EQUAL(2, feed(decoder, UP, 4));
+    TEST_ASSERT_EQUAL(-2, feed(decoder, DOWN, 4));
+}
+
+void test_ring_fifo_order() {
+    EncoderDeltaRing<4> ring;
+    EncoderDelta out{};
+
+    TEST_ASSERT_FALSE(ring.pop(out));
+    TEST_ASSERT_TRUE(ring.push(1, 100));
+    TEST_ASSERT_TRUE(ring.push(-1, 200));
+
+    TEST_ASSERT_TRUE(ring.pop(out));
+    TEST_ASSERT_EQUAL(1, out.delta);
+    TEST_ASSERT_EQUAL_UINT64(100, out.timestampUs);
+    TEST_ASSERT_TRUE(ring.pop(out));
+    TEST_ASSERT_EQUAL(-1, out.delta);
+    TEST_ASSERT_EQUAL_UINT64(200, out.timestampUs);
+    TEST_ASSERT_FALSE(ring.pop(out));
+    TEST_ASSERT_EQUAL_UINT32(0, ring.getOverflowCount());
+}
+
+void test_ring_overflow_is_flushed_when_knob_stops() {
+    EncoderDeltaRing<4> ring;
+    EncoderDelta out{};
+
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(ring.push(1, i));
+    }
+    TEST_ASSERT_FALSE(ring.push(1, 10));
+    TEST_ASSERT_FALSE(ring.push(1, 11));
+    TEST_ASSERT_EQUAL_UINT32(2, ring.getOverflowCount());
+
+    // No further push: the consumer still receives every count
+    int32_t total = 0;
+    int pops = 0;
+    while (ring.pop(out)) {
+        total += out.delta;
+        pops++;
+    }
+    TEST_ASSERT_EQUAL(6, total);
+    TEST_ASSERT_EQUAL(5, pops);
+    TEST_ASSERT_EQUAL_UINT64(11, out.timestampUs);
+    TEST_ASSERT_FALSE(ring.pop(out));
+}
+
+void test_ring_overflow_keeps_order() {
+    EncoderDeltaRing<2> ring;
+    EncoderDelta out{};
+
+    TEST_ASSERT_TRUE(ring.push(1, 1));
+    TEST_ASSERT_TRUE(ring.push(1, 2));
+    TEST_ASSERT_FALSE(ring.push(1, 3));  // Overflows
+
+    TEST_ASSERT_TRUE(ring.pop(out));
+    TEST_ASSERT_EQUAL(1, out.delta);
+    TEST_ASSERT_TRUE(ring.push(-1, 4));  // Reversal after the overflow
+
+    // Overflowed +1 comes before the -1 pushed after it
+    int32_t sequence[4];
+    int n = 0;
+    while (n < 4 && ring.pop(out)) {
+        sequence[n++] = out.delta;
+    }
+    TEST_ASSERT_EQUAL(3, n);
+    TEST_ASSERT_EQUAL(1, sequence[0]);
+    TEST_ASSERT_EQUAL(1, sequence[1]);
+    TEST_ASSERT_EQUAL(-1, sequence[2]);
+}
+
+void test_ring_wraps_indices() {
+    EncoderDeltaRing<2> ring;
+    EncoderDelta out{};
+
+    for (int i = 0; i < 1000; i++) {
+        TEST_ASSERT_TRUE(ring.push(i, i));
+        TEST_ASSERT_TRUE(ring.pop(out));
+        TEST_ASSERT_EQUAL(i, out.delta);
+    }
+    TEST_ASSERT_FALSE(ring.pop(out));
+}
+
+void test_trace_replay_loses_nothing() {
+    ReplayResult r = replay(EDGE_TRACE, sizeof(EDGE_TRACE) / sizeof(EDGE_TRACE[0]));
+
+    TEST_ASSERT_EQUAL(EDGE_TRACE_DETENTS, r.decodedDetents);  // Chatter cancels in the decoder
+    TEST_ASSERT_EQUAL(r.decodedDetents, r.consumedDetents);
+    TEST_ASSERT_EQUAL_UINT32(0, r.overflows);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(TASK_WAKE_US, r.maxLatencyUs);
+}
+
+void test_trace_replay_with_stalled_task_overflows_without_loss() {
+    // Stall the task through most of the flick: more detents than the ring holds
+    uint32_t stallFrom = EDGE_TRACE_FLICK_START_US + 5000;
+    ReplayResult r = replay(EDGE_TRACE, sizeof(EDGE_TRACE) / sizeof(EDGE_TRACE[0]), stallFrom, stallFrom + STALL_US);
+
+    printf("\nStalled replay: %u events, %u overflows, max edge-to-event %u us\n",
+           static_cast<unsigned>(r.events), static_cast<unsigned>(r.overflows), static_cast<unsigned>(r.maxLatencyUs));
+    TEST_ASSERT_GREATER_THAN_UINT32(0, r.overflows);
+    TEST_ASSERT_EQUAL(EDGE_TRACE_DETENTS, r.consumedDetents);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(STALL_US + TASK_WAKE_US, r.maxLatencyUs);
+}
+
+void test_captured_trace_loses_nothing() {
+    ReplayResult r = replay(capture.data(), capture.size());
+    printf("\nCapture: %u edges, %d detents, max edge-to-event %u us\n",
+           static_cast<unsigned>(capture.size()), static_cast<int>(r.consumedDetents), static_cast<unsigned>(r.maxLatencyUs));
+    TEST_ASSERT_EQUAL(r.decodedDetents, r.consumedDetents);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(TASK_WAKE_US, r.maxLatencyUs);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_decoder_counts_full_detents);
+    RUN_TEST(test_decoder_bounce_cancels);
+    RUN_TEST(test_decoder_ignores_invalid_transition);
+    RUN_TEST(test_decoder_half_step_resolution);
+    RUN_TEST(test_ring_fifo_order);
+    RUN_TEST(test_ring_overflow_is_flushed_when_knob_stops);
+    RUN_TEST(test_ring_overflow_keeps_order);
+    RUN_TEST(test_ring_wraps_indices);
+    RUN_TEST(test_trace_replay_loses_nothing);
+    RUN_TEST(test_trace_replay_with_stalled_task_overflows_without_loss);
+
+    // Set ENCODER_TRACE_FILE to a logic-analyzer export (time_us,a,b) to also replay a real capture
+    const char* path = getenv("ENCODER_TRACE_FILE");
+    if (path != nullptr) {
+        if (!loadTrace(path, capture)) {
+            fprintf(stderr, "Cannot read encoder trace %s\n", path);
+            return 1;
+        }
+        RUN_TEST(test_captured_trace_loses_nothing);
+    }
+    return UNITY_END();
+}
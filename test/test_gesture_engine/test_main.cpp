@@ -0,0 +1,162 @@
+#include <unity.h>
+#include "GestureEngine.h"
+
+using Type = GestureEvent::Type;
+
+static const GestureConfig CLICK_ONLY{ 0, 0, 1, 0, 0 };
+static const GestureConfig LONG_PRESS{ 1000, 0, 1, 0, 0 };
+static const GestureConfig MULTI_CLICK{ 1000, 300, 3, 0, 0 };
+static const GestureConfig REPEAT{ 0, 0, 1, 400, 120 };
+
+static void assertEvent(Type type, uint8_t clicks, uint32_t atMs, const GestureEvent& event) {
+    TEST_ASSERT_EQUAL(static_cast<int>(type), static_cast<int>(event.type));
+    TEST_ASSERT_EQUAL(clicks, event.clickCount);
+    TEST_ASSERT_EQUAL_UINT32(atMs, event.timestampMs);
+}
+
+/**
+ * @brief Tick the engine at its deadline, as the driver's timer would
+ */
+static bool tickAtDeadline(GestureEngine& engine, GestureEvent& out, uint32_t& nowMs) {
+    uint32_t deadline;
+    if (!engine.getNextDeadline(deadline)) {
+        return false;
+    }
+    nowMs = deadline;
+    return engine.onTick(nowMs, out);
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_click_only_fires_on_press() {
+    GestureEngine engine(CLICK_ONLY);
+    GestureEvent event;
+    uint32_t deadline;
+
+    TEST_ASSERT_TRUE(engine.firesEarly());
+    TEST_ASSERT_TRUE(engine.onPress(100, event));
+    assertEvent(Type::CLICK, 1, 100, event);
+    TEST_ASSERT_FALSE(engine.getNextDeadline(deadline));
+    TEST_ASSERT_FALSE(engine.onRelease(200, event));
+}
+
+void test_short_press_fires_on_release_when_long_press_bound() {
+    GestureEngine engine(LONG_PRESS);
+    GestureEvent event;
+    uint32_t deadline;
+
+    TEST_ASSERT_FALSE(engine.onPress(0, event));
+    TEST_ASSERT_TRUE(engine.getNextDeadline(deadline));
+    TEST_ASSERT_EQUAL_UINT32(1000, deadline);
+
+    TEST_ASSERT_TRUE(engine.onRelease(300, event));
+    assertEvent(Type::CLICK, 1, 300, event);
+    TEST_ASSERT_FALSE(engine.getNextDeadline(deadline));
+}
+
+void test_long_press_fires_while_held() {
+    GestureEngine engine(LONG_PRESS);
+    GestureEvent event;
+    uint32_t now = 0;
+
+    engine.onPress(0, event);
+    TEST_ASSERT_FALSE(engine.onTick(999, event));  // Early tick is ignored
+    TEST_ASSERT_TRUE(tickAtDeadline(engine, event, now));
+    assertEvent(Type::LONG_PRESS, 1, 1000, event);
+
+    // Release after a long press is not a click
+    TEST_ASSERT_FALSE(engine.onRelease(1500, event));
+}
+
+void test_double_and_triple_click() {
+    GestureEngine engine(MULTI_CLICK);
+    GestureEvent event;
+    uint32_t now = 0;
+
+    engine.onPress(0, event);
+    TEST_ASSERT_FALSE(engine.onRelease(80, event));
+    TEST_ASSERT_FALSE(engine.onPress(200, event));
+    TEST_ASSERT_FALSE(engine.onRelease(280, event));
+    TEST_ASSERT_TRUE(tickAtDeadline(engine, event, now));
+    assertEvent(Type::CLICK, 2, 580, event);
+
+    engine.onPress(1000, event);
+    engine.onRelease(1080, event);
+    engine.onPress(1200, event);
+    engine.onRelease(1280, event);
+    engine.onPress(1400, event);
+    TEST_ASSERT_TRUE(engine.onRelease(1480, event));  // maxClicks reached: no window wait
+    assertEvent(Type::CLICK, 3, 1480, event);
+}
+
+void test_single_click_waits_for_window() {
+    GestureEngine engine(MULTI_CLICK);
+    GestureEvent event;
+    uint32_t now = 0;
+
+    engine.onPress(0, event);
+    TEST_ASSERT_FALSE(engine.onRelease(100, event));
+    TEST_ASSERT_TRUE(tickAtDeadline(engine, event, now));
+    assertEvent(Type::CLICK, 1, 400, event);
+}
+
+void test_repeat_cadence() {
+    GestureEngine engine(REPEAT);
+    GestureEvent event;
+    uint32_t now = 0;
+
+    TEST_ASSERT_TRUE(engine.onPress(0, event));
+    assertEvent(Type::CLICK, 1, 0, event);
+
+    TEST_ASSERT_TRUE(tickAtDeadline(engine, event, now));
+    assertEvent(Type::REPEAT, 1, 400, event);
+    TEST_ASSERT_TRUE(tickAtDeadline(engine, event, now));
+    assertEvent(Type::REPEAT, 1, 520, event);
+
+    // Late tick: next deadline keeps the cadence instead of drifting
+    TEST_ASSERT_TRUE(engine.onTick(700, event));
+    uint32_t deadline;
+    TEST_ASSERT_TRUE(engine.getNextDeadline(deadline));
+    TEST_ASSERT_EQUAL_UINT32(760, deadline);
+
+    TEST_ASSERT_FALSE(engine.onRelease(720, event));
+    TEST_ASSERT_FALSE(engine.getNextDeadline(deadline));
+}
+
+void test_deadline_wraps_millis() {
+    GestureEngine engine(LONG_PRESS);
+    GestureEvent event;
+    uint32_t start = 0xFFFFFF00u;
+
+    engine.onPress(start, event);
+    TEST_ASSERT_FALSE(engine.onTick(start + 500, event));
+    TEST_ASSERT_TRUE(engine.onTick(start + 1000, event));  // Past the 32-bit wrap
+    TEST_ASSERT_EQUAL(static_cast<int>(Type::LONG_PRESS), static_cast<int>(event.type));
+}
+
+void test_set_config_resets_state() {
+    GestureEngine engine(LONG_PRESS);
+    GestureEvent event;
+    uint32_t deadline;
+
+    engine.onPress(0, event);
+    engine.setConfig(CLICK_ONLY);
+    TEST_ASSERT_FALSE(engine.getNextDeadline(deadline));
+    TEST_ASSERT_TRUE(engine.onPress(50, event));
+    assertEvent(Type::CLICK, 1, 50, event);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_click_only_fires_on_press);
+    RUN_TEST(test_short_press_fires_on_release_when_long_press_bound);
+    RUN_TEST(test_long_press_fires_while_held);
+    RUN_TEST(test_double_and_triple_click);
+    RUN_TEST(test_single_click_waits_for_window);
+    RUN_TEST(test_repeat_cadence);
+    RUN_TEST(test_deadline_wraps_millis);
+    RUN_TEST(test_set_config_resets_state);
+    return UNITY_END();
+}
@@ -0,0 +1,130 @@
+#include <unity.h>
+#include "BleKeyboard.h"
+#include "HostClock.h"
+#include "BLE/BleKeyboardService.h"
+#include "BLE/HidOutputTask.h"
+
+static constexpr uint8_t CTRL = 0x01;
+static constexpr uint8_t SHIFT = 0x02;
+static constexpr uint8_t USAGE_A = 0x04;
+static constexpr uint8_t USAGE_C = 0x06;
+
+static BleKeyboard* keyboard;
+static HidOutputTask* hid;
+
+static KeyReport report(uint8_t modifiers, uint8_t key = 0) {
+    KeyReport r;
+    BleKeyboardService::composeKeyReport(r, modifiers, &key, key != 0 ? 1 : 0);
+    return r;
+}
+
+static void drain() {
+    while (hid->sendNext()) {
+    }
+}
+
+static void assertKeyReport(uint8_t modifiers, uint8_t key0, uint8_t key1, const RecordedReport& r) {
+    TEST_ASSERT_EQUAL(static_cast<int>(RecordedReport::Kind::KEYBOARD), static_cast<int>(r.kind));
+    TEST_ASSERT_EQUAL(modifiers, r.modifiers);
+    TEST_ASSERT_EQUAL(key0, r.keys[0]);
+    TEST_ASSERT_EQUAL(key1, r.keys[1]);
+}
+
+void setUp() {
+    HostClock::advanceMs(1000);
+    keyboard = new BleKeyboard();
+    hid = new HidOutputTask(keyboard);
+}
+
+void tearDown() {
+    delete hid;
+    delete keyboard;
+}
+
+void test_chord_without_held_keys_releases_everything() {
+    hid->enqueueKeyChord(report(CTRL, 'c'));
+    drain();
+
+    const std::vector<RecordedReport>& reports = keyboard->reports();
+    TEST_ASSERT_EQUAL(2, static_cast<int>(reports.size()));
+    assertKeyReport(CTRL, USAGE_C, 0, reports[0]);
+    assertKeyReport(0, 0, 0, reports[1]);
+}
+
+void test_wheel_modifiers_keep_held_state() {
+    hid->enqueueKeyState(report(SHIFT));
+    hid->enqueueWheel(1, 0, 0, CTRL);
+    drain();
+
+    // Held Shift, Ctrl added around the wheel, back to Shift only
+    const std::vector<RecordedReport>& reports = keyboard->reports();
+    TEST_ASSERT_EQUAL(4, static_cast<int>(reports.size()));
+    assertKeyReport(SHIFT, 0, 0, reports[0]);
+    assertKeyReport(CTRL | SHIFT, 0, 0, reports[1]);
+    TEST_ASSERT_EQUAL(static_cast<int>(RecordedReport::Kind::MOUSE), static_cast<int>(reports[2].kind));
+    assertKeyReport(SHIFT, 0, 0, reports[3]);
+}
+
+void test_wheel_modifier_already_held_sends_no_key_reports() {
+    hid->enqueueKeyState(report(CTRL));
+    hid->enqueueWheel(-2, 0, 0, CTRL);
+    drain();
+
+    const std::vector<RecordedReport>& reports = keyboard->reports();
+    TEST_ASSERT_EQUAL(2, static_cast<int>(reports.size()));
+    TEST_ASSERT_EQUAL(static_cast<int>(RecordedReport::Kind::MOUSE), static_cast<int>(reports[1].kind));
+}
+
+void test_chord_keeps_held_key_down() {
+    hid->enqueueKeyState(report(0, 'a'));
+    hid->enqueueKeyChord(report(CTRL, 'c'), 2);
+    drain();
+
+    // A stays down through both cycles and the final release
+    const std::vector<RecordedReport>& reports = keyboard->reports();
+    TEST_ASSERT_EQUAL(5, static_cast<int>(reports.size()));
+    assertKeyReport(0, USAGE_A, 0, reports[0]);
+    assertKeyReport(CTRL, USAGE_A, USAGE_C, reports[1]);
+    assertKeyReport(CTRL, USAGE_A, 0, reports[2]);
+    assertKeyReport(CTRL, USAGE_A, USAGE_C, reports[3]);
+    assertKeyReport(0, USAGE_A, 0, reports[4]);
+}
+
+void test_released_state_is_not_restored() {
+    hid->enqueueKeyState(report(SHIFT));
+    hid->enqueueKeyState(report(0));
+    hid->enqueueKeyChord(report(CTRL, 'c'));
+    drain();
+
+    const std::vector<RecordedReport>& reports = keyboard->reports();
+    assertKeyReport(0, 0, 0, reports.back());
+}
+
+void test_link_loss_forgets_held_state() {
+    hid->enqueueKeyState(report(SHIFT));
+    drain();
+
+    hid->enqueueKeyChord(report(CTRL, 'c'));
+    keyboard->setConnected(false);
+    drain();
+    keyboard->setConnected(true);
+    keyboard->clearReports();
+
+    hid->enqueueKeyChord(report(CTRL, 'c'));
+    drain();
+    const std::vector<RecordedReport>& reports = keyboard->reports();
+    TEST_ASSERT_EQUAL(2, static_cast<int>(reports.size()));
+    assertKeyReport(CTRL, USAGE_C, 0, reports[0]);
+    assertKeyReport(0, 0, 0, reports[1]);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_chord_without_held_keys_releases_everything);
+    RUN_TEST(test_wheel_modifiers_keep_held_state);
+    RUN_TEST(test_wheel_modifier_already_held_sends_no_key_reports);
+    RUN_TEST(test_chord_keeps_held_key_down);
+    RUN_TEST(test_released_state_is_not_restored);
+    RUN_TEST(test_link_loss_forgets_held_state);
+    return UNITY_END();
+}
@@ -0,0 +1,326 @@
+/**
+ * @brief PageBlitter/PageFont correctness and a render-time benchmark
+ *
+ * Every draw is checked against PixelCanvas, a host model of the path
+ * OLEDDisplay used before PageBlitter: Adafruit GFX drawChar/drawBitmap
+ * setting one pixel at a time through Adafruit_SSD1306::drawPixel
+ * (bounds check and read-modify-write of the frame byte).
+ * The libraries themselves do not build on the host; the model writes
+ * the same frame layout, so both renderers must produce identical frames.
+ * The benchmark renders the normal and the menu screen both ways.
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <string.h>
+#include "Display/Bitmaps.h"
+#include "Display/Frame/PageBlitter.h"
+#include "Display/Frame/PageFont.h"
+
+using Ink = PageBlitter::Ink;
+
+static constexpr int BENCH_FRAMES = 20000;
+
+/**
+ * @brief Per-pixel reference renderer (Adafruit GFX + SSD1306 drawPixel)
+ */
+class PixelCanvas {
+public:
+    explicit PixelCanvas(uint8_t* frame) : frame(frame) {}
+
+    void clear() { memset(frame, 0, OLED_FRAME_BYTES); }
+
+    __attribute__((noinline)) void drawPixel(int16_t x, int16_t y, Ink ink) {
+        if (x < 0 || x >= OLED_SCREEN_WIDTH || y < 0 || y >= OLED_SCREEN_HEIGHT) {
+            return;
+        }
+        uint8_t& target = frame[x + (y / 8) * OLED_SCREEN_WIDTH];
+        if (ink == Ink::WHITE) {
+            target |= static_cast<uint8_t>(1 << (y & 7));
+        } else {
+            target &= static_cast<uint8_t>(~(1 << (y & 7)));
+        }
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t width, int16_t height, Ink ink = Ink::WHITE) {
+        for (int16_t i = x; i < x + width; i++) {
+            for (int16_t j = y; j < y + height; j++) {
+                drawPixel(i, j, ink);
+            }
+        }
+    }
+
+    void drawBitmap(int16_t x, int16_t y, const uint8_t* rows, int16_t width, int16_t height, Ink ink = Ink::WHITE) {
+        int16_t byteWidth = (width + 7) / 8;
+        for (int16_t j = 0; j < height; j++) {
+            for (int16_t i = 0; i < width; i++) {
+                if (rows[j * byteWidth + i / 8] & (0x80 >> (i & 7))) {
+                    drawPixel(x + i, y + j, ink);
+                }
+            }
+        }
+    }
+
+    void drawChar(int16_t x, int16_t y, char c, uint8_t size, Ink ink) {
+        if (x >= OLED_SCREEN_WIDTH || y >= OLED_SCREEN_HEIGHT ||
+            x + PAGE_FONT_ADVANCE * size - 1 < 0 || y + PAGE_FONT_HEIGHT * size - 1 < 0) {
+            return;
+        }
+        const uint8_t* glyph = pageFontGlyph(c);
+        for (int8_t i = 0; i < PAGE_FONT_GLYPH_WIDTH; i++) {
+            uint8_t line = glyph[i];
+            for (int8_t j = 0; j < PAGE_FONT_HEIGHT; j++, line >>= 1) {
+                if (!(line & 1)) {
+                    continue;
+                }
+                if (size == 1) {
+                    drawPixel(x + i, y + j, ink);
+                } else {
+                    fillRect(x + i * size, y + j * size, size, size, ink);
+                }
+            }
+        }
+    }
+
+    int16_t print(int16_t x, int16_t y, const char* text, uint8_t size = 1, Ink ink = Ink::WHITE) {
+        for (const char* c = text; *c != '\0'; c++) {
+            drawChar(x, y, *c, size, ink);
+            x += PAGE_FONT_ADVANCE * size;
+        }
+        return x;
+    }
+
+private:
+    uint8_t* frame;
+};
+
+static uint8_t actual[OLED_FRAME_BYTES];
+static uint8_t expected[OLED_FRAME_BYTES];
+static PageBlitter blitter(actual);
+static PixelCanvas reference(expected);
+
+static const char* const MENU_ITEMS[] = { "Wheel Mode", "Direction", "Zoom Method" };
+
+static uint8_t byteAt(const uint8_t* frame, uint8_t page, uint8_t column) {
+    return frame[page * OLED_SCREEN_WIDTH + column];
+}
+
+static void assertFramesEqual() {
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, actual, OLED_FRAME_BYTES);
+}
+
+static bool frameIsBlank(const uint8_t* frame) {
+    for (uint16_t i = 0; i < OLED_FRAME_BYTES; i++) {
+        if (frame[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The screens OLEDDisplay draws most often, once per renderer
+
+static void renderNormalScreen(PageBlitter& canvas) {
+    canvas.clear();
+    canvas.blit(0, 0, btIcon);
+    canvas.drawText(OLED_SCREEN_WIDTH - PageBlitter::textWidth("85%") - 2, 0, "85%");
+    canvas.drawText((OLED_SCREEN_WIDTH - PageBlitter::textWidth("S", 2)) / 2, 8, "S", 2);
+    canvas.blit(0, 24, arrowUpIcon);
+}
+
+static void renderNormalScreen(PixelCanvas& canvas) {
+    canvas.clear();
+    canvas.drawBitmap(0, 0, btIconRows, ICON_WIDTH, ICON_HEIGHT);
+    canvas.print(OLED_SCREEN_WIDTH - PageBlitter::textWidth("85%") - 2, 0, "85%");
+    canvas.print((OLED_SCREEN_WIDTH - PageBlitter::textWidth("S", 2)) / 2, 8, "S", 2);
+    canvas.drawBitmap(0, 24, arrowUpIconRows, ICON_WIDTH, ICON_HEIGHT);
+}
+
+static void renderMenuScreen(PageBlitter& canvas) {
+    canvas.clear();
+    canvas.blit(0, 0, btIcon);
+    canvas.drawText(OLED_SCREEN_WIDTH - PageBlitter::textWidth("85%") - 2, 0, "85%");
+    canvas.drawText((OLED_SCREEN_WIDTH - PageBlitter::textWidth("S")) / 2, 0, "S");
+    canvas.fillRect(0, 7, OLED_SCREEN_WIDTH, 1);
+    for (uint8_t i = 0; i < 3; i++) {
+        int16_t y = 8 + i * 8;
+        bool selected = i == 1;
+        Ink ink = selected ? Ink::BLACK : Ink::WHITE;
+        if (selected) {
+            canvas.fillRect(0, y, OLED_SCREEN_WIDTH, 8);
+            canvas.drawText(0, y, ">", 1, ink);
+        }
+        canvas.drawText(selected ? 10 : 4, y, MENU_ITEMS[i], 1, ink);
+    }
+}
+
+static void renderMenuScreen(PixelCanvas& canvas) {
+    canvas.clear();
+    canvas.drawBitmap(0, 0, btIconRows, ICON_WIDTH, ICON_HEIGHT);
+    canvas.print(OLED_SCREEN_WIDTH - PageBlitter::textWidth("85%") - 2, 0, "85%");
+    canvas.print((OLED_SCREEN_WIDTH - PageBlitter::textWidth("S")) / 2, 0, "S");
+    canvas.fillRect(0, 7, OLED_SCREEN_WIDTH, 1);
+    for (uint8_t i = 0; i < 3; i++) {
+        int16_t y = 8 + i * 8;
+        bool selected = i == 1;
+        Ink ink = selected ? Ink::BLACK : Ink::WHITE;
+        if (selected) {
+            canvas.fillRect(0, y, OLED_SCREEN_WIDTH, 8);
+            canvas.print(0, y, ">", 1, ink);
+        }
+        canvas.print(selected ? 10 : 4, y, MENU_ITEMS[i], 1, ink);
+    }
+}
+
+template <typename Canvas>
+static double usPerFrame(Canvas& canvas, void (*render)(Canvas&)) {
+    for (int i = 0; i < BENCH_FRAMES / 10; i++) {
+        render(canvas);  // Warm up
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        render(canvas);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count() / BENCH_FRAMES;
+}
+
+void setUp() {
+    blitter.clear();
+    reference.clear();
+}
+
+void tearDown() {}
+
+void test_glyph_is_stored_in_page_format() {
+    // 'A' as column bytes, LSB on top; the sixth column is the blank advance
+    static const uint8_t A[PAGE_FONT_GLYPH_WIDTH] = { 0x7E, 0x11, 0x11, 0x11, 0x7E };
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(A, pageFontGlyph('A'), PAGE_FONT_GLYPH_WIDTH);
+    TEST_ASSERT_TRUE(pageFontGlyph('\x7F') == pageFontGlyph(PAGE_FONT_FALLBACK_CHAR));
+    TEST_ASSERT_TRUE(pageFontGlyph('\n') == pageFontGlyph(PAGE_FONT_FALLBACK_CHAR));
+
+    TEST_ASSERT_EQUAL(PAGE_FONT_ADVANCE * 2, blitter.drawText(0, 0, "AA"));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(A, actual, PAGE_FONT_GLYPH_WIDTH);
+    TEST_ASSERT_EQUAL_HEX8(0x00, byteAt(actual, 0, PAGE_FONT_GLYPH_WIDTH));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(A, actual + PAGE_FONT_ADVANCE, PAGE_FONT_GLYPH_WIDTH);
+}
+
+void test_unaligned_y_splits_bytes_across_pages() {
+    blitter.drawText(20, 11, "A");
+    reference.print(20, 11, "A");
+    assertFramesEqual();
+
+    // Row 11 is bit 3 of page 1: each column byte is shifted down 3, the rest spills into page 2
+    TEST_ASSERT_EQUAL_HEX8(static_cast<uint8_t>(0x7E << 3), byteAt(actual, 1, 20));
+    TEST_ASSERT_EQUAL_HEX8(static_cast<uint8_t>(0x7E >> 5), byteAt(actual, 2, 20));
+}
+
+void test_every_row_offset_matches_pixel_path() {
+    for (int16_t y = -8; y <= OLED_SCREEN_HEIGHT; y++) {
+        blitter.clear();
+        reference.clear();
+        blitter.drawText(3, y, "Wg|~");
+        reference.print(3, y, "Wg|~");
+        assertFramesEqual();
+    }
+}
+
+void test_negative_coordinates_are_clipped() {
+    blitter.drawText(-3, -5, "Hello");
+    reference.print(-3, -5, "Hello");
+    assertFramesEqual();
+    TEST_ASSERT_FALSE(frameIsBlank(actual));
+
+    // Entirely off screen on any side draws nothing
+    blitter.clear();
+    blitter.drawText(-PAGE_FONT_ADVANCE * 3, 0, "abc");
+    blitter.drawText(0, -PAGE_FONT_HEIGHT, "abc");
+    blitter.drawText(OLED_SCREEN_WIDTH, 0, "abc");
+    blitter.drawText(0, OLED_SCREEN_HEIGHT, "abc");
+    blitter.blit(-ICON_WIDTH, -ICON_HEIGHT, btIcon);
+    blitter.fillRect(-10, -10, 10, 10);
+    TEST_ASSERT_TRUE(frameIsBlank(actual));
+}
+
+void test_right_and_bottom_edges_are_clipped() {
+    blitter.drawText(OLED_SCREEN_WIDTH - 8, OLED_SCREEN_HEIGHT - 4, "XY", 2);
+    reference.print(OLED_SCREEN_WIDTH - 8, OLED_SCREEN_HEIGHT - 4, "XY", 2);
+    assertFramesEqual();
+}
+
+void test_scale_two_text() {
+    blitter.drawText(40, 8, "Sz", 2);
+    reference.print(40, 8, "Sz", 2);
+    assertFramesEqual();
+
+    // Unaligned and partly above the frame
+    blitter.clear();
+    reference.clear();
+    blitter.drawText(-5, -3, "Vq", 2);
+    reference.print(-5, -3, "Vq", 2);
+    assertFramesEqual();
+
+    TEST_ASSERT_EQUAL_UINT16(PAGE_FONT_ADVANCE * 2 * 2, PageBlitter::textWidth("Sz", 2));
+    TEST_ASSERT_EQUAL_UINT16(PageBlitter::textWidth("Sz", 2), PageBlitter::textWidth("Sz", 9));
+}
+
+void test_icons_match_row_bitmaps() {
+    for (int16_t y = -4; y <= 28; y += 3) {
+        blitter.clear();
+        reference.clear();
+        blitter.blit(y * 2, y, arrowDownIcon);
+        reference.drawBitmap(y * 2, y, arrowDownIconRows, ICON_WIDTH, ICON_HEIGHT);
+        assertFramesEqual();
+    }
+}
+
+void test_black_ink_and_partial_fill() {
+    blitter.fillRect(5, 3, 60, 14);
+    reference.fillRect(5, 3, 60, 14);
+    blitter.drawText(8, 6, "inv", 1, Ink::BLACK);
+    reference.print(8, 6, "inv", 1, Ink::BLACK);
+    blitter.fillRect(20, 10, 4, 20, Ink::BLACK);
+    reference.fillRect(20, 10, 4, 20, Ink::BLACK);
+    assertFramesEqual();
+}
+
+void test_screens_match_pixel_path() {
+    renderNormalScreen(blitter);
+    renderNormalScreen(reference);
+    assertFramesEqual();
+
+    renderMenuScreen(blitter);
+    renderMenuScreen(reference);
+    assertFramesEqual();
+}
+
+void test_benchmark_render_time() {
+    double normalPixel = usPerFrame<PixelCanvas>(reference, renderNormalScreen);
+    double normalPage = usPerFrame<PageBlitter>(blitter, renderNormalScreen);
+    double menuPixel = usPerFrame<PixelCanvas>(reference, renderMenuScreen);
+    double menuPage = usPerFrame<PageBlitter>(blitter, renderMenuScreen);
+
+    printf("\nRender time per frame, %d frames (host)\n", BENCH_FRAMES);
+    printf("screen       per-pixel     PageBlitter   speedup\n");
+    printf("normal   %9.3f us  %9.3f us   %6.1fx\n", normalPixel, normalPage, normalPixel / normalPage);
+    printf("menu     %9.3f us  %9.3f us   %6.1fx\n", menuPixel, menuPage, menuPixel / menuPage);
+
+    // Timing is only reported; the frames the benchmark rendered must still agree
+    assertFramesEqual();
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_glyph_is_stored_in_page_format);
+    RUN_TEST(test_unaligned_y_splits_bytes_across_pages);
+    RUN_TEST(test_every_row_offset_matches_pixel_path);
+    RUN_TEST(test_negative_coordinates_are_clipped);
+    RUN_TEST(test_right_and_bottom_edges_are_clipped);
+    RUN_TEST(test_scale_two_text);
+    RUN_TEST(test_icons_match_row_bitmaps);
+    RUN_TEST(test_black_ink_and_partial_fill);
+    RUN_TEST(test_screens_match_pixel_path);
+    RUN_TEST(test_benchmark_render_time);
+    return UNITY_END();
+}
@@ -0,0 +1,202 @@
+/**
+ * @brief Input-to-HID replay benchmark (pio test -e native -f test_pipeline)
+ *
+ * Replays a recorded session through the real EncoderEventHandler,
+ * ButtonEventHandler, MenuController and mode handlers into the recording
+ * BleKeyboard fake, prints events/s, HID reports per event and the output
+ * trace, and fails when the report sequence changes.
+ *
+ * A built-in session is used by default. Set INPUT_RECORD_FILE to a
+ * capture saved with tools/input_record.py --save to replay that instead;
+ * the golden trace is only checked for the built-in session.
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "HostPipeline.h"
+
+using Input::button;
+using Input::click;
+using Input::longClick;
+using Input::rotate;
+using Button = EventEnum::ButtonEventTypes;
+
+static constexpr int BENCH_RUNS = 2000;
+
+// Scroll, menu to Volume, volume steps and reversal, menu to Zoom, zoom, menu back to Scroll
+static const InputRecord SESSION[] = {
+    rotate(0, 1), rotate(8, 1), rotate(16, 1), rotate(24, 1), rotate(32, 2), rotate(40, 2),
+    rotate(300, -1), rotate(340, -1), rotate(380, -1),
+    button(600, 0, Button::SHORT_PRESS),
+    button(700, 1, Button::SHORT_PRESS), button(1100, 1, Button::REPEAT), button(1220, 1, Button::REPEAT),
+    longClick(2000), click(2100), click(2200), rotate(2300, 1), click(2400),
+    longClick(2500), longClick(2600), longClick(2700),
+    rotate(3000, 1), rotate(3010, 1), rotate(3020, 1), rotate(3030, 1), rotate(3040, 1),
+    rotate(3300, -1), rotate(3310, -1),
+    longClick(4000), click(4100), click(4200), rotate(4300, 2), click(4400),
+    longClick(4500), longClick(4600), longClick(4700),
+    rotate(5000, 1), rotate(5200, -1),
+    longClick(6000), click(6100), click(6200), click(6300),
+    longClick(6400), longClick(6500), longClick(6600),
+    rotate(7000, 1),
+};
+static constexpr uint16_t SESSION_LENGTH = sizeof(SESSION) / sizeof(SESSION[0]);
+
+// Default curves and zoom strategy; button 0 plays/pauses, button 1 raises the volume.
+// Keyboard tokens are modifiers:first usage as sent (Ctrl + keypad +/-).
+static const char* const GOLDEN_TRACE =
+    "W1 W24 W24 W22 W50 W-1 W-1 W-2 "
+    "C8 C0 C32 C0 C32 C0 C32 C0 "
+    "C32 C0 C32 C0 C32 C0 C32 C0 C32 C0 C32 C0 C32 C0 C32 C0 "
+    "C64 C0 C64 C0 C64 C0 C64 C0 "
+    "K01:57 K00:00 K01:56 K00:00 "
+    "W1";
+
+static HostPipeline* pipeline = nullptr;
+static std::vector<InputRecord> recording;
+static uint64_t replayStartUs = 0;
+
+static std::string formatReport(const RecordedReport& r) {
+    char token[24];
+    switch (r.kind) {
+        case RecordedReport::Kind::KEYBOARD:
+            snprintf(token, sizeof(token), "K%02X:%02X", r.modifiers, r.keys[0]);
+            break;
+        case RecordedReport::Kind::CONSUMER:
+            snprintf(token, sizeof(token), "C%u", r.media[0] | (r.media[1] << 8));
+            break;
+        case RecordedReport::Kind::MOUSE:
+            if (r.hWheel != 0) {
+                snprintf(token, sizeof(token), "W%d/%d", r.wheel, r.hWheel);
+            } else {
+                snprintf(token, sizeof(token), "W%d", r.wheel);
+            }
+            break;
+    }
+    return token;
+}
+
+static std::string formatTrace(const std::vector<RecordedReport>& reports) {
+    std::string trace;
+    for (const RecordedReport& r : reports) {
+        if (!trace.empty()) {
+            trace += ' ';
+        }
+        trace += formatReport(r);
+    }
+    return trace;
+}
+
+/**
+ * @brief Load the "INRC" dump (see InputRecorder::dump) found in a serial capture
+ */
+static bool loadDump(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    std::string capture;
+    char chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        capture.append(chunk, n);
+    }
+    fclose(file);
+
+    size_t at = capture.find("INRC");
+    if (at == std::string::npos || capture.size() < at + 8) {
+        return false;
+    }
+    const uint8_t* header = reinterpret_cast<const uint8_t*>(capture.data() + at);
+    if (header[4] != InputRecorder::DUMP_VERSION || header[5] != sizeof(InputRecord)) {
+        return false;
+    }
+    uint16_t count = static_cast<uint16_t>(header[6] | (header[7] << 8));
+    if (capture.size() < at + 8 + count * sizeof(InputRecord)) {
+        return false;
+    }
+    recording.resize(count);
+    memcpy(recording.data(), header + 8, count * sizeof(InputRecord));
+    return true;
+}
+
+static std::vector<RecordedReport> replayOnce() {
+    pipeline->keyboard.clearReports();
+    HostClock::advanceMs(10000);  // Idle gap: acceleration and link pacing start cold
+    replayStartUs = HostClock::nowUs;
+    pipeline->replay(recording.data(), static_cast<uint16_t>(recording.size()));
+    return pipeline->keyboard.reports();
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_replay_matches_golden_trace() {
+    std::vector<RecordedReport> reports = replayOnce();
+    std::string trace = formatTrace(reports);
+
+    printf("\nOutput trace (%u reports):\n", static_cast<unsigned>(reports.size()));
+    for (const RecordedReport& r : reports) {
+        printf("  %10.3f ms  %s\n", (r.atUs - replayStartUs) / 1000.0, formatReport(r).c_str());
+    }
+
+    if (getenv("INPUT_RECORD_FILE") == nullptr) {
+        TEST_ASSERT_EQUAL_STRING(GOLDEN_TRACE, trace.c_str());
+    }
+}
+
+void test_replay_is_deterministic() {
+    std::string first = formatTrace(replayOnce());
+    std::string second = formatTrace(replayOnce());
+    TEST_ASSERT_EQUAL_STRING(first.c_str(), second.c_str());
+}
+
+void test_benchmark_events_per_second() {
+    size_t reports = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        reports += replayOnce().size();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    double events = static_cast<double>(recording.size()) * BENCH_RUNS;
+
+    printf("\nReplayed %u events x %d runs in %.3f s\n", static_cast<unsigned>(recording.size()), BENCH_RUNS, seconds);
+    printf("  events/s:          %.0f\n", events / seconds);
+    printf("  HID reports/event: %.3f\n", static_cast<double>(reports) / events);
+
+    HidOutputStats stats = pipeline->hid.getStats();
+    printf("  intents enqueued %u, merged %u, sent %u, dropped %u\n",
+           stats.enqueued, stats.merged, stats.sent, stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.dropped);
+}
+
+int main(int argc, char** argv) {
+    Serial.setEcho(false);  // Mode handlers print every event
+
+    const char* path = getenv("INPUT_RECORD_FILE");
+    if (path != nullptr) {
+        if (!loadDump(path)) {
+            fprintf(stderr, "Cannot read input recording %s\n", path);
+            return 1;
+        }
+    } else {
+        recording.assign(SESSION, SESSION + SESSION_LENGTH);
+    }
+
+    static HostPipeline host;
+    pipeline = &host;
+    pipeline->config.saveButtonAction(0, 1);  // PLAY_PAUSE
+    pipeline->config.saveButtonAction(1, 5);  // VOLUME_UP (repeatable)
+
+    UNITY_BEGIN();
+    RUN_TEST(test_replay_matches_golden_trace);
+    RUN_TEST(test_replay_is_deterministic);
+    RUN_TEST(test_benchmark_events_per_second);
+    return UNITY_END();
+}
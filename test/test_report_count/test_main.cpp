@@ -0,0 +1,105 @@
+/**
+ * @brief HID notifications per action for whole-report chords
+ *
+ * Runs each action through the firmware path into the recording BleKeyboard
+ * fake and checks the report count. The per-key press()/release() path
+ * these replaced cost, in the same order: 8, 4, 2n+2 and 5.
+ */
+
+#include <unity.h>
+#include "BleKeyboard.h"
+#include "HostClock.h"
+#include "BLE/HidOutputTask.h"
+#include "EncoderMode/Handler/EncoderModeHandlerZoom.h"
+#include "Event/Bus/EventBus.h"
+#include "Event/Dispatcher/AppEventDispatcher.h"
+#include "Macro/Manager/MacroManager.h"
+#include "Type/ConfigSnapshot.h"
+
+static constexpr uint8_t CTRL = 0x01;
+static constexpr uint8_t SHIFT = 0x02;
+static constexpr uint8_t ALT = 0x04;
+
+static BleKeyboard keyboard;
+static HidOutputTask hid(&keyboard);
+static EventBus bus;
+static AppEventDispatcher dispatcher(&bus);
+static EncoderModeHandlerZoom zoom(&dispatcher, &hid);
+static MacroManager macros(&hid, nullptr);
+
+static size_t drain() {
+    while (hid.sendNext()) {
+    }
+    size_t count = keyboard.reports().size();
+    keyboard.clearReports();
+    return count;
+}
+
+static void runMacro(uint8_t modifiers, uint8_t keycode) {
+    ConfigSnapshot snapshot{};
+    snapshot.macros[static_cast<uint8_t>(MacroInput::BUTTON_1)] = MacroDefinition{ modifiers, keycode }.toPacked();
+    macros.onConfigChanged(ConfigChange::MACRO, snapshot);
+
+    TEST_ASSERT_TRUE(macros.executeMacro(MacroInput::BUTTON_1));
+    while (hid.sendNext()) {
+    }
+}
+
+void setUp() {
+    HostClock::advanceMs(1000);
+    keyboard.clearReports();
+}
+
+void tearDown() {}
+
+void test_ctrl_shift_alt_x_macro() {
+    runMacro(CTRL | SHIFT | ALT, 'x');
+    TEST_ASSERT_EQUAL(2, static_cast<int>(keyboard.reports().size()));
+}
+
+void test_ctrl_c_macro() {
+    runMacro(CTRL, 'c');
+
+    // Modifier and key in one report, then the release
+    const std::vector<RecordedReport>& reports = keyboard.reports();
+    TEST_ASSERT_EQUAL(2, static_cast<int>(reports.size()));
+    TEST_ASSERT_EQUAL(CTRL, reports[0].modifiers);
+    TEST_ASSERT_EQUAL(0x06, reports[0].keys[0]);  // Usage of 'c'
+    TEST_ASSERT_EQUAL(0, reports[1].modifiers);
+    TEST_ASSERT_EQUAL(0, reports[1].keys[0]);
+}
+
+void test_ctrl_keys_zoom_steps() {
+    ConfigSnapshot snapshot{};
+    snapshot.zoomStrategy = ZoomStrategy::CTRL_KEYS;
+    zoom.onConfigChanged(ConfigChange::ZOOM_STRATEGY, snapshot);
+
+    for (int steps = 1; steps <= 5; steps++) {
+        zoom.handleRotate(steps);
+        TEST_ASSERT_EQUAL(2 * steps, static_cast<int>(drain()));
+    }
+}
+
+void test_ctrl_shift_wheel() {
+    TEST_ASSERT_TRUE(hid.enqueueWheel(1, 0, 0, CTRL | SHIFT));
+    while (hid.sendNext()) {
+    }
+
+    // Modifiers down, wheel, modifiers up
+    const std::vector<RecordedReport>& reports = keyboard.reports();
+    TEST_ASSERT_EQUAL(3, static_cast<int>(reports.size()));
+    TEST_ASSERT_EQUAL(CTRL | SHIFT, reports[0].modifiers);
+    TEST_ASSERT_EQUAL(static_cast<int>(RecordedReport::Kind::MOUSE), static_cast<int>(reports[1].kind));
+    TEST_ASSERT_EQUAL(0, reports[2].modifiers);
+}
+
+int main(int argc, char** argv) {
+    Serial.setEcho(false);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_ctrl_shift_alt_x_macro);
+    RUN_TEST(test_ctrl_c_macro);
+    RUN_TEST(test_ctrl_keys_zoom_steps);
+    RUN_TEST(test_ctrl_shift_wheel);
+    return UNITY_END();
+}
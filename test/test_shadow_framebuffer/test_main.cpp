@@ -0,0 +1,147 @@
+#include <unity.h>
+#include <string.h>
+#include "Display/Frame/ShadowFramebuffer.h"
+
+static uint8_t frame[OLED_FRAME_BYTES];
+static PageSpan spans[ShadowFramebuffer::MAX_SPANS];
+
+static void assertSpan(uint8_t page, uint8_t first, uint8_t last, const PageSpan& span) {
+    TEST_ASSERT_EQUAL_UINT8(page, span.page);
+    TEST_ASSERT_EQUAL_UINT8(first, span.firstColumn);
+    TEST_ASSERT_EQUAL_UINT8(last, span.lastColumn);
+}
+
+static void set(uint8_t page, uint8_t column, uint8_t value) {
+    frame[page * OLED_SCREEN_WIDTH + column] = value;
+}
+
+/**
+ * @brief Shadow that matches the current frame, as after a completed full flush
+ */
+static void sync(ShadowFramebuffer& shadow) {
+    uint8_t count = shadow.diff(frame, spans);
+    shadow.apply(frame, spans, count);
+}
+
+static void assertFullFrame(uint8_t count) {
+    TEST_ASSERT_EQUAL_UINT8(OLED_PAGE_COUNT, count);
+    for (uint8_t page = 0; page < OLED_PAGE_COUNT; page++) {
+        assertSpan(page, 0, OLED_SCREEN_WIDTH - 1, spans[page]);
+    }
+}
+
+void setUp() {
+    memset(frame, 0, sizeof(frame));
+}
+
+void tearDown() {}
+
+void test_first_diff_sends_every_page() {
+    ShadowFramebuffer shadow;
+    assertFullFrame(shadow.diff(frame, spans));
+}
+
+void test_unchanged_frame_sends_nothing() {
+    ShadowFramebuffer shadow;
+    sync(shadow);
+    TEST_ASSERT_EQUAL_UINT8(0, shadow.diff(frame, spans));
+}
+
+void test_single_byte_change() {
+    ShadowFramebuffer shadow;
+    sync(shadow);
+
+    set(2, 37, 0xFF);
+    TEST_ASSERT_EQUAL_UINT8(1, shadow.diff(frame, spans));
+    assertSpan(2, 37, 37, spans[0]);
+}
+
+void test_short_gap_merges_spans() {
+    ShadowFramebuffer shadow;
+    sync(shadow);
+
+    // Gap of exactly the window overhead: resending it is no dearer, so one span
+    set(0, 10, 1);
+    set(0, 10 + OLED_SPAN_OVERHEAD_BYTES + 1, 1);
+    TEST_ASSERT_EQUAL_UINT8(1, shadow.diff(frame, spans));
+    assertSpan(0, 10, 10 + OLED_SPAN_OVERHEAD_BYTES + 1, spans[0]);
+}
+
+void test_long_gap_opens_new_span() {
+    ShadowFramebuffer shadow;
+    sync(shadow);
+
+    set(0, 10, 1);
+    set(0, 10 + OLED_SPAN_OVERHEAD_BYTES + 2, 1);
+    set(3, 0, 1);  // Spans never cross pages
+    TEST_ASSERT_EQUAL_UINT8(3, shadow.diff(frame, spans));
+    assertSpan(0, 10, 10, spans[0]);
+    assertSpan(0, 10 + OLED_SPAN_OVERHEAD_BYTES + 2, 10 + OLED_SPAN_OVERHEAD_BYTES + 2, spans[1]);
+    assertSpan(3, 0, 0, spans[2]);
+}
+
+void test_span_count_is_clamped_per_page() {
+    ShadowFramebuffer shadow;
+    sync(shadow);
+
+    // Isolated changes far apart: one span each until the page limit, then merged into the last
+    const uint8_t stride = OLED_SPAN_OVERHEAD_BYTES + 5;
+    const uint8_t changes = OLED_MAX_SPANS_PER_PAGE + 2;
+    for (uint8_t i = 0; i < changes; i++) {
+        set(1, i * stride, 1);
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(OLED_MAX_SPANS_PER_PAGE, shadow.diff(frame, spans));
+    for (uint8_t i = 0; i + 1 < OLED_MAX_SPANS_PER_PAGE; i++) {
+        assertSpan(1, i * stride, i * stride, spans[i]);
+    }
+    assertSpan(1, (OLED_MAX_SPANS_PER_PAGE - 1) * stride, (changes - 1) * stride,
+               spans[OLED_MAX_SPANS_PER_PAGE - 1]);
+}
+
+void test_worst_case_fits_max_spans() {
+    ShadowFramebuffer shadow;
+    sync(shadow);
+
+    for (uint16_t i = 0; i < OLED_FRAME_BYTES; i += 2 * (OLED_SPAN_OVERHEAD_BYTES + 1)) {
+        frame[i] = 0xFF;
+    }
+    TEST_ASSERT_EQUAL_UINT8(ShadowFramebuffer::MAX_SPANS, shadow.diff(frame, spans));
+}
+
+void test_apply_brings_shadow_up_to_date() {
+    ShadowFramebuffer shadow;
+    sync(shadow);
+
+    set(0, 5, 1);
+    set(3, 120, 1);
+    uint8_t count = shadow.diff(frame, spans);
+    shadow.apply(frame, spans, count);
+    TEST_ASSERT_EQUAL_UINT8(0, shadow.diff(frame, spans));
+}
+
+void test_invalidate_forces_full_frame() {
+    ShadowFramebuffer shadow;
+    sync(shadow);
+
+    set(1, 64, 0xAA);
+    shadow.invalidate();
+    assertFullFrame(shadow.diff(frame, spans));
+
+    shadow.apply(frame, spans, OLED_PAGE_COUNT);
+    TEST_ASSERT_EQUAL_UINT8(0, shadow.diff(frame, spans));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_first_diff_sends_every_page);
+    RUN_TEST(test_unchanged_frame_sends_nothing);
+    RUN_TEST(test_single_byte_change);
+    RUN_TEST(test_short_gap_merges_spans);
+    RUN_TEST(test_long_gap_opens_new_span);
+    RUN_TEST(test_span_count_is_clamped_per_page);
+    RUN_TEST(test_worst_case_fits_max_spans);
+    RUN_TEST(test_apply_brings_shadow_up_to_date);
+    RUN_TEST(test_invalidate_forces_full_frame);
+    return UNITY_END();
+}
@@ -0,0 +1,137 @@
+#include <unity.h>
+#include "BleKeyboard.h"
+#include "HostClock.h"
+#include "BLE/HidOutputTask.h"
+#include "Config/volume_config.h"
+#include "EncoderMode/Handler/EncoderModeHandlerVolume.h"
+#include "Event/Bus/EventBus.h"
+#include "Event/Dispatcher/AppEventDispatcher.h"
+
+static BleKeyboard* keyboard;
+static HidOutputTask* hid;
+static EventBus* bus;
+static AppEventDispatcher* dispatcher;
+static EncoderModeHandlerVolume* volume;
+
+static const uint8_t UP = KEY_MEDIA_VOLUME_UP[0];
+static const uint8_t DOWN = KEY_MEDIA_VOLUME_DOWN[0];
+
+static void drain() {
+    while (hid->sendNext()) {
+    }
+}
+
+/**
+ * @brief Key of every consumer press in the recording, in order (releases skipped)
+ */
+static std::vector<uint8_t> presses() {
+    std::vector<uint8_t> keys;
+    for (const RecordedReport& r : keyboard->reports()) {
+        if (r.kind == RecordedReport::Kind::CONSUMER && r.media[0] != 0) {
+            keys.push_back(r.media[0]);
+        }
+    }
+    return keys;
+}
+
+void setUp() {
+    HostClock::advanceMs(10000);
+    keyboard = new BleKeyboard();
+    hid = new HidOutputTask(keyboard);
+    bus = new EventBus();
+    dispatcher = new AppEventDispatcher(bus);
+    volume = new EncoderModeHandlerVolume(dispatcher, hid);
+    Serial.setEcho(false);
+}
+
+void tearDown() {
+    delete volume;
+    delete dispatcher;
+    delete bus;
+    delete hid;
+    delete keyboard;
+}
+
+void test_steps_follow_delta() {
+    volume->handleRotate(3);
+    drain();
+
+    std::vector<uint8_t> keys = presses();
+    TEST_ASSERT_EQUAL(3, static_cast<int>(keys.size()));
+    TEST_ASSERT_EQUAL(UP, keys[0]);
+    TEST_ASSERT_EQUAL(6, static_cast<int>(keyboard->reports().size()));  // Press and release per step
+    TEST_ASSERT_EQUAL_UINT32(3, volume->getStats().sent);
+}
+
+void test_burst_is_paced() {
+    volume->handleRotate(-4);
+    drain();
+
+    const std::vector<RecordedReport>& reports = keyboard->reports();
+    TEST_ASSERT_EQUAL(8, static_cast<int>(reports.size()));
+    for (size_t i = 2; i < reports.size(); i += 2) {
+        TEST_ASSERT_EQUAL(DOWN, reports[i].media[0]);
+        TEST_ASSERT_TRUE(reports[i].atUs - reports[i - 2].atUs >= VOLUME_STEP_INTERVAL_MS * 1000ULL);
+    }
+}
+
+void test_steps_above_cap_are_counted() {
+    volume->handleRotate(VOLUME_MAX_BURST_STEPS + 5);
+    drain();
+
+    TEST_ASSERT_EQUAL(VOLUME_MAX_BURST_STEPS, static_cast<int>(presses().size()));
+    VolumeStepStats stats = volume->getStats();
+    TEST_ASSERT_EQUAL_UINT32(VOLUME_MAX_BURST_STEPS, stats.sent);
+    TEST_ASSERT_EQUAL_UINT32(5, stats.capped);
+
+    // The excess is not carried into the next event
+    keyboard->clearReports();
+    volume->handleRotate(1);
+    drain();
+    TEST_ASSERT_EQUAL(1, static_cast<int>(presses().size()));
+}
+
+void test_reversal_cancels_pending_steps() {
+    volume->handleShortClick();  // Holds the link, so the up steps are still queued
+    volume->handleRotate(6);
+    volume->handleRotate(-2);
+    drain();
+
+    std::vector<uint8_t> keys = presses();
+    TEST_ASSERT_TRUE(VOLUME_CANCEL_ON_REVERSAL);
+    TEST_ASSERT_EQUAL(3, static_cast<int>(keys.size()));
+    TEST_ASSERT_EQUAL(KEY_MEDIA_MUTE[0], keys[0]);
+    TEST_ASSERT_EQUAL(DOWN, keys[1]);
+    TEST_ASSERT_EQUAL(DOWN, keys[2]);
+}
+
+void test_refused_steps_are_counted() {
+    keyboard->setConnected(false);
+    volume->handleRotate(3);
+    drain();
+
+    TEST_ASSERT_EQUAL(0, static_cast<int>(keyboard->reports().size()));
+    VolumeStepStats stats = volume->getStats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats.sent);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.rejected);
+}
+
+void test_click_mutes() {
+    volume->handleShortClick();
+    drain();
+
+    std::vector<uint8_t> keys = presses();
+    TEST_ASSERT_EQUAL(1, static_cast<int>(keys.size()));
+    TEST_ASSERT_EQUAL(KEY_MEDIA_MUTE[0], keys[0]);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_steps_follow_delta);
+    RUN_TEST(test_burst_is_paced);
+    RUN_TEST(test_steps_above_cap_are_counted);
+    RUN_TEST(test_reversal_cancels_pending_steps);
+    RUN_TEST(test_refused_steps_are_counted);
+    RUN_TEST(test_click_mutes);
+    return UNITY_END();
+}
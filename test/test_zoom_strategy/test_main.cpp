@@ -0,0 +1,135 @@
+/**
+ * @brief Zoom strategy report-count benchmark (pio test -e native -f test_zoom_strategy)
+ *
+ * Sends zoom rotations of several sizes through EncoderModeHandlerZoom and
+ * HidOutputTask into the recording BleKeyboard fake, and prints the HID
+ * reports and link time each strategy needs. The per-step press/release
+ * the handler used before the strategies existed is listed for comparison
+ * (Ctrl press, four reports per step, Ctrl release).
+ */
+
+#include <unity.h>
+#include <cstdio>
+#include "BleKeyboard.h"
+#include "HostClock.h"
+#include "BLE/HidOutputTask.h"
+#include "Config/hid_config.h"
+#include "EncoderMode/Handler/EncoderModeHandlerZoom.h"
+#include "Event/Bus/EventBus.h"
+#include "Event/Dispatcher/AppEventDispatcher.h"
+#include "Type/ConfigSnapshot.h"
+
+static const int DELTAS[] = { 1, 3, 10, 40 };
+
+static BleKeyboard keyboard;
+static HidOutputTask hid(&keyboard);
+static EventBus bus;
+static AppEventDispatcher dispatcher(&bus);
+static EncoderModeHandlerZoom zoom(&dispatcher, &hid);
+
+struct ZoomRun {
+    size_t reports;
+    double linkMs;  ///< First to last report
+};
+
+static ZoomRun run(ZoomStrategy strategy, int delta) {
+    ConfigSnapshot snapshot{};
+    snapshot.zoomStrategy = strategy;
+    zoom.onConfigChanged(ConfigChange::ZOOM_STRATEGY, snapshot);
+
+    HostClock::advanceMs(10000);  // Link pacing starts idle
+    keyboard.clearReports();
+    zoom.handleRotate(delta);
+    while (hid.sendNext()) {
+    }
+
+    const std::vector<RecordedReport>& reports = keyboard.reports();
+    ZoomRun result{ reports.size(), 0.0 };
+    if (!reports.empty()) {
+        result.linkMs = (reports.back().atUs - reports.front().atUs) / 1000.0;
+    }
+    return result;
+}
+
+static size_t legacyReports(int delta) {
+    return 4 * static_cast<size_t>(delta) + 2;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_ctrl_keys_two_reports_per_step() {
+    for (int delta : DELTAS) {
+        TEST_ASSERT_EQUAL(2 * delta, static_cast<int>(run(ZoomStrategy::CTRL_KEYS, delta).reports));
+        TEST_ASSERT_EQUAL(2 * delta, static_cast<int>(run(ZoomStrategy::CTRL_KEYS, -delta).reports));
+    }
+}
+
+void test_ctrl_wheel_is_constant() {
+    for (int delta : DELTAS) {
+        // Ctrl down, one wheel report, Ctrl up
+        TEST_ASSERT_EQUAL(3, static_cast<int>(run(ZoomStrategy::CTRL_WHEEL, delta).reports));
+    }
+
+    const std::vector<RecordedReport>& reports = keyboard.reports();
+    TEST_ASSERT_EQUAL(static_cast<int>(RecordedReport::Kind::MOUSE), static_cast<int>(reports[1].kind));
+    TEST_ASSERT_EQUAL(40, reports[1].wheel);
+}
+
+#if HID_AC_ZOOM_AVAILABLE
+void test_ac_zoom() {
+    for (int delta : DELTAS) {
+        TEST_ASSERT_EQUAL(2 * delta, static_cast<int>(run(ZoomStrategy::AC_ZOOM, delta).reports));
+    }
+}
+#else
+void test_stored_ac_zoom_falls_back_to_ctrl_wheel() {
+    // AC_ZOOM saved by a build with the usages: sent as Ctrl+Wheel
+    for (int delta : DELTAS) {
+        TEST_ASSERT_EQUAL(3, static_cast<int>(run(ZoomStrategy::AC_ZOOM, delta).reports));
+    }
+    TEST_ASSERT_EQUAL(static_cast<int>(RecordedReport::Kind::MOUSE), static_cast<int>(keyboard.reports()[1].kind));
+}
+#endif
+
+void test_benchmark_reports_per_strategy() {
+    static const ZoomStrategy STRATEGIES[] = {
+        ZoomStrategy::CTRL_KEYS,
+        ZoomStrategy::CTRL_WHEEL,
+#if HID_AC_ZOOM_AVAILABLE
+        ZoomStrategy::AC_ZOOM,
+#endif
+    };
+
+    printf("\nHID reports / pacing time from first to last report\n%-12s", "delta");
+    for (int delta : DELTAS) {
+        printf("  %14d", delta);
+    }
+    printf("\n%-12s", "per-step");
+    for (int delta : DELTAS) {
+        printf("  %6u reports", static_cast<unsigned>(legacyReports(delta)));
+    }
+    for (ZoomStrategy strategy : STRATEGIES) {
+        printf("\n%-12s", zoomStrategyToString(strategy));
+        for (int delta : DELTAS) {
+            ZoomRun r = run(strategy, delta);
+            printf("  %3u / %6.1fms", static_cast<unsigned>(r.reports), r.linkMs);
+            TEST_ASSERT_LESS_THAN(legacyReports(delta), r.reports);
+        }
+    }
+    printf("\n");
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_ctrl_keys_two_reports_per_step);
+    RUN_TEST(test_ctrl_wheel_is_constant);
+#if HID_AC_ZOOM_AVAILABLE
+    RUN_TEST(test_ac_zoom);
+#else
+    RUN_TEST(test_stored_ac_zoom_falls_back_to_ctrl_wheel);
+#endif
+    RUN_TEST(test_benchmark_reports_per_strategy);
+    return UNITY_END();
+}
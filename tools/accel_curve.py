@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+r"""Build and upload encoder acceleration curves.
+
+Curve syntax (velocity in detents/s, gain as a multiplier such as 2.5):
+    none                                    every detent is one unit
+    linear THRESHOLD SLOPE MAX_GAIN         +SLOPE gain per det/s above THRESHOLD
+    power THRESHOLD SCALE EXPONENT MAX_GAIN 1 + ((v - THRESHOLD) / SCALE) ^ EXPONENT
+    table V:GAIN V:GAIN ...                 linear between points (up to 8, rising V)
+
+Usage:
+    accel_curve.py pack power 6 20 2 24
+    accel_curve.py upload --mode scroll --port /dev/ttyACM0 power 6 20 2 24   # needs pyserial
+    accel_curve.py upload --mode volume --port /dev/ttyACM0 table 0:1 20:1.5 60:3
+
+The device applies the curve at the next detent and stores it at once.
+Uploading needs firmware built with -D ACCEL_CURVE_UPLOAD_ENABLED=1.
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+# Must match include/Config/acceleration_config.h, include/Type/AccelerationCurve.h,
+# include/Enum/AccelerationCurveEnum.h and include/Enum/WheelModeEnum.h
+UPLOAD_COMMAND = b"A"
+TABLE_MAX_POINTS = 8
+GAIN_ONE_Q8 = 256
+TYPES = ["none", "linear", "power", "table"]
+MODES = ["scroll", "volume", "zoom"]
+
+
+class CurveError(Exception):
+    pass
+
+
+def q8(text):
+    gain = round(float(text) * GAIN_ONE_Q8)
+    if not 0 <= gain <= 0xFFFF:
+        raise CurveError(f"gain {text} outside 0..255.99")
+    return gain
+
+
+def u16(text, name):
+    value = int(text, 0)
+    if not 0 <= value <= 0xFFFF:
+        raise CurveError(f"{name} {value} outside 0..65535")
+    return value
+
+
+def pack(tokens):
+    """Return the AccelerationCurve blob the firmware stores in NVS."""
+    if not tokens or tokens[0].lower() not in TYPES:
+        raise CurveError(f"curve type must be one of {', '.join(TYPES)}")
+    kind = tokens[0].lower()
+    args = tokens[1:]
+    exponent = point_count = threshold = scale = slope = 0
+    max_gain = GAIN_ONE_Q8
+    points = []
+
+    if kind == "none":
+        if args:
+            raise CurveError("none takes no parameters")
+    elif kind == "linear":
+        if len(args) != 3:
+            raise CurveError("linear THRESHOLD SLOPE MAX_GAIN")
+        threshold = u16(args[0], "threshold")
+        slope = q8(args[1])
+        max_gain = q8(args[2])
+    elif kind == "power":
+        if len(args) != 4:
+            raise CurveError("power THRESHOLD SCALE EXPONENT MAX_GAIN")
+        threshold = u16(args[0], "threshold")
+        scale = u16(args[1], "scale")
+        exponent = int(args[2])
+        max_gain = q8(args[3])
+        if scale == 0:
+            raise CurveError("scale must be above 0")
+        if not 1 <= exponent <= 4:
+            raise CurveError("exponent must be 1-4")
+    else:
+        if not 1 <= len(args) <= TABLE_MAX_POINTS:
+            raise CurveError(f"table takes 1-{TABLE_MAX_POINTS} V:GAIN points")
+        for arg in args:
+            velocity, _, gain = arg.partition(":")
+            if not gain:
+                raise CurveError(f"point {arg!r} is not V:GAIN")
+            points.append((u16(velocity, "velocity"), q8(gain)))
+        if any(b[0] <= a[0] for a, b in zip(points, points[1:])):
+            raise CurveError("table velocities must rise")
+        point_count = len(points)
+
+    if kind in ("linear", "power") and max_gain < GAIN_ONE_Q8:
+        raise CurveError("max gain must be at least 1.0")
+
+    points += [(0, 0)] * (TABLE_MAX_POINTS - len(points))
+    blob = struct.pack("<BBBBHHHH", TYPES.index(kind), exponent, point_count, 0, threshold, scale, slope, max_gain)
+    return blob + b"".join(struct.pack("<HH", v, g) for v, g in points)
+
+
+def upload(port, baud, mode, blob):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("pyserial is required for upload (pip install pyserial)")
+
+    with serial.Serial(port, baud, timeout=0.2) as ser:
+        ser.write(UPLOAD_COMMAND + struct.pack("<B", mode) + blob)
+        ser.flush()
+        time.sleep(0.5)
+        sys.stdout.write(ser.read(4096).decode(errors="replace"))  # Device log shows the result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    pk = sub.add_parser("pack", help="print the curve blob as hex")
+    pk.add_argument("curve", nargs="+")
+
+    up = sub.add_parser("upload", help="store a curve for one wheel mode on the device")
+    up.add_argument("--mode", required=True, choices=MODES)
+    up.add_argument("--port", required=True)
+    up.add_argument("--baud", type=int, default=460800)
+    up.add_argument("curve", nargs="+")
+
+    args = parser.parse_args()
+    try:
+        blob = pack(args.curve)
+    except (CurveError, ValueError) as e:
+        sys.exit(f"error: {e}")
+
+    if args.command == "pack":
+        print(blob.hex(" "))
+        print(f"{len(blob)} bytes", file=sys.stderr)
+    else:
+        upload(args.port, args.baud, MODES.index(args.mode), blob)
+
+
+if __name__ == "__main__":
+    main()
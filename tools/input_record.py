@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Decode an InputRecorder binary dump into a readable input trace.
+
+Firmware built with -D INPUT_RECORD_ENABLED=1 accepts on the serial console:
+    R  start/stop recording      d  dump the recording      p  replay it on the device
+
+Usage:
+    input_record.py session.bin              # decode a saved capture
+    input_record.py --port /dev/ttyACM0      # request a dump (needs pyserial)
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+MAGIC = b"INRC"
+HEADER = struct.Struct("<4sBBH")     # magic, version, recordSize, count
+RECORD = struct.Struct("<IBBh")      # offsetUs, topic, type, value
+SUPPORTED_VERSION = 1
+
+# Must match include/Enum/EventTopicEnum.h and include/Enum/EventEnum.h
+TOPIC_ENCODER = 0
+TOPIC_BUTTON = 1
+ENCODER_TYPES = ["ROTATE", "SHORT_CLICK", "LONG_CLICK"]
+BUTTON_TYPES = ["SHORT_PRESS", "LONG_PRESS", "DOUBLE_PRESS", "TRIPLE_PRESS", "REPEAT"]
+
+
+def decode(data):
+    start = data.find(MAGIC)
+    while start >= 0:
+        _, version, record_size, count = HEADER.unpack_from(data, start)
+        body = start + HEADER.size
+        if version == SUPPORTED_VERSION and record_size == RECORD.size and body + count * record_size <= len(data):
+            return [RECORD.unpack_from(data, body + i * record_size) for i in range(count)]
+        start = data.find(MAGIC, start + 1)
+    return None
+
+
+def describe(topic, type_, value):
+    if topic == TOPIC_ENCODER:
+        name = ENCODER_TYPES[type_] if type_ < len(ENCODER_TYPES) else f"TYPE_{type_}"
+        return f"encoder {name:<12} delta={value:+d}" if name == "ROTATE" else f"encoder {name}"
+    if topic == TOPIC_BUTTON:
+        name = BUTTON_TYPES[type_] if type_ < len(BUTTON_TYPES) else f"TYPE_{type_}"
+        return f"button{value}  {name}"
+    return f"topic {topic} type {type_} value {value}"
+
+
+def capture(port, baud, timeout):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("pyserial is required for --port (pip install pyserial)")
+
+    with serial.Serial(port, baud, timeout=0.2) as ser:
+        ser.reset_input_buffer()
+        ser.write(b"d")
+        data = bytearray()
+        deadline = time.time() + timeout
+        while time.time() < deadline:
+            data += ser.read(4096)
+        return bytes(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("file", nargs="?", help="binary capture containing a dump")
+    parser.add_argument("--port", help="serial port to request a dump from")
+    parser.add_argument("--baud", type=int, default=460800)
+    parser.add_argument("--timeout", type=float, default=2.0, help="seconds to read after requesting")
+    parser.add_argument("--save", help="also write the raw capture to this file")
+    args = parser.parse_args()
+
+    if args.port:
+        data = capture(args.port, args.baud, args.timeout)
+    elif args.file:
+        with open(args.file, "rb") as f:
+            data = f.read()
+    else:
+        parser.error("give a capture file or --port")
+
+    if args.save:
+        with open(args.save, "wb") as f:
+            f.write(data)
+
+    records = decode(data)
+    if records is None:
+        sys.exit("no INRC dump found")
+
+    detents = 0
+    counts = {}
+    for offset_us, topic, type_, value in records:
+        text = describe(topic, type_, value)
+        print(f"{offset_us / 1000:10.3f} ms  {text}")
+        key = text.split(" delta=")[0]
+        counts[key] = counts.get(key, 0) + 1
+        if topic == TOPIC_ENCODER and type_ == 0:
+            detents += abs(value)
+
+    duration_s = records[-1][0] / 1e6 if records else 0
+    print(f"\n{len(records)} events, {detents} detents over {duration_s:.2f} s")
+    for key in sorted(counts):
+        print(f"  {key:<28} {counts[key]}")
+
+
+if __name__ == "__main__":
+    main()
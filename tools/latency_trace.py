@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""Decode a LatencyTrace binary dump and print per-stage latency histograms.
+
+The firmware (built with -D LATENCY_TRACE_ENABLED=1) writes the dump when it
+receives 't' on the serial console. The dump may be surrounded by regular log
+text; the decoder searches for the "LTRC" header.
+
+Usage:
+    latency_trace.py capture.bin             # decode a saved capture
+    latency_trace.py --port /dev/ttyACM0     # request a dump (needs pyserial)
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+MAGIC = b"LTRC"
+HEADER = struct.Struct("<4sBBHI")     # magic, version, recordSize, count, overwritten
+RECORD = struct.Struct("<QIBBH")      # stampUs, latencyUs, stage, reserved, sequence
+SUPPORTED_VERSION = 1
+
+# Must match include/Enum/TraceStageEnum.h
+STAGES = ["DRIVER", "DISPATCH", "HANDLER", "HID_SEND", "DISPLAY_SUBMIT"]
+
+# Upper bucket bounds in microseconds
+BUCKETS = [50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000]
+
+
+def decode(data):
+    """Yield (header, records) for every dump found in data."""
+    offset = 0
+    while True:
+        start = data.find(MAGIC, offset)
+        if start < 0 or start + HEADER.size > len(data):
+            return
+        _, version, record_size, count, overwritten = HEADER.unpack_from(data, start)
+        body = start + HEADER.size
+        end = body + count * record_size
+        if version != SUPPORTED_VERSION or record_size != RECORD.size or end > len(data):
+            offset = start + 1
+            continue
+        records = [RECORD.unpack_from(data, body + i * record_size) for i in range(count)]
+        yield {"count": count, "overwritten": overwritten}, records
+        offset = end
+
+
+def percentile(sorted_values, p):
+    if not sorted_values:
+        return 0
+    index = min(len(sorted_values) - 1, int(round(p / 100.0 * (len(sorted_values) - 1))))
+    return sorted_values[index]
+
+
+def bucket_label(i):
+    low = 0 if i == 0 else BUCKETS[i - 1]
+    high = BUCKETS[i] if i < len(BUCKETS) else None
+    fmt = lambda us: f"{us / 1000:g}ms" if us >= 1000 else f"{us}us"
+    return f"{fmt(low):>7} - {fmt(high):<7}" if high else f"{fmt(low):>7} +       "
+
+
+def report(header, records, out):
+    out.write(f"records: {header['count']}  overwritten: {header['overwritten']}\n")
+
+    gaps = sum(1 for a, b in zip(records, records[1:]) if (a[4] + 1) & 0xFFFF != b[4])
+    if gaps:
+        out.write(f"sequence gaps: {gaps} (stamps lost to overwrite or dump)\n")
+
+    by_stage = {}
+    for _, latency, stage, _, _ in records:
+        by_stage.setdefault(stage, []).append(latency)
+
+    for stage in sorted(by_stage):
+        values = sorted(by_stage[stage])
+        name = STAGES[stage] if stage < len(STAGES) else f"STAGE_{stage}"
+        out.write(f"\n{name}  n={len(values)}  p50={percentile(values, 50)}us  "
+                  f"p90={percentile(values, 90)}us  p99={percentile(values, 99)}us  max={values[-1]}us\n")
+
+        counts = [0] * (len(BUCKETS) + 1)
+        for v in values:
+            i = 0
+            while i < len(BUCKETS) and v >= BUCKETS[i]:
+                i += 1
+            counts[i] += 1
+
+        peak = max(counts)
+        for i, c in enumerate(counts):
+            if c == 0:
+                continue
+            bar = "#" * max(1, c * 40 // peak)
+            out.write(f"  {bucket_label(i)} {c:6d} {bar}\n")
+
+
+def capture(port, baud, timeout):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("pyserial is required for --port (pip install pyserial)")
+
+    with serial.Serial(port, baud, timeout=0.2) as ser:
+        ser.reset_input_buffer()
+        ser.write(b"t")
+        data = bytearray()
+        deadline = time.time() + timeout
+        while time.time() < deadline:
+            data += ser.read(4096)
+        return bytes(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("file", nargs="?", help="binary capture containing one or more dumps")
+    parser.add_argument("--port", help="serial port to request a dump from")
+    parser.add_argument("--baud", type=int, default=460800)
+    parser.add_argument("--timeout", type=float, default=2.0, help="seconds to read after requesting")
+    parser.add_argument("--save", help="also write the raw capture to this file")
+    args = parser.parse_args()
+
+    if args.port:
+        data = capture(args.port, args.baud, args.timeout)
+    elif args.file:
+        with open(args.file, "rb") as f:
+            data = f.read()
+    else:
+        parser.error("give a capture file or --port")
+
+    if args.save:
+        with open(args.save, "wb") as f:
+            f.write(data)
+
+    found = False
+    for header, records in decode(data):
+        found = True
+        report(header, records, sys.stdout)
+    if not found:
+        sys.exit("no LTRC dump found")
+
+
+if __name__ == "__main__":
+    main()
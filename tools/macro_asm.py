@@ -0,0 +1,320 @@
+#!/usr/bin/env python3
+r"""Assemble, disassemble and upload macro bytecode programs.
+
+Source syntax, one instruction per line ('#' starts a comment):
+    down KEY            hold a key          up KEY          release it
+    tap KEY             down + up           mods ctrl+shift replace held modifiers (0 = none)
+    consumer NAME       media key           wheel V [H]     one wheel report
+    delay MS            wait (0-65535)      type "text\n"  tap each character (Python string literal)
+    repeat N ... end    run the body N times (nestable)
+    stop                end the program early
+
+KEY is a single character (a, A, 1, '#'), a name (ctrl, shift, alt, gui,
+rctrl, rshift, ralt, rgui, enter, esc, backspace, tab, space, capslock,
+f1-f24, printscreen, insert, delete, home, end, pageup, pagedown, up,
+down, left, right, num+, num-) or a raw library keycode such as 0xB0.
+
+Usage:
+    macro_asm.py asm copy_paste.macro -o copy_paste.bin
+    macro_asm.py dis copy_paste.bin
+    macro_asm.py upload copy_paste.macro --slot button1 --port /dev/ttyACM0   # needs pyserial
+    macro_asm.py upload --clear --slot button1 --port /dev/ttyACM0
+
+Uploading needs firmware built with -D MACRO_UPLOAD_ENABLED=1.
+"""
+
+import argparse
+import ast
+import json
+import shlex
+import struct
+import sys
+import time
+
+# Must match include/Config/macro_config.h and include/Enum/MacroOpcodeEnum.h
+PROGRAM_VERSION = 1
+MAX_PROGRAM_BYTES = 256
+MAX_LOOP_DEPTH = 4
+UPLOAD_COMMAND = b"M"
+
+OP_END, OP_KEY_DOWN, OP_KEY_UP, OP_MODIFIERS, OP_CONSUMER, OP_WHEEL, OP_DELAY, OP_REPEAT, OP_TYPE = range(9)
+OPERAND_LENGTH = {OP_END: 0, OP_KEY_DOWN: 1, OP_KEY_UP: 1, OP_MODIFIERS: 1, OP_CONSUMER: 2,
+                  OP_WHEEL: 2, OP_DELAY: 2, OP_REPEAT: 2, OP_TYPE: 1}
+
+# Must match include/Enum/MacroInputEnum.h
+SLOTS = ["wheel_button", "wheel_left", "wheel_right", "button1", "button2", "button3", "button4"]
+
+# BleKeyboard::press() encoding: modifiers 0x80-0x87, other keys are HID usage + 136
+MODIFIER_KEYS = {"ctrl": 0x80, "shift": 0x81, "alt": 0x82, "gui": 0x83,
+                 "rctrl": 0x84, "rshift": 0x85, "ralt": 0x86, "rgui": 0x87}
+USAGE_OFFSET = 136
+NAMED_USAGES = {"enter": 0x28, "esc": 0x29, "backspace": 0x2A, "tab": 0x2B, "capslock": 0x39,
+                "printscreen": 0x46, "insert": 0x49, "home": 0x4A, "pageup": 0x4B, "delete": 0x4C,
+                "end": 0x4D, "pagedown": 0x4E, "right": 0x4F, "left": 0x50, "down": 0x51, "up": 0x52,
+                "num-": 0x56, "num+": 0x57}
+NAMED_USAGES.update({f"f{n}": 0x3A + n - 1 for n in range(1, 13)})
+NAMED_USAGES.update({f"f{n}": 0x68 + n - 13 for n in range(13, 25)})
+
+KEY_NAMES = dict(MODIFIER_KEYS)
+KEY_NAMES.update({name: usage + USAGE_OFFSET for name, usage in NAMED_USAGES.items()})
+KEY_NAMES["space"] = ord(" ")
+KEYCODE_NAMES = {code: name for name, code in KEY_NAMES.items()}
+
+# Library MediaKeyReport bytes
+CONSUMER_KEYS = {"next": (1, 0), "previous": (2, 0), "stop": (4, 0), "play_pause": (8, 0),
+                 "mute": (16, 0), "volume_up": (32, 0), "volume_down": (64, 0), "www_home": (128, 0),
+                 "computer": (0, 1), "calculator": (0, 2), "bookmarks": (0, 4), "search": (0, 8),
+                 "www_stop": (0, 16), "www_back": (0, 32), "media_select": (0, 64), "mail": (0, 128)}
+CONSUMER_NAMES = {value: name for name, value in CONSUMER_KEYS.items()}
+
+
+class AsmError(Exception):
+    pass
+
+
+def parse_key(token):
+    if token.lower() in KEY_NAMES:
+        return KEY_NAMES[token.lower()]
+    if len(token) == 1 and 0x20 <= ord(token) < 0x7F:
+        return ord(token)
+    if token.lower().startswith("0x"):
+        value = int(token, 16)
+        if 0 < value <= 0xFF:
+            return value
+    raise AsmError(f"unknown key '{token}'")
+
+
+def parse_modifiers(token):
+    if token == "0":
+        return 0
+    mask = 0
+    for name in token.lower().split("+"):
+        if name not in MODIFIER_KEYS:
+            raise AsmError(f"unknown modifier '{name}'")
+        mask |= 1 << (MODIFIER_KEYS[name] - 0x80)
+    return mask
+
+
+def parse_int(token, low, high, what):
+    try:
+        value = int(token, 0)
+    except ValueError:
+        raise AsmError(f"{what} must be a number, got '{token}'")
+    if not low <= value <= high:
+        raise AsmError(f"{what} {value} outside {low}..{high}")
+    return value
+
+
+def assemble(source):
+    """Return the program blob for assembler source text."""
+    # Each open block: (repeat count, body bytes); the outermost block is the program
+    blocks = [(None, bytearray())]
+
+    for lineno, raw in enumerate(source.splitlines(), 1):
+        try:
+            words = raw.split(None, 1)
+            if words and words[0].lower() == "type":
+                # The text is a string literal so escapes like \n work; no trailing comment
+                text = ast.literal_eval(words[1].strip()) if len(words) > 1 else None
+                if not isinstance(text, str):
+                    raise ValueError("type takes a quoted string")
+                args = ["type", text]
+            else:
+                args = shlex.split(raw, comments=True)
+        except (ValueError, SyntaxError) as e:
+            raise AsmError(f"line {lineno}: {e}")
+        if not args:
+            continue
+
+        op, operands = args[0].lower(), args[1:]
+        out = blocks[-1][1]
+        try:
+            expected = {"down": 1, "up": 1, "tap": 1, "mods": 1, "consumer": 1, "delay": 1,
+                        "repeat": 1, "type": 1, "end": 0, "stop": 0}
+            if op == "wheel":
+                if len(operands) not in (1, 2):
+                    raise AsmError("wheel takes V [H]")
+            elif op not in expected:
+                raise AsmError(f"unknown instruction '{op}'")
+            elif len(operands) != expected[op]:
+                raise AsmError(f"{op} takes {expected[op]} operand(s)")
+
+            if op == "down":
+                out += bytes([OP_KEY_DOWN, parse_key(operands[0])])
+            elif op == "up":
+                out += bytes([OP_KEY_UP, parse_key(operands[0])])
+            elif op == "tap":
+                key = parse_key(operands[0])
+                out += bytes([OP_KEY_DOWN, key, OP_KEY_UP, key])
+            elif op == "mods":
+                out += bytes([OP_MODIFIERS, parse_modifiers(operands[0])])
+            elif op == "consumer":
+                name = operands[0].lower()
+                if name not in CONSUMER_KEYS:
+                    raise AsmError(f"unknown consumer key '{name}'")
+                out += bytes([OP_CONSUMER, *CONSUMER_KEYS[name]])
+            elif op == "wheel":
+                v = parse_int(operands[0], -127, 127, "wheel")
+                h = parse_int(operands[1], -127, 127, "hwheel") if len(operands) > 1 else 0
+                out += struct.pack("<Bbb", OP_WHEEL, v, h)
+            elif op == "delay":
+                out += struct.pack("<BH", OP_DELAY, parse_int(operands[0], 0, 0xFFFF, "delay"))
+            elif op == "type":
+                text = operands[0].encode("ascii")
+                for i in range(0, len(text), 255):
+                    chunk = text[i:i + 255]
+                    out += bytes([OP_TYPE, len(chunk)]) + chunk
+            elif op == "stop":
+                out += bytes([OP_END])
+            elif op == "repeat":
+                if len(blocks) > MAX_LOOP_DEPTH:
+                    raise AsmError(f"repeat nested deeper than {MAX_LOOP_DEPTH}")
+                blocks.append((parse_int(operands[0], 0, 255, "repeat count"), bytearray()))
+            elif op == "end":
+                if len(blocks) == 1:
+                    raise AsmError("end without repeat")
+                count, body = blocks.pop()
+                if len(body) > 255:
+                    raise AsmError(f"repeat body is {len(body)} bytes (max 255)")
+                blocks[-1][1].extend(bytes([OP_REPEAT, count, len(body)]) + body)
+        except (AsmError, UnicodeEncodeError) as e:
+            raise AsmError(f"line {lineno}: {e}")
+
+    if len(blocks) != 1:
+        raise AsmError("repeat without end")
+
+    blob = bytes([PROGRAM_VERSION]) + bytes(blocks[0][1])
+    if len(blob) > MAX_PROGRAM_BYTES:
+        raise AsmError(f"program is {len(blob)} bytes (max {MAX_PROGRAM_BYTES})")
+    return blob
+
+
+def key_name(code):
+    if code in KEYCODE_NAMES:
+        return KEYCODE_NAMES[code]
+    if 0x21 <= code < 0x7F:
+        return shlex.quote(chr(code))
+    return f"0x{code:02X}"
+
+
+def disassemble(blob):
+    """Return assembler source for a program blob (the inverse of assemble)."""
+    if not blob or blob[0] != PROGRAM_VERSION:
+        raise AsmError(f"not a version {PROGRAM_VERSION} macro program")
+
+    lines = []
+    loop_ends = []
+    pc = 1
+    while pc < len(blob):
+        while loop_ends and pc == loop_ends[-1]:
+            loop_ends.pop()
+            lines.append("    " * len(loop_ends) + "end")
+        indent = "    " * len(loop_ends)
+
+        op = blob[pc]
+        if op not in OPERAND_LENGTH:
+            raise AsmError(f"unknown opcode 0x{op:02X} at {pc}")
+        operands = blob[pc + 1:pc + 1 + OPERAND_LENGTH[op]]
+        if len(operands) < OPERAND_LENGTH[op]:
+            raise AsmError(f"truncated instruction at {pc}")
+        pc += 1 + OPERAND_LENGTH[op]
+
+        if op == OP_END:
+            lines.append(indent + "stop")
+        elif op == OP_KEY_DOWN:
+            lines.append(indent + f"down {key_name(operands[0])}")
+        elif op == OP_KEY_UP:
+            lines.append(indent + f"up {key_name(operands[0])}")
+        elif op == OP_MODIFIERS:
+            names = [name for name, code in MODIFIER_KEYS.items() if operands[0] & (1 << (code - 0x80))]
+            lines.append(indent + f"mods {'+'.join(names) or '0'}")
+        elif op == OP_CONSUMER:
+            lines.append(indent + f"consumer {CONSUMER_NAMES.get(tuple(operands), 'unknown')}")
+        elif op == OP_WHEEL:
+            v, h = struct.unpack("<bb", operands)
+            lines.append(indent + (f"wheel {v} {h}" if h else f"wheel {v}"))
+        elif op == OP_DELAY:
+            lines.append(indent + f"delay {struct.unpack('<H', operands)[0]}")
+        elif op == OP_REPEAT:
+            lines.append(indent + f"repeat {operands[0]}")
+            loop_ends.append(pc + operands[1])
+        elif op == OP_TYPE:
+            text = blob[pc:pc + operands[0]].decode("ascii", errors="replace")
+            pc += operands[0]
+            lines.append(indent + "type " + json.dumps(text))
+
+    while loop_ends:
+        loop_ends.pop()
+        lines.append("    " * len(loop_ends) + "end")
+    return "\n".join(lines) + "\n"
+
+
+def parse_slot(text):
+    if text.lower() in SLOTS:
+        return SLOTS.index(text.lower())
+    slot = int(text)
+    if not 0 <= slot < len(SLOTS):
+        raise AsmError(f"slot {slot} outside 0..{len(SLOTS) - 1}")
+    return slot
+
+
+def upload(port, baud, slot, blob):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("pyserial is required for upload (pip install pyserial)")
+
+    with serial.Serial(port, baud, timeout=0.2) as ser:
+        ser.write(UPLOAD_COMMAND + struct.pack("<BH", slot, len(blob)) + blob)
+        ser.flush()
+        time.sleep(0.5)
+        sys.stdout.write(ser.read(4096).decode(errors="replace"))  # Device log shows the result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    asm = sub.add_parser("asm", help="assemble source to a program blob")
+    asm.add_argument("source")
+    asm.add_argument("-o", "--output", help="write the blob here (default: print hex)")
+
+    dis = sub.add_parser("dis", help="disassemble a program blob")
+    dis.add_argument("blob")
+
+    up = sub.add_parser("upload", help="assemble and store a program on the device")
+    up.add_argument("source", nargs="?")
+    up.add_argument("--slot", required=True, help=f"0-{len(SLOTS) - 1} or one of {', '.join(SLOTS)}")
+    up.add_argument("--clear", action="store_true", help="remove the slot's program")
+    up.add_argument("--port", required=True)
+    up.add_argument("--baud", type=int, default=460800)
+
+    args = parser.parse_args()
+    try:
+        if args.command == "asm":
+            with open(args.source) as f:
+                blob = assemble(f.read())
+            if args.output:
+                with open(args.output, "wb") as f:
+                    f.write(blob)
+            else:
+                print(blob.hex(" "))
+            print(f"{len(blob)} bytes", file=sys.stderr)
+        elif args.command == "dis":
+            with open(args.blob, "rb") as f:
+                sys.stdout.write(disassemble(f.read()))
+        else:
+            if args.clear:
+                blob = b""
+            elif args.source:
+                with open(args.source) as f:
+                    blob = assemble(f.read())
+            else:
+                parser.error("give a source file or --clear")
+            upload(args.port, args.baud, parse_slot(args.slot), blob)
+    except AsmError as e:
+        sys.exit(f"error: {e}")
+
+
+if __name__ == "__main__":
+    main()